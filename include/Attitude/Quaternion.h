@@ -12,6 +12,7 @@
 #include <array>
 #include <initializer_list>
 #include <iostream>
+#include <span>
 
 namespace MathUtils {
 
@@ -109,6 +110,25 @@ public:
      */
     void normalize();
 
+    /**
+     * @brief Normalize the quaternion with an approximate reciprocal square root.
+     *
+     * @details No sqrt or divides. The resulting magnitude is within 4.6e-6 of one.
+     * The squared magnitude must be positive and normal, as fast_rsqrt requires.
+     *
+     * @see MathUtils::fast_rsqrt
+     */
+    void normalize_fast();
+
+    /**
+     * @brief Renormalize a nearly-unit quaternion with a first-order correction.
+     *
+     * @details q *= 1.5 - 0.5 * |q|^2. No sqrt or divides. If |q|^2 = 1 + e, the resulting
+     * magnitude is within (3/8) * e^2 of one. Intended for removing drift after integration or
+     * repeated products.
+     */
+    void renormalize_nearly_unit() noexcept;
+
     /**
      * @brief Return the quaternion's eigen axis.
      *
@@ -147,6 +167,35 @@ private:
  */
 Quaternion operator*(const Quaternion& q_b, const Quaternion& q_c);
 
+/**
+ * @brief Compute the quaternion product into existing storage. Normalizes result.
+ *
+ * @details `q_out = q_b * q_c`. `q_out` may alias `q_b` or `q_c`.
+ *
+ * @param q_b First quaternion.
+ * @param q_c Second quaternion.
+ * @param q_out Quaternion product q_b * q_c.
+ */
+void mul_into(const Quaternion& q_b, const Quaternion& q_c, Quaternion& q_out);
+
+/**
+ * @brief Normalize every quaternion with an approximate reciprocal square root.
+ *
+ * @details Calls Quaternion::normalize_fast().
+ *
+ * @param quats Quaternions to normalize.
+ */
+void normalize_fast(std::span<Quaternion> quats);
+
+/**
+ * @brief Renormalize every nearly-unit quaternion with a first-order correction.
+ *
+ * @details Calls Quaternion::renormalize_nearly_unit().
+ *
+ * @param quats Quaternions to renormalize.
+ */
+void renormalize_nearly_unit(std::span<Quaternion> quats) noexcept;
+
 /**
  * @brief Print a quaternion to a stream. Comma-separates values. Does not add a newline at the end.
  *
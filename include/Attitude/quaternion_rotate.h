@@ -7,8 +7,11 @@
 #pragma once
 
 #include "Attitude/Quaternion.h"
+#include "fixed_point.h"
 #include "LinAlg/Vector.h"
 
+#include <array>
+
 namespace MathUtils {
 
 /**
@@ -24,4 +27,56 @@ namespace MathUtils {
  */
 Vector<3> quaternion_rotate(const Quaternion& q_a_b, const Vector<3>& v_b);
 
+/**
+ * @brief Rotate a vector defined by a quaternion, in fixed-point arithmetic.
+ *
+ * @details Same equation as quaternion_rotate(Quaternion, Vector<3>), evaluated with saturating
+ * fixed-point operations for targets without an FPU. Each product rounds, so expect a few LSB of
+ * error per component.
+ *
+ * The quaternion must be normalized and the vector must have |v| < 1 for a Q-format range of
+ * [-1, 1). Each output is a running sum of a unit DCM row times `v`, and its partial sums reach
+ * up to |v|, so components that are each in range but have |v| >= 1 saturate. E.g. (0.9, 0.9, 0)
+ * rotated 45 deg about z clips. Components smaller than 1/sqrt(3) always satisfy the bound.
+ *
+ * @tparam Q Fixed-point type, e.g. MathUtils::Q15 or MathUtils::Q31.
+ * @param q_a_b Quaternion [s, x, y, z] defining the rotation from frame "B" to "A."
+ * @param v_b Vector in frame "B."
+ * @return Vector rotated to frame "A."
+ */
+template<typename Q>
+requires fixed_point_type<Q>
+std::array<Q, 3> quaternion_rotate(const std::array<Q, 4>& q_a_b, const std::array<Q, 3>& v_b)
+{
+    const Q q0 = q_a_b[0];
+    const Q q1 = q_a_b[1];
+    const Q q2 = q_a_b[2];
+    const Q q3 = q_a_b[3];
+
+    const Q q00 = q0 * q0;
+    const Q q11 = q1 * q1;
+    const Q q22 = q2 * q2;
+    const Q q33 = q3 * q3;
+
+    const Q q01 = q0 * q1;
+    const Q q02 = q0 * q2;
+    const Q q03 = q0 * q3;
+    const Q q12 = q1 * q2;
+    const Q q13 = q1 * q3;
+    const Q q23 = q2 * q3;
+
+    // 2 * (a +/- b) is bounded by one for a unit quaternion, so double with a saturating add
+    auto twice = [](const Q val){return val + val;};
+
+    const Q v0 = v_b[0];
+    const Q v1 = v_b[1];
+    const Q v2 = v_b[2];
+
+    return std::array<Q, 3> {
+        ((q00 + q11 - q22 - q33) * v0) + (twice(q12 + q03) * v1) + (twice(q13 - q02) * v2),
+        (twice(q12 - q03) * v0) + ((q00 - q11 + q22 - q33) * v1) + (twice(q23 + q01) * v2),
+        (twice(q13 + q02) * v0) + (twice(q23 - q01) * v1) + ((q00 - q11 - q22 + q33) * v2)
+    };
+}
+
 }  // namespace MathUtils
@@ -8,8 +8,11 @@
 #define MATHUTILS_ATTITUDE_QUATERNION_TO_DCM_H_
 
 #include "Attitude/Quaternion.h"
+#include "fixed_point.h"
 #include "LinAlg/Matrix.h"
 
+#include <array>
+
 namespace MathUtils {
 
 /**
@@ -23,6 +26,47 @@ namespace MathUtils {
  */
 Matrix<3,3> quaternion_to_dcm(const Quaternion& q);
 
+/**
+ * @brief Convert quaternion to direction cosine matrix, in fixed-point arithmetic.
+ *
+ * @details Same equation as quaternion_to_dcm(Quaternion), evaluated with saturating fixed-point
+ * operations for targets without an FPU. The quaternion must be normalized. DCM elements of
+ * exactly +1 saturate to the largest Q-format value.
+ *
+ * @tparam Q Fixed-point type, e.g. MathUtils::Q15 or MathUtils::Q31.
+ * @param q Quaternion [s, x, y, z].
+ * @return Corresponding DCM, row-major.
+ */
+template<typename Q>
+requires fixed_point_type<Q>
+std::array<std::array<Q, 3>, 3> quaternion_to_dcm(const std::array<Q, 4>& q)
+{
+    const Q q0 = q[0];
+    const Q q1 = q[1];
+    const Q q2 = q[2];
+    const Q q3 = q[3];
+
+    const Q q00 = q0 * q0;
+    const Q q11 = q1 * q1;
+    const Q q22 = q2 * q2;
+    const Q q33 = q3 * q3;
+
+    const Q q01 = q0 * q1;
+    const Q q02 = q0 * q2;
+    const Q q03 = q0 * q3;
+    const Q q12 = q1 * q2;
+    const Q q13 = q1 * q3;
+    const Q q23 = q2 * q3;
+
+    auto twice = [](const Q val){return val + val;};
+
+    return std::array<std::array<Q, 3>, 3> {{
+        {(q00 + q11 - q22 - q33), twice(q12 + q03), twice(q13 - q02)},
+        {twice(q12 - q03), (q00 - q11 + q22 - q33), twice(q23 + q01)},
+        {twice(q13 + q02), twice(q23 - q01), (q00 - q11 - q22 + q33)}
+    }};
+}
+
 }  // namespace MathUtils
 
 #endif  // MATHUTILS_ATTITUDE_QUATERNION_TO_DCM_H_
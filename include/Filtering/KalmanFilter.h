@@ -0,0 +1,573 @@
+/**
+ * @file KalmanFilter.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Linear Kalman filter with a fixed-size workspace.
+ */
+
+#pragma once
+
+#include "LinAlg/cholesky.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/Vector.h"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+
+namespace MathUtils {
+
+/**
+ * @brief Covariance update used after a measurement.
+ */
+enum class KalmanCovarianceUpdate {
+    Standard,  ///< P = P - K * H * P. Cheapest, assumes the optimal gain.
+    Joseph,    ///< P = (I - K * H) * P * (I - K * H)^T + K * R * K^T. Valid for any gain and stays
+               ///< positive semi-definite under rounding, at O(NX^3) instead of O(NX^2 * NZ).
+};
+
+/**
+ * @brief Outcome of a measurement update.
+ */
+enum class KalmanUpdateStatus {
+    Accepted,             ///< State and covariance were updated.
+    Gated,                ///< Normalized innovation squared exceeded the gate. Nothing changed.
+    NotPositiveDefinite,  ///< Innovation covariance was not positive definite. Nothing changed.
+};
+
+/**
+ * @brief Result of a measurement update.
+ */
+struct KalmanUpdateResult {
+    KalmanUpdateStatus status;  ///< Outcome.
+    double nis;                 ///< Normalized innovation squared, y^T * S^-1 * y. NaN if not computed.
+};
+
+/**
+ * @brief Gate that accepts every measurement.
+ */
+inline constexpr double KALMAN_NO_GATE = std::numeric_limits<double>::infinity();
+
+namespace Internal {
+
+/**
+ * @brief Copy the upper triangle of a square row-major matrix into the lower triangle.
+ */
+template<std::size_t N>
+void mirror_upper_triangle(double* const mat) noexcept
+{
+    for (std::size_t ii = 1; ii < N; ii++)
+    {
+        for (std::size_t jj = 0; jj < ii; jj++)
+        {
+            mat[(ii * N) + jj] = mat[(jj * N) + ii];
+        }
+    }
+}
+
+}  // namespace Internal
+
+/**
+ * @brief Linear Kalman filter.
+ *
+ * @details Every temporary lives in a workspace owned by the filter, so predict and update never
+ * allocate and the whole object can live on the stack or in static storage. Symmetric results
+ * (P and S) are computed for the upper triangle only and mirrored, which also keeps P exactly
+ * symmetric. Process and measurement noise covariances must be symmetric; only their upper
+ * triangles are read.
+ *
+ * Gates are thresholds on the normalized innovation squared (NIS), which is chi-square distributed
+ * with as many degrees of freedom as measurements. E.g. 6.63 for 1 DOF or 9.21 for 2 DOF at 99%.
+ *
+ * @tparam NX Number of states.
+ * @tparam NZ Number of measurements in a vector update.
+ *
+ * @ref https://en.wikipedia.org/wiki/Kalman_filter
+ */
+template<std::size_t NX, std::size_t NZ>
+requires valid_matrix_dims<NX, NZ>
+class KalmanFilter {
+public:
+    KalmanFilter() = default;
+
+    ~KalmanFilter() = default;
+
+    /**
+     * @brief Create a filter with an initial state and covariance.
+     *
+     * @param x0 Initial state.
+     * @param p0 Initial state covariance.
+     * @param cov_update Covariance update used after measurements.
+     */
+    KalmanFilter(const Vector<NX>& x0, const Matrix<NX,NX>& p0,
+        const KalmanCovarianceUpdate cov_update = KalmanCovarianceUpdate::Joseph)
+        :m_x{x0},
+        m_p{p0},
+        m_cov_update{cov_update}
+    {}
+
+    KalmanFilter(const KalmanFilter& other) = default;
+
+    KalmanFilter(KalmanFilter&& other) noexcept = default;
+
+    KalmanFilter& operator=(const KalmanFilter& other) = default;
+
+    KalmanFilter& operator=(KalmanFilter&& other) noexcept = default;
+
+    /**
+     * @brief Get the state estimate.
+     *
+     * @return State.
+     */
+    [[nodiscard]] const Vector<NX>& state() const noexcept
+    {
+        return m_x;
+    }
+
+    /**
+     * @brief Set the state estimate.
+     *
+     * @param x State.
+     */
+    void set_state(const Vector<NX>& x) noexcept
+    {
+        m_x = x;
+    }
+
+    /**
+     * @brief Get the state covariance.
+     *
+     * @return Covariance.
+     */
+    [[nodiscard]] const Matrix<NX,NX>& covariance() const noexcept
+    {
+        return m_p;
+    }
+
+    /**
+     * @brief Set the state covariance.
+     *
+     * @param p Covariance.
+     */
+    void set_covariance(const Matrix<NX,NX>& p) noexcept
+    {
+        m_p = p;
+    }
+
+    /**
+     * @brief Get the covariance update used after measurements.
+     *
+     * @return Covariance update form.
+     */
+    [[nodiscard]] KalmanCovarianceUpdate covariance_update() const noexcept
+    {
+        return m_cov_update;
+    }
+
+    /**
+     * @brief Set the covariance update used after measurements.
+     *
+     * @param cov_update Covariance update form.
+     */
+    void set_covariance_update(const KalmanCovarianceUpdate cov_update) noexcept
+    {
+        m_cov_update = cov_update;
+    }
+
+    /**
+     * @brief Time update, x = F * x and P = F * P * F^T + Q.
+     *
+     * @param f State transition matrix.
+     * @param q Process noise covariance.
+     */
+    void predict(const Matrix<NX,NX>& f, const Matrix<NX,NX>& q) noexcept
+    {
+        mul_into(f, m_x, m_ws.x);
+        m_x = m_ws.x;
+
+        mul_into(f, m_p, m_ws.fp);
+
+        const double* const pfp = m_ws.fp.data();
+        const double* const pf = f.data();
+        const double* const pq = q.data();
+        double* const pp = m_p.data();
+
+        // (F * P) * F^T: row i of F * P dotted with row j of F
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            for (std::size_t jj = ii; jj < NX; jj++)
+            {
+                double sum = pq[(ii * NX) + jj];
+
+                for (std::size_t kk = 0; kk < NX; kk++)
+                {
+                    sum += pfp[(ii * NX) + kk] * pf[(jj * NX) + kk];
+                }
+
+                pp[(ii * NX) + jj] = sum;
+            }
+        }
+
+        Internal::mirror_upper_triangle<NX>(pp);
+    }
+
+    /**
+     * @brief Measurement update with NZ measurements at once.
+     *
+     * @param z Measurement.
+     * @param h Measurement matrix.
+     * @param r Measurement noise covariance.
+     * @param gate NIS threshold. Measurements above it are rejected.
+     * @return Update result.
+     */
+    KalmanUpdateResult update(const Vector<NZ>& z, const Matrix<NZ,NX>& h, const Matrix<NZ,NZ>& r,
+        const double gate = KALMAN_NO_GATE) noexcept
+    {
+        const double* const ph = h.data();
+        const double* const pp = m_p.data();
+        const double* const pr = r.data();
+        double* const pph = m_ws.pht.data();
+        double* const ps = m_ws.s.data();
+
+        // y = z - H * x
+        mul_into(h, m_x, m_ws.y);
+        const Vector<NZ> y = z - m_ws.y;
+
+        // P * H^T: row i of P dotted with row j of H
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            for (std::size_t jj = 0; jj < NZ; jj++)
+            {
+                double sum = 0.0;
+
+                for (std::size_t kk = 0; kk < NX; kk++)
+                {
+                    sum += pp[(ii * NX) + kk] * ph[(jj * NX) + kk];
+                }
+
+                pph[(ii * NZ) + jj] = sum;
+            }
+        }
+
+        // S = H * P * H^T + R, upper triangle
+        for (std::size_t ii = 0; ii < NZ; ii++)
+        {
+            for (std::size_t jj = ii; jj < NZ; jj++)
+            {
+                double sum = pr[(ii * NZ) + jj];
+
+                for (std::size_t kk = 0; kk < NX; kk++)
+                {
+                    sum += ph[(ii * NX) + kk] * pph[(kk * NZ) + jj];
+                }
+
+                ps[(ii * NZ) + jj] = sum;
+            }
+        }
+
+        Internal::mirror_upper_triangle<NZ>(ps);
+
+        if (!cholesky_decompose(m_ws.s, m_ws.l))
+        {
+            return {KalmanUpdateStatus::NotPositiveDefinite, std::numeric_limits<double>::quiet_NaN()};
+        }
+
+        // NIS = y^T * S^-1 * y = |L^-1 * y|^2
+        const Vector<NZ> w = forward_substitute(m_ws.l, y);
+        const double nis = dot(w, w);
+
+        if (!(nis <= gate))
+        {
+            return {KalmanUpdateStatus::Gated, nis};
+        }
+
+        // K = P * H^T * S^-1, one row at a time since S is symmetric
+        double* const pk = m_ws.k.data();
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            Vector<NZ> row;
+
+            for (std::size_t jj = 0; jj < NZ; jj++)
+            {
+                row(jj) = pph[(ii * NZ) + jj];
+            }
+
+            row = cholesky_solve(m_ws.l, row);
+
+            for (std::size_t jj = 0; jj < NZ; jj++)
+            {
+                pk[(ii * NZ) + jj] = row(jj);
+            }
+        }
+
+        mul_into(m_ws.k, y, m_ws.x);
+        m_x += m_ws.x;
+
+        update_covariance(h, r);
+
+        return {KalmanUpdateStatus::Accepted, nis};
+    }
+
+    /**
+     * @brief Measurement update with a single scalar measurement, O(NX^2).
+     *
+     * @param z Measurement.
+     * @param h Measurement row, z = h . x.
+     * @param r Measurement noise variance.
+     * @param gate NIS threshold. Measurements above it are rejected.
+     * @return Update result.
+     */
+    KalmanUpdateResult update_scalar(const double z, const Vector<NX>& h, const double r,
+        const double gate = KALMAN_NO_GATE) noexcept
+    {
+        mul_into(m_p, h, m_ws.x);
+
+        const double s = dot(h, m_ws.x) + r;
+
+        if (!(s > 0.0))
+        {
+            return {KalmanUpdateStatus::NotPositiveDefinite, std::numeric_limits<double>::quiet_NaN()};
+        }
+
+        const double y = z - dot(h, m_x);
+        const double nis = (y * y) / s;
+
+        if (!(nis <= gate))
+        {
+            return {KalmanUpdateStatus::Gated, nis};
+        }
+
+        const double* const pph = m_ws.x.data();
+        double* const pp = m_p.data();
+        const double inv_s = 1.0 / s;
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            m_x(ii) += pph[ii] * inv_s * y;
+        }
+
+        if (m_cov_update == KalmanCovarianceUpdate::Joseph)
+        {
+            // (I - K * h^T) * P, where h^T * P = (P * h)^T since P is symmetric
+            double* const pap = m_ws.fp.data();
+
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                const double k_i = pph[ii] * inv_s;
+
+                for (std::size_t jj = 0; jj < NX; jj++)
+                {
+                    pap[(ii * NX) + jj] = pp[(ii * NX) + jj] - (k_i * pph[jj]);
+                }
+            }
+
+            // (I - K * h^T) * P * (I - K * h^T)^T + K * r * K^T
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                const double k_i = pph[ii] * inv_s;
+                double aph_i = 0.0;
+
+                for (std::size_t kk = 0; kk < NX; kk++)
+                {
+                    aph_i += pap[(ii * NX) + kk] * h(kk);
+                }
+
+                for (std::size_t jj = ii; jj < NX; jj++)
+                {
+                    const double k_j = pph[jj] * inv_s;
+                    pp[(ii * NX) + jj] = pap[(ii * NX) + jj] - (aph_i * k_j) + (r * k_i * k_j);
+                }
+            }
+        }
+        else
+        {
+            // K = P * h / s
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                const double k_i = pph[ii] * inv_s;
+
+                for (std::size_t jj = ii; jj < NX; jj++)
+                {
+                    pp[(ii * NX) + jj] -= k_i * pph[jj];
+                }
+            }
+        }
+
+        Internal::mirror_upper_triangle<NX>(pp);
+
+        return {KalmanUpdateStatus::Accepted, nis};
+    }
+
+    /**
+     * @brief Process M measurements with uncorrelated noise as M scalar updates.
+     *
+     * @details Avoids forming and factoring the M x M innovation covariance. Each measurement is
+     * gated on its own.
+     *
+     * @tparam M Number of measurements.
+     * @param z Measurements.
+     * @param h Measurement matrix.
+     * @param r_diag Measurement noise variances.
+     * @param gate NIS threshold for each scalar update.
+     * @return Result of each scalar update.
+     */
+    template<std::size_t M>
+    std::array<KalmanUpdateResult, M> update_sequential(const Vector<M>& z, const Matrix<M,NX>& h,
+        const Vector<M>& r_diag, const double gate = KALMAN_NO_GATE) noexcept
+    {
+        std::array<KalmanUpdateResult, M> res {};
+        const double* const ph = h.data();
+
+        for (std::size_t ii = 0; ii < M; ii++)
+        {
+            for (std::size_t jj = 0; jj < NX; jj++)
+            {
+                m_ws.h_row(jj) = ph[(ii * NX) + jj];
+            }
+
+            res[ii] = update_scalar(z(ii), m_ws.h_row, r_diag(ii), gate);
+        }
+
+        return res;
+    }
+
+private:
+    /**
+     * @brief Covariance update for a vector measurement, upper triangle then mirrored.
+     *
+     * @details The Joseph form is evaluated as written, A = I - K * H and then
+     * A * P * A^T + K * R * K^T. Both terms are congruences of positive semi-definite matrices, so
+     * P stays positive semi-definite where the cancellation in P - K * H * P can break it.
+     *
+     * @param h Measurement matrix.
+     * @param r Measurement noise covariance. Only the upper triangle is read.
+     */
+    void update_covariance(const Matrix<NZ,NX>& h, const Matrix<NZ,NZ>& r) noexcept
+    {
+        const double* const ph = h.data();
+        const double* const pk = m_ws.k.data();
+        const double* const pph = m_ws.pht.data();
+        double* const pp = m_p.data();
+
+        if (m_cov_update == KalmanCovarianceUpdate::Joseph)
+        {
+            const double* const pr = r.data();
+            double* const pa = m_ws.a.data();
+            double* const pap = m_ws.fp.data();
+            double* const pkr = m_ws.kr.data();
+
+            // A = I - K * H
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                for (std::size_t jj = 0; jj < NX; jj++)
+                {
+                    double sum = (ii == jj) ? 1.0 : 0.0;
+
+                    for (std::size_t mm = 0; mm < NZ; mm++)
+                    {
+                        sum -= pk[(ii * NZ) + mm] * ph[(mm * NX) + jj];
+                    }
+
+                    pa[(ii * NX) + jj] = sum;
+                }
+            }
+
+            // A * P
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                for (std::size_t jj = 0; jj < NX; jj++)
+                {
+                    double sum = 0.0;
+
+                    for (std::size_t kk = 0; kk < NX; kk++)
+                    {
+                        sum += pa[(ii * NX) + kk] * pp[(kk * NX) + jj];
+                    }
+
+                    pap[(ii * NX) + jj] = sum;
+                }
+            }
+
+            // K * R, reading R from its upper triangle
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                for (std::size_t nn = 0; nn < NZ; nn++)
+                {
+                    double sum = 0.0;
+
+                    for (std::size_t mm = 0; mm < NZ; mm++)
+                    {
+                        const std::size_t r_idx = (mm <= nn) ? ((mm * NZ) + nn) : ((nn * NZ) + mm);
+                        sum += pk[(ii * NZ) + mm] * pr[r_idx];
+                    }
+
+                    pkr[(ii * NZ) + nn] = sum;
+                }
+            }
+
+            // (A * P) * A^T + (K * R) * K^T: rows of A * P and K * R dotted with rows of A and K
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                for (std::size_t jj = ii; jj < NX; jj++)
+                {
+                    double sum = 0.0;
+
+                    for (std::size_t kk = 0; kk < NX; kk++)
+                    {
+                        sum += pap[(ii * NX) + kk] * pa[(jj * NX) + kk];
+                    }
+
+                    for (std::size_t mm = 0; mm < NZ; mm++)
+                    {
+                        sum += pkr[(ii * NZ) + mm] * pk[(jj * NZ) + mm];
+                    }
+
+                    pp[(ii * NX) + jj] = sum;
+                }
+            }
+        }
+        else
+        {
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                for (std::size_t jj = ii; jj < NX; jj++)
+                {
+                    double sum = 0.0;
+
+                    for (std::size_t mm = 0; mm < NZ; mm++)
+                    {
+                        sum += pk[(ii * NZ) + mm] * pph[(jj * NZ) + mm];
+                    }
+
+                    pp[(ii * NX) + jj] -= sum;
+                }
+            }
+        }
+
+        Internal::mirror_upper_triangle<NX>(pp);
+    }
+
+    /**
+     * @brief Preallocated temporaries.
+     */
+    struct Workspace {
+        Vector<NX> x;           ///< State-sized temporary.
+        Vector<NX> h_row;       ///< Measurement row for sequential updates.
+        Vector<NZ> y;           ///< Measurement-sized temporary.
+        Matrix<NX,NX> fp;       ///< F * P, or (I - K * H) * P in the Joseph update.
+        Matrix<NX,NX> a;        ///< I - K * H.
+        Matrix<NX,NZ> pht;      ///< P * H^T.
+        Matrix<NX,NZ> k;        ///< Kalman gain.
+        Matrix<NX,NZ> kr;       ///< K * R.
+        Matrix<NZ,NZ> s;        ///< Innovation covariance.
+        Matrix<NZ,NZ> l;        ///< Cholesky factor of S.
+    };
+
+    Vector<NX> m_x;  ///< State estimate.
+    Matrix<NX,NX> m_p;  ///< State covariance.
+    KalmanCovarianceUpdate m_cov_update = KalmanCovarianceUpdate::Joseph;  ///< Covariance update.
+    Workspace m_ws;  ///< Temporaries.
+};
+
+}  // namespace MathUtils
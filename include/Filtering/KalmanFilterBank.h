@@ -0,0 +1,842 @@
+/**
+ * @file KalmanFilterBank.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Many identical, independent linear Kalman filters stored and stepped together.
+ */
+
+#pragma once
+
+#include "Filtering/KalmanFilter.h"
+#include "Internal/error_msg_helpers.h"
+#include "Internal/parallel_chunks.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/triangular.h"
+#include "LinAlg/Vector.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace MathUtils {
+
+/**
+ * @brief Bank of independent linear Kalman filters sharing the same models, e.g. one per track.
+ *
+ * @details Every state element and every upper-triangle covariance element is stored as its own
+ * array indexed by slot (structure-of-arrays), so slot is the SIMD lane. Filters are stepped in
+ * chunks of `LANES` slots with the lane loop innermost, which the compiler vectorizes across
+ * filters instead of within one small matrix. Chunks touch disjoint memory, so `predict()` and
+ * `update()` split the chunks across worker threads without locking. `predict_chunks()` and
+ * `update_chunks()` step a single chunk range on the calling thread.
+ *
+ * Removed slots are reused by later calls to `add_track()`. Inactive slots are still computed
+ * with the rest of their chunk, but their results are discarded.
+ *
+ * @tparam NX Number of states.
+ * @tparam NZ Number of measurements.
+ *
+ * @see MathUtils::KalmanFilter
+ */
+template<std::size_t NX, std::size_t NZ>
+requires valid_matrix_dims<NX, NZ>
+class KalmanFilterBank {
+public:
+    static constexpr std::size_t LANES = 8;  ///< Slots stepped together, and the storage granularity.
+    static constexpr std::size_t MIN_CHUNKS_PER_WORKER = 16;  ///< Fewest chunks per default worker.
+
+    KalmanFilterBank() = default;
+
+    ~KalmanFilterBank() = default;
+
+    /**
+     * @brief Create an empty bank.
+     *
+     * @param cov_update Covariance update used after measurements.
+     */
+    explicit KalmanFilterBank(const KalmanCovarianceUpdate cov_update)
+        :m_cov_update{cov_update}
+    {}
+
+    KalmanFilterBank(const KalmanFilterBank& other) = default;
+
+    KalmanFilterBank(KalmanFilterBank&& other) noexcept = default;
+
+    KalmanFilterBank& operator=(const KalmanFilterBank& other) = default;
+
+    KalmanFilterBank& operator=(KalmanFilterBank&& other) noexcept = default;
+
+    /**
+     * @brief Start a new filter, reusing a removed slot if there is one.
+     *
+     * @param x0 Initial state.
+     * @param p0 Initial state covariance. Only the upper triangle is read.
+     * @return Slot of the new filter.
+     */
+    std::size_t add_track(const Vector<NX>& x0, const Matrix<NX,NX>& p0)
+    {
+        std::size_t slot = m_num_slots;
+
+        if (m_free.empty())
+        {
+            m_num_slots++;
+
+            if (m_num_slots > m_active.size())
+            {
+                reserve_storage(m_active.size() + LANES);
+            }
+        }
+        else
+        {
+            slot = m_free.back();
+            m_free.pop_back();
+        }
+
+        set_state(slot, x0, p0);
+        m_active[slot] = 1;
+
+        return slot;
+    }
+
+    /**
+     * @brief Stop a filter and free its slot for reuse.
+     *
+     * @param slot Slot from add_track().
+     *
+     * @exception std::out_of_range Invalid or inactive slot.
+     */
+    void remove_track(const std::size_t slot)
+    {
+        check_active(slot);
+
+        m_active[slot] = 0;
+        m_free.push_back(slot);
+    }
+
+    /**
+     * @brief Check if a slot holds an active filter.
+     *
+     * @param slot Slot.
+     * @return True if active.
+     */
+    [[nodiscard]] bool is_active(const std::size_t slot) const noexcept
+    {
+        return (slot < m_num_slots) && (m_active[slot] != 0);
+    }
+
+    /**
+     * @brief Get the number of active filters.
+     *
+     * @return Number of active filters.
+     */
+    [[nodiscard]] std::size_t num_tracks() const noexcept
+    {
+        return m_num_slots - m_free.size();
+    }
+
+    /**
+     * @brief Get the number of slots, active or not. Per-slot inputs and outputs have this length.
+     *
+     * @return Number of slots.
+     */
+    [[nodiscard]] std::size_t num_slots() const noexcept
+    {
+        return m_num_slots;
+    }
+
+    /**
+     * @brief Get the number of `LANES`-wide chunks covering every slot.
+     *
+     * @return Number of chunks.
+     */
+    [[nodiscard]] std::size_t num_chunks() const noexcept
+    {
+        return (m_num_slots + LANES - 1) / LANES;
+    }
+
+    /**
+     * @brief Get the state of a filter.
+     *
+     * @param slot Slot.
+     * @return State.
+     *
+     * @exception std::out_of_range Invalid or inactive slot.
+     */
+    [[nodiscard]] Vector<NX> state(const std::size_t slot) const
+    {
+        check_active(slot);
+
+        Vector<NX> res;
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            res(ii) = m_x[ii][slot];
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief Get the state covariance of a filter.
+     *
+     * @param slot Slot.
+     * @return Covariance.
+     *
+     * @exception std::out_of_range Invalid or inactive slot.
+     */
+    [[nodiscard]] Matrix<NX,NX> covariance(const std::size_t slot) const
+    {
+        check_active(slot);
+
+        Matrix<NX,NX> res;
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            for (std::size_t jj = 0; jj < NX; jj++)
+            {
+                res(ii, jj) = m_p[p_index(ii, jj)][slot];
+            }
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief Time update of every active filter.
+     *
+     * @details Contiguous chunk ranges run on worker threads. Results do not depend on the thread
+     * count.
+     *
+     * @param f State transition matrix.
+     * @param q Process noise covariance. Only the upper triangle is read.
+     * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency(), with at least
+     * MIN_CHUNKS_PER_WORKER chunks per worker.
+     */
+    void predict(const Matrix<NX,NX>& f, const Matrix<NX,NX>& q, const std::size_t num_threads = 0)
+    {
+        Internal::parallel_chunks(num_chunks(), num_workers(num_threads),
+            [this, &f, &q](const std::size_t, const std::size_t first, const std::size_t last) {
+                predict_chunks(f, q, first, last);
+            });
+    }
+
+    /**
+     * @brief Time update of the filters in chunks [first_chunk, last_chunk).
+     *
+     * @param f State transition matrix.
+     * @param q Process noise covariance. Only the upper triangle is read.
+     * @param first_chunk First chunk.
+     * @param last_chunk One past the last chunk.
+     */
+    void predict_chunks(const Matrix<NX,NX>& f, const Matrix<NX,NX>& q,
+        const std::size_t first_chunk, const std::size_t last_chunk) noexcept
+    {
+        assert(last_chunk <= num_chunks());
+
+        const double* const pf = f.data();
+        const double* const pq = q.data();
+
+        for (std::size_t chunk = first_chunk; chunk < last_chunk; chunk++)
+        {
+            const std::size_t base = chunk * LANES;
+
+            // x = F * x
+            std::array<Lanes, NX> x_new {};
+
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                for (std::size_t kk = 0; kk < NX; kk++)
+                {
+                    const double f_ik = pf[(ii * NX) + kk];
+                    const double* const x_k = m_x[kk].data() + base;
+
+                    for (std::size_t ll = 0; ll < LANES; ll++)
+                    {
+                        x_new[ii][ll] += f_ik * x_k[ll];
+                    }
+                }
+            }
+
+            // F * P
+            std::array<std::array<Lanes, NX>, NX> fp {};
+
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                for (std::size_t mm = 0; mm < NX; mm++)
+                {
+                    const double f_im = pf[(ii * NX) + mm];
+
+                    for (std::size_t kk = 0; kk < NX; kk++)
+                    {
+                        const double* const p_mk = m_p[p_index(mm, kk)].data() + base;
+
+                        for (std::size_t ll = 0; ll < LANES; ll++)
+                        {
+                            fp[ii][kk][ll] += f_im * p_mk[ll];
+                        }
+                    }
+                }
+            }
+
+            const std::uint8_t* const active = m_active.data() + base;
+
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                double* const x_i = m_x[ii].data() + base;
+
+                for (std::size_t ll = 0; ll < LANES; ll++)
+                {
+                    x_i[ll] = (active[ll] != 0) ? x_new[ii][ll] : x_i[ll];
+                }
+            }
+
+            // P = (F * P) * F^T + Q, upper triangle
+            for (std::size_t ii = 0; ii < NX; ii++)
+            {
+                for (std::size_t jj = ii; jj < NX; jj++)
+                {
+                    Lanes sum;
+                    sum.fill(pq[(ii * NX) + jj]);
+
+                    for (std::size_t kk = 0; kk < NX; kk++)
+                    {
+                        const double f_jk = pf[(jj * NX) + kk];
+
+                        for (std::size_t ll = 0; ll < LANES; ll++)
+                        {
+                            sum[ll] += fp[ii][kk][ll] * f_jk;
+                        }
+                    }
+
+                    double* const p_ij = m_p[p_index(ii, jj)].data() + base;
+
+                    for (std::size_t ll = 0; ll < LANES; ll++)
+                    {
+                        p_ij[ll] = (active[ll] != 0) ? sum[ll] : p_ij[ll];
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Measurement update of every active filter.
+     *
+     * @details A measurement containing NaN leaves its filter unchanged and reports `Gated`.
+     * Contiguous chunk ranges run on worker threads. Results do not depend on the thread count.
+     *
+     * @param z Measurement for each slot. Length num_slots().
+     * @param h Measurement matrix.
+     * @param r Measurement noise covariance. Only the upper triangle is read.
+     * @param status Result for each slot. Length num_slots(). Inactive slots are not written.
+     * @param gate NIS threshold. Measurements above it are rejected.
+     * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency(), with at least
+     * MIN_CHUNKS_PER_WORKER chunks per worker.
+     *
+     * @exception std::length_error Mismatched lengths.
+     */
+    void update(std::span<const Vector<NZ>> z, const Matrix<NZ,NX>& h, const Matrix<NZ,NZ>& r,
+        std::span<KalmanUpdateStatus> status, const double gate = KALMAN_NO_GATE,
+        const std::size_t num_threads = 0)
+    {
+        check_update_lengths(z, status);
+
+        Internal::parallel_chunks(num_chunks(), num_workers(num_threads),
+            [&](const std::size_t, const std::size_t first, const std::size_t last) {
+                for (std::size_t chunk = first; chunk < last; chunk++)
+                {
+                    update_chunk(z, h, r, status, chunk * LANES, gate);
+                }
+            });
+    }
+
+    /**
+     * @brief Measurement update of the filters in chunks [first_chunk, last_chunk).
+     *
+     * @param z Measurement for each slot. Length num_slots().
+     * @param h Measurement matrix.
+     * @param r Measurement noise covariance. Only the upper triangle is read.
+     * @param status Result for each slot. Length num_slots(). Inactive slots are not written.
+     * @param first_chunk First chunk.
+     * @param last_chunk One past the last chunk.
+     * @param gate NIS threshold. Measurements above it are rejected.
+     *
+     * @exception std::length_error Mismatched lengths.
+     */
+    void update_chunks(std::span<const Vector<NZ>> z, const Matrix<NZ,NX>& h,
+        const Matrix<NZ,NZ>& r, std::span<KalmanUpdateStatus> status,
+        const std::size_t first_chunk, const std::size_t last_chunk,
+        const double gate = KALMAN_NO_GATE)
+    {
+        check_update_lengths(z, status);
+
+        assert(last_chunk <= num_chunks());
+
+        for (std::size_t chunk = first_chunk; chunk < last_chunk; chunk++)
+        {
+            update_chunk(z, h, r, status, chunk * LANES, gate);
+        }
+    }
+
+private:
+    using Lanes = std::array<double, LANES>;
+
+    /**
+     * @brief Get the number of workers for a full-bank step.
+     *
+     * @param num_threads Requested threads. 0 picks from the number of chunks.
+     * @return Worker count.
+     */
+    [[nodiscard]] std::size_t num_workers(const std::size_t num_threads) const noexcept
+    {
+        return Internal::worker_count(num_threads, num_chunks(), MIN_CHUNKS_PER_WORKER);
+    }
+
+    /**
+     * @brief Check the per-slot measurement and status lengths.
+     *
+     * @param z Measurements.
+     * @param status Results.
+     *
+     * @exception std::length_error Mismatched lengths.
+     */
+    void check_update_lengths(std::span<const Vector<NZ>> z,
+        std::span<KalmanUpdateStatus> status) const
+    {
+        if (z.size() != m_num_slots)
+        {
+            throw std::length_error(Internal::mismatched_length_error_msg(z.size(), m_num_slots));
+        }
+
+        if (status.size() != m_num_slots)
+        {
+            throw std::length_error(
+                Internal::mismatched_length_error_msg(status.size(), m_num_slots)
+            );
+        }
+    }
+
+    /**
+     * @brief Packed storage index of covariance element (row, col), either triangle.
+     */
+    static constexpr std::size_t p_index(const std::size_t row, const std::size_t col) noexcept
+    {
+        return (row <= col) ? UpperTriangular<NX>::packed_index(row, col) :
+            UpperTriangular<NX>::packed_index(col, row);
+    }
+
+    void check_active(const std::size_t slot) const
+    {
+        if (!is_active(slot))
+        {
+            throw std::out_of_range(Internal::invalid_index_error_msg(slot, m_num_slots));
+        }
+    }
+
+    void reserve_storage(const std::size_t len)
+    {
+        for (auto& x_i : m_x)
+        {
+            x_i.resize(len, 0.0);
+        }
+
+        for (auto& p_ij : m_p)
+        {
+            p_ij.resize(len, 0.0);
+        }
+
+        m_active.resize(len, 0);
+    }
+
+    void set_state(const std::size_t slot, const Vector<NX>& x0, const Matrix<NX,NX>& p0)
+    {
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            m_x[ii][slot] = x0(ii);
+
+            for (std::size_t jj = ii; jj < NX; jj++)
+            {
+                m_p[p_index(ii, jj)][slot] = p0(ii, jj);
+            }
+        }
+    }
+
+    /**
+     * @brief Update the `LANES` slots starting at `base`. Mirrors KalmanFilter::update() per lane.
+     */
+    void update_chunk(std::span<const Vector<NZ>> z, const Matrix<NZ,NX>& h,
+        const Matrix<NZ,NZ>& r, std::span<KalmanUpdateStatus> status, const std::size_t base,
+        const double gate) noexcept
+    {
+        const double* const ph = h.data();
+        const double* const pr = r.data();
+        const std::size_t num_valid = std::min(LANES, m_num_slots - base);
+
+        // y = z - H * x, summing H * x first as mul_into() does
+        std::array<Lanes, NZ> y {};
+
+        for (std::size_t mm = 0; mm < NZ; mm++)
+        {
+            Lanes hx {};
+
+            for (std::size_t kk = 0; kk < NX; kk++)
+            {
+                const double h_mk = ph[(mm * NX) + kk];
+                const double* const x_k = m_x[kk].data() + base;
+
+                for (std::size_t ll = 0; ll < LANES; ll++)
+                {
+                    hx[ll] += h_mk * x_k[ll];
+                }
+            }
+
+            for (std::size_t ll = 0; ll < num_valid; ll++)
+            {
+                y[mm][ll] = z[base + ll](mm) - hx[ll];
+            }
+        }
+
+        // P * H^T
+        std::array<std::array<Lanes, NZ>, NX> pht {};
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            for (std::size_t kk = 0; kk < NX; kk++)
+            {
+                const double* const p_ik = m_p[p_index(ii, kk)].data() + base;
+
+                for (std::size_t mm = 0; mm < NZ; mm++)
+                {
+                    const double h_mk = ph[(mm * NX) + kk];
+
+                    for (std::size_t ll = 0; ll < LANES; ll++)
+                    {
+                        pht[ii][mm][ll] += p_ik[ll] * h_mk;
+                    }
+                }
+            }
+        }
+
+        // S = H * P * H^T + R, full since it is small
+        std::array<std::array<Lanes, NZ>, NZ> s {};
+
+        for (std::size_t mm = 0; mm < NZ; mm++)
+        {
+            for (std::size_t nn = mm; nn < NZ; nn++)
+            {
+                s[mm][nn].fill(pr[(mm * NZ) + nn]);
+
+                for (std::size_t kk = 0; kk < NX; kk++)
+                {
+                    const double h_mk = ph[(mm * NX) + kk];
+
+                    for (std::size_t ll = 0; ll < LANES; ll++)
+                    {
+                        s[mm][nn][ll] += h_mk * pht[kk][nn][ll];
+                    }
+                }
+
+                s[nn][mm] = s[mm][nn];
+            }
+        }
+
+        // Cholesky factor of S in every lane. Failed lanes get a unit pivot so the math stays finite.
+        std::array<std::array<Lanes, NZ>, NZ> chol {};
+        Lanes pos_def;
+        pos_def.fill(1.0);
+
+        for (std::size_t jj = 0; jj < NZ; jj++)
+        {
+            for (std::size_t ll = 0; ll < LANES; ll++)
+            {
+                double diag = s[jj][jj][ll];
+
+                for (std::size_t kk = 0; kk < jj; kk++)
+                {
+                    diag -= chol[jj][kk][ll] * chol[jj][kk][ll];
+                }
+
+                const bool ok = diag > 0.0;
+                pos_def[ll] = ok ? pos_def[ll] : 0.0;
+                chol[jj][jj][ll] = std::sqrt(ok ? diag : 1.0);
+            }
+
+            for (std::size_t ii = jj + 1; ii < NZ; ii++)
+            {
+                for (std::size_t ll = 0; ll < LANES; ll++)
+                {
+                    double sum = s[jj][ii][ll];
+
+                    for (std::size_t kk = 0; kk < jj; kk++)
+                    {
+                        sum -= chol[ii][kk][ll] * chol[jj][kk][ll];
+                    }
+
+                    chol[ii][jj][ll] = sum / chol[jj][jj][ll];
+                }
+            }
+        }
+
+        // NIS = |L^-1 * y|^2
+        const std::array<Lanes, NZ> w = forward_substitute_lanes(chol, y);
+        Lanes nis {};
+
+        for (std::size_t mm = 0; mm < NZ; mm++)
+        {
+            for (std::size_t ll = 0; ll < LANES; ll++)
+            {
+                nis[ll] += w[mm][ll] * w[mm][ll];
+            }
+        }
+
+        const std::uint8_t* const active = m_active.data() + base;
+        std::array<bool, LANES> accept {};
+
+        for (std::size_t ll = 0; ll < LANES; ll++)
+        {
+            accept[ll] = (active[ll] != 0) && (pos_def[ll] > 0.0) && (nis[ll] <= gate);
+        }
+
+        for (std::size_t ll = 0; ll < num_valid; ll++)
+        {
+            if (active[ll] != 0)
+            {
+                status[base + ll] = accept[ll] ? KalmanUpdateStatus::Accepted :
+                    ((pos_def[ll] > 0.0) ? KalmanUpdateStatus::Gated :
+                    KalmanUpdateStatus::NotPositiveDefinite);
+            }
+        }
+
+        // K = P * H^T * S^-1, one state row at a time
+        std::array<std::array<Lanes, NZ>, NX> k {};
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            k[ii] = back_substitute_transposed_lanes(chol, forward_substitute_lanes(chol, pht[ii]));
+        }
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            Lanes dx {};
+
+            for (std::size_t mm = 0; mm < NZ; mm++)
+            {
+                for (std::size_t ll = 0; ll < LANES; ll++)
+                {
+                    dx[ll] += k[ii][mm][ll] * y[mm][ll];
+                }
+            }
+
+            double* const x_i = m_x[ii].data() + base;
+
+            for (std::size_t ll = 0; ll < LANES; ll++)
+            {
+                x_i[ll] = accept[ll] ? (x_i[ll] + dx[ll]) : x_i[ll];
+            }
+        }
+
+        // same operation order as KalmanFilter, so the bank and a single filter agree
+        if (m_cov_update == KalmanCovarianceUpdate::Joseph)
+        {
+            update_covariance_joseph(h, r, k, accept, base);
+            return;
+        }
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            for (std::size_t jj = ii; jj < NX; jj++)
+            {
+                Lanes sum {};
+
+                for (std::size_t mm = 0; mm < NZ; mm++)
+                {
+                    for (std::size_t ll = 0; ll < LANES; ll++)
+                    {
+                        sum[ll] += k[ii][mm][ll] * pht[jj][mm][ll];
+                    }
+                }
+
+                double* const p_ij = m_p[p_index(ii, jj)].data() + base;
+
+                for (std::size_t ll = 0; ll < LANES; ll++)
+                {
+                    p_ij[ll] = accept[ll] ? (p_ij[ll] - sum[ll]) : p_ij[ll];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Joseph covariance update of the `LANES` slots starting at `base`,
+     * A * P * A^T + K * R * K^T with A = I - K * H. Mirrors KalmanFilter per lane.
+     */
+    void update_covariance_joseph(const Matrix<NZ,NX>& h, const Matrix<NZ,NZ>& r,
+        const std::array<std::array<Lanes, NZ>, NX>& k, const std::array<bool, LANES>& accept,
+        const std::size_t base) noexcept
+    {
+        const double* const ph = h.data();
+        const double* const pr = r.data();
+
+        // A = I - K * H
+        std::array<std::array<Lanes, NX>, NX> a {};
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            for (std::size_t jj = 0; jj < NX; jj++)
+            {
+                a[ii][jj].fill((ii == jj) ? 1.0 : 0.0);
+
+                for (std::size_t mm = 0; mm < NZ; mm++)
+                {
+                    const double h_mj = ph[(mm * NX) + jj];
+
+                    for (std::size_t ll = 0; ll < LANES; ll++)
+                    {
+                        a[ii][jj][ll] -= k[ii][mm][ll] * h_mj;
+                    }
+                }
+            }
+        }
+
+        // A * P
+        std::array<std::array<Lanes, NX>, NX> ap {};
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            for (std::size_t jj = 0; jj < NX; jj++)
+            {
+                for (std::size_t kk = 0; kk < NX; kk++)
+                {
+                    const double* const p_kj = m_p[p_index(kk, jj)].data() + base;
+
+                    for (std::size_t ll = 0; ll < LANES; ll++)
+                    {
+                        ap[ii][jj][ll] += a[ii][kk][ll] * p_kj[ll];
+                    }
+                }
+            }
+        }
+
+        // K * R, reading R from its upper triangle
+        std::array<std::array<Lanes, NZ>, NX> kr {};
+
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            for (std::size_t nn = 0; nn < NZ; nn++)
+            {
+                for (std::size_t mm = 0; mm < NZ; mm++)
+                {
+                    const double r_mn = (mm <= nn) ? pr[(mm * NZ) + nn] : pr[(nn * NZ) + mm];
+
+                    for (std::size_t ll = 0; ll < LANES; ll++)
+                    {
+                        kr[ii][nn][ll] += k[ii][mm][ll] * r_mn;
+                    }
+                }
+            }
+        }
+
+        // (A * P) * A^T + (K * R) * K^T
+        for (std::size_t ii = 0; ii < NX; ii++)
+        {
+            for (std::size_t jj = ii; jj < NX; jj++)
+            {
+                Lanes sum {};
+
+                for (std::size_t kk = 0; kk < NX; kk++)
+                {
+                    for (std::size_t ll = 0; ll < LANES; ll++)
+                    {
+                        sum[ll] += ap[ii][kk][ll] * a[jj][kk][ll];
+                    }
+                }
+
+                for (std::size_t mm = 0; mm < NZ; mm++)
+                {
+                    for (std::size_t ll = 0; ll < LANES; ll++)
+                    {
+                        sum[ll] += kr[ii][mm][ll] * k[jj][mm][ll];
+                    }
+                }
+
+                double* const p_ij = m_p[p_index(ii, jj)].data() + base;
+
+                for (std::size_t ll = 0; ll < LANES; ll++)
+                {
+                    p_ij[ll] = accept[ll] ? sum[ll] : p_ij[ll];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Solve L * y = b in every lane.
+     */
+    static std::array<Lanes, NZ> forward_substitute_lanes(
+        const std::array<std::array<Lanes, NZ>, NZ>& chol, const std::array<Lanes, NZ>& b) noexcept
+    {
+        std::array<Lanes, NZ> y(b);
+
+        for (std::size_t ii = 0; ii < NZ; ii++)
+        {
+            for (std::size_t kk = 0; kk < ii; kk++)
+            {
+                for (std::size_t ll = 0; ll < LANES; ll++)
+                {
+                    y[ii][ll] -= chol[ii][kk][ll] * y[kk][ll];
+                }
+            }
+
+            for (std::size_t ll = 0; ll < LANES; ll++)
+            {
+                y[ii][ll] /= chol[ii][ii][ll];
+            }
+        }
+
+        return y;
+    }
+
+    /**
+     * @brief Solve L^T * x = y in every lane.
+     */
+    static std::array<Lanes, NZ> back_substitute_transposed_lanes(
+        const std::array<std::array<Lanes, NZ>, NZ>& chol, const std::array<Lanes, NZ>& y) noexcept
+    {
+        std::array<Lanes, NZ> x(y);
+
+        for (std::size_t ii = NZ; ii-- > 0;)
+        {
+            for (std::size_t kk = ii + 1; kk < NZ; kk++)
+            {
+                for (std::size_t ll = 0; ll < LANES; ll++)
+                {
+                    x[ii][ll] -= chol[kk][ii][ll] * x[kk][ll];
+                }
+            }
+
+            for (std::size_t ll = 0; ll < LANES; ll++)
+            {
+                x[ii][ll] /= chol[ii][ii][ll];
+            }
+        }
+
+        return x;
+    }
+
+    static constexpr std::size_t num_p = UpperTriangular<NX>::num_stored;  ///< Stored covariance elements.
+
+    std::array<std::vector<double>, NX> m_x;  ///< State element i of every slot.
+    std::array<std::vector<double>, num_p> m_p;  ///< Packed upper covariance element of every slot.
+    std::vector<std::uint8_t> m_active;  ///< Nonzero for active slots. Padded to a multiple of LANES.
+    std::vector<std::size_t> m_free;  ///< Removed slots available for reuse.
+    std::size_t m_num_slots = 0;  ///< Slots handed out so far.
+    KalmanCovarianceUpdate m_cov_update = KalmanCovarianceUpdate::Joseph;  ///< Covariance update.
+};
+
+}  // namespace MathUtils
@@ -0,0 +1,113 @@
+/**
+ * @file camera_projection.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Batch projection of ECEF points into a pinhole camera.
+ */
+
+#pragma once
+
+#include "Attitude/Quaternion.h"
+#include "LinAlg/Vector.h"
+#include "LinAlg/Vector3Batch.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace MathUtils {
+
+/**
+ * @brief Pinhole camera intrinsics with Brown-Conrady lens distortion.
+ *
+ * @details Camera frame is +z along the boresight, +x toward increasing pixel columns, and +y
+ * toward increasing pixel rows. Distortion coefficients of zero give an ideal pinhole.
+ *
+ * @ref https://docs.opencv.org/4.x/d9/d0c/group__calib3d.html
+ */
+struct PinholeCamera {
+    double fx;  ///< Focal length along columns [px].
+    double fy;  ///< Focal length along rows [px].
+    double cx;  ///< Principal point column [px].
+    double cy;  ///< Principal point row [px].
+    double width;  ///< Image width [px].
+    double height;  ///< Image height [px].
+    double k1 = 0.0;  ///< Radial distortion, r^2 term.
+    double k2 = 0.0;  ///< Radial distortion, r^4 term.
+    double p1 = 0.0;  ///< Tangential distortion.
+    double p2 = 0.0;  ///< Tangential distortion.
+    double near_m = 0.0;  ///< Points at or closer than this depth are culled [m].
+};
+
+/**
+ * @brief Project ECEF points into a camera, with frustum culling in the same pass.
+ *
+ * @details The camera-to-ECEF DCM is built once from `q_ecef_cam` with quaternion_to_dcm and
+ * applied transposed. Each point is then translated, rotated into the camera frame, divided by
+ * depth, distorted, and scaled to pixels, and its visibility flag is set from the depth and image
+ * bounds, all without branches. Pixels of points behind the near plane are NaN. Pixels of points
+ * in front of the camera but outside the image are still written so callers can pad the frustum.
+ *
+ * A radial distortion with a negative term folds back at wide angles, mapping points far outside
+ * the field of view into the image. Points beyond the radius where the radial polynomial stops
+ * increasing are therefore never visible, whatever pixel they distort to.
+ *
+ * Large point sets are split into contiguous chunks on worker threads, and the per-chunk visible
+ * counts are added once all workers finish.
+ *
+ * @param camera Camera intrinsics.
+ * @param cam_pos_ecef_m Camera position in ECEF [m].
+ * @param q_ecef_cam Unit quaternion rotating camera-frame vectors into ECEF.
+ * @param x_ecef_m Point ECEF x components [m].
+ * @param y_ecef_m Point ECEF y components [m].
+ * @param z_ecef_m Point ECEF z components [m].
+ * @param u_px Output pixel columns [px].
+ * @param v_px Output pixel rows [px].
+ * @param visible Output flags, 1 if the point is in front of the near plane, inside the monotonic
+ * range of the distortion, and inside the image.
+ * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency(), with at least
+ * 16384 points per worker.
+ * @return Number of visible points.
+ *
+ * @exception std::length_error Any input or output length differs from `x_ecef_m`.
+ */
+std::size_t project_points(const PinholeCamera& camera,
+    const Vector<3>& cam_pos_ecef_m,
+    const Quaternion& q_ecef_cam,
+    std::span<const double> x_ecef_m,
+    std::span<const double> y_ecef_m,
+    std::span<const double> z_ecef_m,
+    std::span<double> u_px,
+    std::span<double> v_px,
+    std::span<std::uint8_t> visible,
+    const std::size_t num_threads = 0);
+
+/**
+ * @brief Project a batch of ECEF points into a camera.
+ *
+ * @param camera Camera intrinsics.
+ * @param cam_pos_ecef_m Camera position in ECEF [m].
+ * @param q_ecef_cam Unit quaternion rotating camera-frame vectors into ECEF.
+ * @param points_ecef_m Points in ECEF [m].
+ * @param u_px Output pixel columns [px].
+ * @param v_px Output pixel rows [px].
+ * @param visible Output visibility flags.
+ * @param num_threads Worker threads. 0 picks from the number of points.
+ * @return Number of visible points.
+ *
+ * @exception std::length_error Any output length differs from `points_ecef_m`.
+ *
+ * @see project_points(const PinholeCamera&, const Vector<3>&, const Quaternion&,
+ * std::span<const double>, std::span<const double>, std::span<const double>, std::span<double>,
+ * std::span<double>, std::span<std::uint8_t>, const std::size_t)
+ */
+std::size_t project_points(const PinholeCamera& camera,
+    const Vector<3>& cam_pos_ecef_m,
+    const Quaternion& q_ecef_cam,
+    const Vector3Batch& points_ecef_m,
+    std::span<double> u_px,
+    std::span<double> v_px,
+    std::span<std::uint8_t> visible,
+    const std::size_t num_threads = 0);
+
+}  // namespace MathUtils
@@ -9,6 +9,8 @@
 #include "Geodesy/GeoCoord.h"
 #include "LinAlg/Vector.h"
 
+#include <span>
+
 namespace MathUtils {
 
 /**
@@ -24,4 +26,18 @@ namespace MathUtils {
  */
 GeoCoord ecef_to_lla(const Vector<3>& pos_ecef_m);
 
+/**
+ * @brief Convert a chunk of earth-centered, earth-fixed positions to geodetic latitude,
+ * longitude, and altitude.
+ *
+ * @details Writes into caller-owned storage, so a streaming caller can reuse the same fixed-size
+ * buffers for every chunk without allocating or copying.
+ *
+ * @param pos_ecef_m ECEF positions in [m].
+ * @param lla Output geodetic LLA in [rad] and [m]. Must be the same length as `pos_ecef_m`.
+ *
+ * @exception std::length_error Input and output lengths differ.
+ */
+void ecef_to_lla(std::span<const Vector<3>> pos_ecef_m, std::span<GeoCoord> lla);
+
 }  // namespace MathUtils
@@ -0,0 +1,111 @@
+/**
+ * @file gnss_position.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief GNSS single-point positioning from pseudoranges.
+ */
+
+#pragma once
+
+#include "Geodesy/GeoCoord.h"
+#include "LinAlg/Vector.h"
+
+#include <cstddef>
+#include <span>
+
+namespace MathUtils {
+
+/**
+ * @brief Dilution of precision of a position fix.
+ *
+ * @details Horizontal and vertical values are in the local east-north-up frame at the solution.
+ * NaN when the satellite geometry is singular.
+ */
+struct GnssDop {
+    double gdop;  ///< Geometric DOP.
+    double pdop;  ///< Position DOP.
+    double hdop;  ///< Horizontal DOP.
+    double vdop;  ///< Vertical DOP.
+    double tdop;  ///< Time DOP.
+};
+
+/**
+ * @brief Single-point position fix.
+ */
+struct GnssSolution {
+    Vector<3> position_ecef_m;  ///< Receiver ECEF position [m].
+    GeoCoord position_lla;  ///< Receiver geodetic latitude [rad], longitude [rad], altitude [m].
+    double clock_bias_m;  ///< Receiver clock bias times the speed of light [m].
+    GnssDop dop;  ///< Dilution of precision at the solution.
+    std::size_t iterations;  ///< Gauss-Newton iterations taken.
+    bool converged;  ///< True if the step fell below the tolerance before the iteration limit.
+};
+
+/**
+ * @brief Options for the single-point solver.
+ */
+struct GnssSolverOptions {
+    std::size_t max_iterations = 20;  ///< Maximum Gauss-Newton iterations.
+    double step_tolerance_m = 1e-4;  ///< Stop when the position and clock step norm is below this [m].
+};
+
+/**
+ * @brief Observations of one epoch for the batched solver.
+ */
+struct GnssEpoch {
+    std::span<const Vector<3>> sat_pos_ecef_m;  ///< Satellite ECEF positions at transmit time [m].
+    std::span<const double> pseudorange_m;  ///< Corrected pseudoranges [m].
+};
+
+/**
+ * @brief Solve for receiver position and clock bias from four or more pseudoranges.
+ *
+ * @details Gauss-Newton on the model rho_i = |s_i - p| + b. The 4x4 normal equations are
+ * accumulated directly from the line-of-sight vectors and solved by Cholesky, so each iteration
+ * touches every satellite once and nothing is allocated. Satellite clock, ionosphere, troposphere,
+ * and earth-rotation corrections are the caller's responsibility.
+ *
+ * This does not go through least_squares(), because that fixes the residual count at compile time
+ * and the number of satellites in view is only known at run time. Accumulating J^T * J directly
+ * also keeps the cost independent of a maximum satellite count.
+ *
+ * A singular geometry (e.g. coincident satellites), or an estimate that lands exactly on a
+ * satellite position, returns `converged == false` with NaN DOP.
+ *
+ * @param sat_pos_ecef_m Satellite ECEF positions [m].
+ * @param pseudorange_m Pseudoranges [m]. Must be the same length as `sat_pos_ecef_m`.
+ * @param initial_ecef_m Initial position guess [m]. The earth's center works for any fix.
+ * @param options Solver options.
+ * @return Position fix.
+ *
+ * @exception std::length_error Mismatched lengths or fewer than four satellites.
+ *
+ * @ref https://en.wikipedia.org/wiki/GNSS_positioning_calculation
+ * @ref https://en.wikipedia.org/wiki/Dilution_of_precision_(navigation)
+ */
+[[nodiscard]] GnssSolution solve_gnss_position(std::span<const Vector<3>> sat_pos_ecef_m,
+    std::span<const double> pseudorange_m,
+    const Vector<3>& initial_ecef_m = Vector<3>{},
+    const GnssSolverOptions& options = GnssSolverOptions{});
+
+/**
+ * @brief Solve many epochs into caller-owned storage.
+ *
+ * @details The epochs are split into contiguous chunks, one per worker thread. Within a chunk,
+ * each epoch is seeded with the previous converged solution, so a time-ordered recording converges
+ * in one or two iterations per epoch. The first epoch of each chunk starts from the earth's
+ * center, so unconverged fixes and iteration counts can change with the thread count.
+ *
+ * @param epochs Observations of each epoch.
+ * @param solutions Output position fixes. Must be the same length as `epochs`.
+ * @param options Solver options.
+ * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency().
+ *
+ * @exception std::length_error Mismatched lengths or an epoch with fewer than four satellites.
+ */
+void solve_gnss_position(std::span<const GnssEpoch> epochs,
+    std::span<GnssSolution> solutions,
+    const GnssSolverOptions& options = GnssSolverOptions{},
+    const std::size_t num_threads = 0);
+
+}  // namespace MathUtils
@@ -9,6 +9,9 @@
 #include "Geodesy/GeoCoord.h"
 #include "LinAlg/Vector.h"
 
+#include <cstddef>
+#include <span>
+
 namespace MathUtils {
 
 /**
@@ -22,4 +25,33 @@ namespace MathUtils {
  */
 Vector<3> lla_to_ecef(const GeoCoord& lla);
 
+/**
+ * @brief Convert a regular latitude/longitude grid to ECEF positions.
+ *
+ * @details Same equation as lla_to_ecef(const GeoCoord&), but separable: latitude terms are
+ * computed once per row and longitude sin/cos once per column, so each grid point costs only
+ * multiply-adds. Outputs are row-major with one row per latitude, stored as separate x, y, and
+ * z arrays (e.g. the components of a Vector3Batch).
+ *
+ * Rows are split into contiguous ranges on worker threads, which all share the column trig.
+ *
+ * @param lat_rad Latitude of each row [rad].
+ * @param lon_rad Longitude of each column [rad].
+ * @param altitude_m Row-major altitudes [m], length rows * cols. Empty for the ellipsoid surface.
+ * @param x_m Output ECEF x [m], length rows * cols.
+ * @param y_m Output ECEF y [m], length rows * cols.
+ * @param z_m Output ECEF z [m], length rows * cols.
+ * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency(), with at least
+ * 16384 grid points per worker.
+ *
+ * @exception std::length_error Altitude or output length is not rows * cols.
+ */
+void lla_to_ecef_grid(std::span<const double> lat_rad,
+    std::span<const double> lon_rad,
+    std::span<const double> altitude_m,
+    std::span<double> x_m,
+    std::span<double> y_m,
+    std::span<double> z_m,
+    const std::size_t num_threads = 0);
+
 }  // namespace MathUtils
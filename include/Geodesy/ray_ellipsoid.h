@@ -0,0 +1,80 @@
+/**
+ * @file ray_ellipsoid.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Ray intersection with the WGS84 ellipsoid, and pixel geolocation.
+ */
+
+#pragma once
+
+#include "Attitude/Quaternion.h"
+#include "Geodesy/GeoCoord.h"
+#include "LinAlg/Vector.h"
+#include "LinAlg/Vector3Batch.h"
+
+#include <span>
+
+namespace MathUtils {
+
+/**
+ * @brief Distance along a ray to the WGS84 ellipsoid.
+ *
+ * @details Closed form: the ellipsoid is scaled to a unit sphere and the nearer root of the
+ * resulting quadratic is taken. A height offset grows both semi-axes by `height_m`, which is
+ * within centimeters of a constant-height surface for terrain-scale offsets. The ray origin
+ * must be outside the surface.
+ *
+ * Rays that miss (past the horizon or pointing away) give NaN. The miss test is a select rather
+ * than a branch, so batches of rays run without mispredictions.
+ *
+ * @param origin_ecef_m Ray origin in ECEF [m].
+ * @param dir_ecef Ray direction in ECEF. Need not be unit length.
+ * @param height_m Height of the surface above the ellipsoid [m].
+ * @return Distance to the first intersection, in multiples of `dir_ecef`'s length. NaN on a miss.
+ *
+ * @ref https://en.wikipedia.org/wiki/Line%E2%80%93sphere_intersection
+ */
+[[nodiscard]] double ray_ellipsoid_range(const Vector<3>& origin_ecef_m,
+    const Vector<3>& dir_ecef,
+    const double height_m = 0.0) noexcept;
+
+/**
+ * @brief Distance along many rays from one origin to the WGS84 ellipsoid.
+ *
+ * @param origin_ecef_m Ray origin in ECEF [m].
+ * @param dir_ecef Ray directions in ECEF.
+ * @param range Output distances, in multiples of each direction's length. NaN on a miss. Must be
+ * the same length as `dir_ecef`.
+ * @param height_m Height of the surface above the ellipsoid [m].
+ *
+ * @exception std::length_error Mismatched lengths.
+ *
+ * @see ray_ellipsoid_range(const Vector<3>&, const Vector<3>&, double)
+ */
+void ray_ellipsoid_range(const Vector<3>& origin_ecef_m,
+    const Vector3Batch& dir_ecef,
+    std::span<double> range,
+    const double height_m = 0.0);
+
+/**
+ * @brief Geolocate camera rays on the WGS84 ellipsoid.
+ *
+ * @details The camera-to-ECEF DCM is built once from `q_ecef_cam`. Each ray is then rotated,
+ * intersected, and converted with ecef_to_lla in a single pass without temporaries. Missed rays
+ * give a GeoCoord with NaN latitude, longitude, and altitude.
+ *
+ * @param cam_pos_ecef_m Camera position in ECEF [m].
+ * @param q_ecef_cam Unit quaternion rotating camera-frame vectors into ECEF.
+ * @param rays_cam Pixel view rays in the camera frame.
+ * @param ground Output ground points. Must be the same length as `rays_cam`.
+ * @param height_m Height of the surface above the ellipsoid [m].
+ *
+ * @exception std::length_error Mismatched lengths.
+ */
+void geolocate_rays(const Vector<3>& cam_pos_ecef_m,
+    const Quaternion& q_ecef_cam,
+    const Vector3Batch& rays_cam,
+    std::span<GeoCoord> ground,
+    const double height_m = 0.0);
+
+}  // namespace MathUtils
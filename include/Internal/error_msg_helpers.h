@@ -75,6 +75,112 @@ inline std::string invalid_init_list_length_error_msg(const std::size_t input_ro
         std::string(").");
 }
 
+/**
+ * @brief Helper for printing mismatched length error messages.
+ *
+ * @details For batch functions whose input and output ranges must be the same length.
+ *
+ * @param input_len Input range length.
+ * @param output_len Output range length.
+ * @return Error message.
+ */
+inline std::string mismatched_length_error_msg(const std::size_t input_len,
+    const std::size_t output_len)
+{
+    return std::string("Input length ") +
+        std::to_string(input_len) +
+        std::string(" does not match output length ") +
+        std::to_string(output_len) +
+        std::string(".");
+}
+
+/**
+ * @brief Helper for printing operator dimension mismatch error messages.
+ *
+ * @details For vectors passed to a matrix or linear operator whose size is set at run time.
+ *
+ * @param input_len Vector length.
+ * @param expected_len Matching operator dimension, rows or columns.
+ * @return Error message.
+ *
+ * @see MathUtils::SparseMatrix
+ * @see MathUtils::DynamicMatrix
+ */
+inline std::string mismatched_dimension_error_msg(const std::size_t input_len,
+    const std::size_t expected_len)
+{
+    return std::string("Vector length ") +
+        std::to_string(input_len) +
+        std::string(" does not match operator dimension ") +
+        std::to_string(expected_len) +
+        std::string(".");
+}
+
+/**
+ * @brief Helper for printing non-square operator error messages.
+ *
+ * @param rows Operator rows.
+ * @param cols Operator columns.
+ * @return Error message.
+ */
+inline std::string non_square_error_msg(const std::size_t rows, const std::size_t cols)
+{
+    return std::string("Expected a square operator, got ") +
+        std::string("(") +
+        std::to_string(rows) +
+        std::string(",") +
+        std::to_string(cols) +
+        std::string(").");
+}
+
+/**
+ * @brief Helper for printing too-short input error messages.
+ *
+ * @details For solvers that need a minimum number of observations.
+ *
+ * @param input_len Input range length.
+ * @param min_len Minimum required length.
+ * @return Error message.
+ */
+inline std::string insufficient_length_error_msg(const std::size_t input_len,
+    const std::size_t min_len)
+{
+    return std::string("Input length ") +
+        std::to_string(input_len) +
+        std::string(" is less than required length ") +
+        std::to_string(min_len) +
+        std::string(".");
+}
+
+/**
+ * @brief Helper for printing grid sample count error messages.
+ *
+ * @details For row-major grids passed as a flat range, such as DEM tiles.
+ *
+ * @param input_len Input range length.
+ * @param rows Grid rows.
+ * @param cols Grid columns.
+ * @return Error message.
+ *
+ * @see MathUtils::DemTile
+ */
+inline std::string invalid_grid_size_error_msg(const std::size_t input_len,
+    const std::size_t rows,
+    const std::size_t cols)
+{
+    return std::string("Grid of ") +
+        std::string("(") +
+        std::to_string(rows) +
+        std::string(",") +
+        std::to_string(cols) +
+        std::string(")") +
+        std::string(" needs ") +
+        std::to_string(rows * cols) +
+        std::string(" samples, got ") +
+        std::to_string(input_len) +
+        std::string(".");
+}
+
 /**
  * @brief Helper for printing invalid index error messages.
  *
@@ -0,0 +1,96 @@
+/**
+ * @file parallel_chunks.h
+ * @author Michael Wrona
+ * @date 2026-10-19
+ * @brief Split an index range into contiguous chunks on worker threads.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace MathUtils {
+namespace Internal {
+
+/**
+ * @brief Get the number of workers for a batch.
+ *
+ * @param num_threads Requested worker threads. 0 uses std::thread::hardware_concurrency().
+ * @param num_items Number of items in the batch.
+ * @param min_items_per_worker Fewest items per worker when `num_threads` is 0, so cheap items are
+ * not spread thinner than the cost of starting a thread.
+ * @return Worker count in [1, max(num_items, 1)].
+ */
+[[nodiscard]] inline std::size_t worker_count(const std::size_t num_threads,
+    const std::size_t num_items,
+    const std::size_t min_items_per_worker = 1) noexcept
+{
+    const std::size_t hardware = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    const std::size_t requested = (num_threads == 0) ?
+        std::min(hardware, num_items / std::max<std::size_t>(min_items_per_worker, 1)) :
+        num_threads;
+
+    return std::max<std::size_t>(std::min(requested, num_items), 1);
+}
+
+/**
+ * @brief Run `fn(worker, first, last)` over contiguous chunks of [0, num_items).
+ *
+ * @details Chunk `ww` is [ww * n / W, (ww + 1) * n / W), so the split depends only on the item and
+ * worker counts. One worker runs inline on the calling thread; otherwise each chunk runs on its own
+ * std::jthread. If a chunk throws, the other chunks still finish and the exception from the lowest
+ * chunk is rethrown after all workers join.
+ *
+ * @tparam Fn Callable as `fn(std::size_t worker, std::size_t first, std::size_t last)`.
+ * @param num_items Number of items.
+ * @param num_workers Number of chunks, from worker_count().
+ * @param fn Chunk function. Called concurrently, so it must only write disjoint data.
+ */
+template<typename Fn>
+void parallel_chunks(const std::size_t num_items, const std::size_t num_workers, Fn&& fn)
+{
+    if (num_workers <= 1)
+    {
+        fn(std::size_t{0}, std::size_t{0}, num_items);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(num_workers);
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(num_workers);
+
+        for (std::size_t ww = 0; ww < num_workers; ww++)
+        {
+            const std::size_t first = (ww * num_items) / num_workers;
+            const std::size_t last = ((ww + 1) * num_items) / num_workers;
+
+            workers.emplace_back([&fn, &errors, ww, first, last]() {
+                try
+                {
+                    fn(ww, first, last);
+                }
+                catch (...)
+                {
+                    errors[ww] = std::current_exception();
+                }
+            });
+        }
+    }
+
+    for (const std::exception_ptr& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // namespace Internal
+}  // namespace MathUtils
@@ -0,0 +1,122 @@
+/**
+ * @file DynamicMatrix.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Dense matrix with dimensions chosen at runtime.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace MathUtils {
+
+/**
+ * @brief Dense, heap-allocated matrix sized at runtime.
+ *
+ * @details Stores elements in row-major order. All elements are zero at initialization. Use
+ * MathUtils::Matrix when the dimensions are known at compile time.
+ */
+class DynamicMatrix {
+public:
+    DynamicMatrix() = default;
+
+    ~DynamicMatrix() = default;
+
+    /**
+     * @brief Create a zero matrix.
+     *
+     * @param rows Number of rows.
+     * @param cols Number of columns.
+     */
+    DynamicMatrix(const std::size_t rows, const std::size_t cols);
+
+    DynamicMatrix(const DynamicMatrix& other) = default;
+
+    DynamicMatrix(DynamicMatrix&& other) noexcept = default;
+
+    DynamicMatrix& operator=(const DynamicMatrix& other) = default;
+
+    DynamicMatrix& operator=(DynamicMatrix&& other) noexcept = default;
+
+    /**
+     * @brief Access matrix element.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Matrix element at specified index.
+     *
+     * @exception std::out_of_range Invalid matrix index.
+     */
+    [[nodiscard]] double& operator()(const std::size_t row, const std::size_t col);
+
+    /**
+     * @brief Get matrix element.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Matrix element at specified index.
+     *
+     * @exception std::out_of_range Invalid matrix index.
+     */
+    [[nodiscard]] const double& operator()(const std::size_t row, const std::size_t col) const;
+
+    /**
+     * @brief Access the underlying contiguous element storage (row-major).
+     *
+     * @return Pointer to the first element.
+     */
+    [[nodiscard]] double* data() noexcept
+    {
+        return m_arr.data();
+    }
+
+    /**
+     * @brief Get the underlying contiguous element storage (row-major).
+     *
+     * @return Pointer to the first element.
+     */
+    [[nodiscard]] const double* data() const noexcept
+    {
+        return m_arr.data();
+    }
+
+    /**
+     * @brief Get the number of rows in the matrix.
+     *
+     * @return Matrix rows.
+     */
+    [[nodiscard]] std::size_t rows() const noexcept
+    {
+        return m_rows;
+    }
+
+    /**
+     * @brief Get the number of columns in the matrix.
+     *
+     * @return Matrix columns.
+     */
+    [[nodiscard]] std::size_t cols() const noexcept
+    {
+        return m_cols;
+    }
+
+    /**
+     * @brief Matrix-vector product, y = A * x.
+     *
+     * @param x Input. Length cols().
+     * @param y Output. Length rows(). Must not alias `x`.
+     *
+     * @exception std::length_error Mismatched lengths.
+     */
+    void multiply(std::span<const double> x, std::span<double> y) const;
+
+private:
+    std::size_t m_rows = 0;  ///< Number of rows.
+    std::size_t m_cols = 0;  ///< Number of columns.
+    std::vector<double> m_arr;  ///< Elements in row-major order.
+};
+
+}  // namespace MathUtils
@@ -7,6 +7,9 @@
 #pragma once
 
 #include "Internal/error_msg_helpers.h"
+#include "Internal/parallel_chunks.h"
+#include "LinAlg/ScratchArena.h"
+#include "LinAlg/summation.h"
 #include "LinAlg/Vector.h"
 
 #include <algorithm>
@@ -20,6 +23,7 @@
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace MathUtils {
 
@@ -45,6 +49,10 @@ concept valid_matrix_element = std::integral<T> || std::floating_point<T>;
  *
  * @details Stores elements in row-major order. All elements are zero at initialization.
  *
+ * Binary operators with a temporary left operand update it in place and move it out. The elements
+ * live in a std::array, so moving is still an element-wise copy; these overloads only save the
+ * one copy into a separate result.
+ *
  * @tparam ROWS Number of rows.
  * @tparam COLS Number of columns.
  */
@@ -203,6 +211,26 @@ public:
         return m_arr.at(get_array_index(row, col));
     }
 
+    /**
+     * @brief Access the underlying contiguous element storage (row-major).
+     *
+     * @return Pointer to the first element.
+     */
+    [[nodiscard]] double* data() noexcept
+    {
+        return m_arr.data();
+    }
+
+    /**
+     * @brief Get the underlying contiguous element storage (row-major).
+     *
+     * @return Pointer to the first element.
+     */
+    [[nodiscard]] const double* data() const noexcept
+    {
+        return m_arr.data();
+    }
+
     /**
      * @brief Get the number of rows in the matrix.
      *
@@ -235,6 +263,16 @@ public:
         return ROWS * COLS;
     }
 
+    /**
+     * @brief Fill the entire matrix with a value.
+     *
+     * @param val Value to fill the matrix with.
+     */
+    void fill(const double val) noexcept
+    {
+        m_arr.fill(val);
+    }
+
     // =============================================================================================
     // ADDITION OPERATORS
     // =============================================================================================
@@ -285,12 +323,24 @@ public:
      * @param MAT Other matrix.
      * @return Matrix-matrix sum.
      */
-    Matrix operator+(const Matrix& mat) const
+    Matrix operator+(const Matrix& mat) const &
     {
         Matrix result(*this);
         return result += mat;
     }
 
+    /**
+     * @brief Matrix-matrix addition with a temporary LHS. Reuses the temporary's storage.
+     *
+     * @param mat Other matrix.
+     * @return Matrix-matrix sum.
+     */
+    Matrix operator+(const Matrix& mat) && noexcept
+    {
+        *this += mat;
+        return std::move(*this);
+    }
+
     // =============================================================================================
     // SUBTRACTION OPERATORS
     // =============================================================================================
@@ -341,12 +391,24 @@ public:
      * @param mat Other matrix.
      * @return Matrix difference, m1 - m2.
      */
-    Matrix operator-(const Matrix& mat) const
+    Matrix operator-(const Matrix& mat) const &
     {
         Matrix result(*this);
         return result -= mat;
     }
 
+    /**
+     * @brief Subtract a matrix from a temporary matrix. Reuses the temporary's storage.
+     *
+     * @param mat Other matrix.
+     * @return Matrix difference, m1 - m2.
+     */
+    Matrix operator-(const Matrix& mat) && noexcept
+    {
+        *this -= mat;
+        return std::move(*this);
+    }
+
     // =============================================================================================
     // MULTIPLICATION OPERATORS
     // =============================================================================================
@@ -445,6 +507,161 @@ private:
 };
 
 
+// =================================================================================================
+// IN-PLACE FUNCTIONS
+// =================================================================================================
+
+/**
+ * @brief Matrix sum into existing storage, out = a + b.
+ *
+ * @details `out` may alias `a` or `b`.
+ *
+ * @tparam N Rows.
+ * @tparam M Columns.
+ * @param a Matrix A.
+ * @param b Matrix B.
+ * @param out Result.
+ */
+template<std::size_t N, std::size_t M>
+void add_into(const Matrix<N,M>& a, const Matrix<N,M>& b, Matrix<N,M>& out) noexcept
+{
+    const double* const pa = a.data();
+    const double* const pb = b.data();
+    double* const pout = out.data();
+
+    for (std::size_t idx = 0; idx < (N * M); idx++)
+    {
+        pout[idx] = pa[idx] + pb[idx];
+    }
+}
+
+/**
+ * @brief Matrix difference into existing storage, out = a - b.
+ *
+ * @details `out` may alias `a` or `b`.
+ *
+ * @tparam N Rows.
+ * @tparam M Columns.
+ * @param a Matrix A.
+ * @param b Matrix B.
+ * @param out Result.
+ */
+template<std::size_t N, std::size_t M>
+void sub_into(const Matrix<N,M>& a, const Matrix<N,M>& b, Matrix<N,M>& out) noexcept
+{
+    const double* const pa = a.data();
+    const double* const pb = b.data();
+    double* const pout = out.data();
+
+    for (std::size_t idx = 0; idx < (N * M); idx++)
+    {
+        pout[idx] = pa[idx] - pb[idx];
+    }
+}
+
+namespace Internal {
+
+/**
+ * @brief Matrix-matrix product kernel, out = A * B. `out` must not alias `a` or `b`.
+ *
+ * @tparam N Matrix A rows.
+ * @tparam M Matrix A columns and matrix B rows.
+ * @tparam P Matrix B columns.
+ * @param a Matrix A.
+ * @param b Matrix B.
+ * @param out Matrix-matrix product, (N, P).
+ */
+template<std::size_t N, std::size_t M, std::size_t P>
+void mul_kernel(const Matrix<N,M>& a, const Matrix<M,P>& b, Matrix<N,P>& out) noexcept
+{
+    const double* const pa = a.data();
+    const double* const pb = b.data();
+    double* const pout = out.data();
+
+    for (std::size_t ii = 0; ii < N; ii++)
+    {
+        for (std::size_t jj = 0; jj < P; jj++)
+        {
+            double sum = 0.0;
+
+            for (std::size_t kk = 0; kk < M; kk++)
+            {
+                sum += pa[(ii * M) + kk] * pb[(kk * P) + jj];
+            }
+
+            pout[(ii * P) + jj] = sum;
+        }
+    }
+}
+
+}  // namespace Internal
+
+/**
+ * @brief Matrix-matrix product into existing storage, out = A * B.
+ *
+ * @details Naive implementation. `out` may alias `a` or `b`; the product is then staged in a
+ * ScratchValue, so large matrices go to the calling thread's ScratchArena instead of the stack.
+ * https://en.wikipedia.org/wiki/Matrix_multiplication_algorithm
+ *
+ * @tparam N Matrix A rows.
+ * @tparam M Matrix A columns and matrix B rows.
+ * @tparam P Matrix B columns.
+ * @param a Matrix A.
+ * @param b Matrix B.
+ * @param out Matrix-matrix product, (N, P).
+ *
+ * @exception std::bad_alloc `out` aliases an input and the thread's arena is full.
+ */
+template<std::size_t N, std::size_t M, std::size_t P>
+void mul_into(const Matrix<N,M>& a, const Matrix<M,P>& b, Matrix<N,P>& out)
+{
+    const void* const pout = out.data();
+
+    if ((pout != static_cast<const void*>(a.data())) && (pout != static_cast<const void*>(b.data())))
+    {
+        Internal::mul_kernel(a, b, out);
+        return;
+    }
+
+    ScratchScope scope;
+    ScratchValue<Matrix<N,P>> product(scope);
+    Internal::mul_kernel(a, b, *product);
+    out = *product;
+}
+
+/**
+ * @brief Matrix-vector product into existing storage, out = A * x.
+ *
+ * @details `out` must not alias `vec`.
+ *
+ * @tparam N Rows.
+ * @tparam M Columns.
+ * @param mat Matrix.
+ * @param vec Vector.
+ * @param out Matrix-vector product.
+ */
+template<std::size_t N, std::size_t M>
+void mul_into(const Matrix<N,M>& mat, const Vector<M>& vec, Vector<N>& out) noexcept
+{
+    const double* const pmat = mat.data();
+    const double* const pvec = vec.data();
+    double* const pout = out.data();
+
+    assert(static_cast<const void*>(pout) != static_cast<const void*>(pvec));
+
+    for (std::size_t ii = 0; ii < N; ii++)
+    {
+        double sum = 0.0;
+
+        for (std::size_t jj = 0; jj < M; jj++)
+        {
+            sum += pmat[(ii * M) + jj] * pvec[jj];
+        }
+
+        pout[ii] = sum;
+    }
+}
+
 // =================================================================================================
 // MULTIPLICATION OPERATORS
 // =================================================================================================
@@ -489,6 +706,42 @@ Matrix<N,M> operator*(const Matrix<N,M>& mat, const T scalar)
     return scalar * mat;
 }
 
+/**
+ * @brief Scalar-matrix multiplication with a temporary matrix. Reuses the temporary's storage.
+ *
+ * @tparam N Rows.
+ * @tparam M Columns.
+ * @tparam T Scalar type
+ * @param scalar Scalar to multiply.
+ * @param mat Matrix to multiply.
+ * @return Product.
+ */
+template<std::size_t N, std::size_t M, typename T>
+requires valid_matrix_element<T>
+Matrix<N,M> operator*(const T scalar, Matrix<N,M>&& mat)
+{
+    mat *= scalar;
+    return std::move(mat);
+}
+
+/**
+ * @brief Matrix-scalar multiplication with a temporary matrix. Reuses the temporary's storage.
+ *
+ * @tparam N Rows.
+ * @tparam M Columns.
+ * @tparam T Scalar type
+ * @param mat Matrix to multiply.
+ * @param scalar Scalar to multiply.
+ * @return Product.
+ */
+template<std::size_t N, std::size_t M, typename T>
+requires valid_matrix_element<T>
+Matrix<N,M> operator*(Matrix<N,M>&& mat, const T scalar)
+{
+    mat *= scalar;
+    return std::move(mat);
+}
+
 /**
  * @brief 2x2 matrix-matrix multiplication A * B.
  *
@@ -559,22 +812,7 @@ template<std::size_t N, std::size_t M, std::size_t P>
 Matrix<N,P> operator*(const Matrix<N,M>& a, const Matrix<M,P>& b)
 {
     Matrix<N,P> c;
-
-    for (std::size_t ii = 0; ii < N; ii++)
-    {
-        for (std::size_t jj = 0; jj < P; jj++)
-        {
-            double sum = 0.0;
-
-            for (std::size_t kk = 0; kk < M; kk++)
-            {
-                sum += a(ii, kk) * b(kk, jj);
-            }
-
-            c(ii, jj) = sum;
-        }
-    }
-
+    mul_into(a, b, c);
     return c;
 }
 
@@ -640,19 +878,7 @@ template<std::size_t N, std::size_t M>
 Vector<N> operator*(const Matrix<N,M>& mat, const Vector<M>& vec)
 {
     Vector<N> res;
-
-    for (std::size_t ii = 0; ii < N; ii++)
-    {
-        double sum = 0.0;
-
-        for (std::size_t jj = 0; jj < M; jj++)
-        {
-            sum += mat(ii, jj) * vec(jj);
-        }
-
-        res(ii) = sum;
-    }
-
+    mul_into(mat, vec, res);
     return res;
 }
 
@@ -714,19 +940,152 @@ std::ostream& operator<<(std::ostream& os, const Matrix<R,C>& mat)
  *
  * @tparam Matrix dimension (square).
  * @param Matrix Matrix.
+ * @param mode Summation algorithm.
  * @return Matrix trace.
  */
 template<std::size_t N>
-[[nodiscard]] double trace(const Matrix<N,N>& mat)
+[[nodiscard]] double trace(const Matrix<N,N>& mat,
+    const SummationMode mode = SummationMode::Pairwise)
 {
-    double tr = 0.0;
+    const double* const arr = mat.data();
+
+    return summation(N, [arr](const std::size_t idx){return arr[(idx * N) + idx];}, mode);
+}
+
+namespace Internal {
+
+/**
+ * @brief Tile edge length for blocked transposes. An 8x8 tile of doubles is 512 bytes, so a
+ * source and destination tile fit in L1 cache together.
+ */
+constexpr std::size_t TRANSPOSE_TILE_SIZE = 8;
+
+/**
+ * @brief Smallest matrix, in elements, that transposes on more than one thread by default. Below
+ * this, starting threads costs more than the copy.
+ */
+constexpr std::size_t TRANSPOSE_PARALLEL_MIN_ELEMENTS = 256 * 256;
 
-    for (std::size_t idx = 0; idx < N; idx++)
+/**
+ * @brief Get the number of transpose workers.
+ *
+ * @param num_elements Matrix elements.
+ * @param num_tile_rows Rows of tiles to split.
+ * @param num_threads Requested threads. 0 picks from the matrix size.
+ * @return Worker count.
+ */
+[[nodiscard]] inline std::size_t transpose_workers(const std::size_t num_elements,
+    const std::size_t num_tile_rows,
+    const std::size_t num_threads) noexcept
+{
+    if ((num_threads == 0) && (num_elements < TRANSPOSE_PARALLEL_MIN_ELEMENTS))
     {
-        tr += mat(idx, idx);
+        return 1;
     }
 
-    return tr;
+    return worker_count(num_threads, num_tile_rows);
+}
+
+}  // namespace Internal
+
+/**
+ * @brief Transpose a matrix.
+ *
+ * @details Works tile by tile so both the reads and the writes stay in cache for large matrices.
+ * Rows of tiles are split across worker threads; each worker writes its own columns of the result.
+ *
+ * @tparam N Rows.
+ * @tparam M Columns.
+ * @param mat Matrix to transpose.
+ * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency() for matrices with
+ * at least Internal::TRANSPOSE_PARALLEL_MIN_ELEMENTS elements and one thread otherwise.
+ * @return Transposed matrix, (M, N).
+ */
+template<std::size_t N, std::size_t M>
+[[nodiscard]] Matrix<M,N> transpose(const Matrix<N,M>& mat, const std::size_t num_threads = 0)
+{
+    constexpr std::size_t tile = Internal::TRANSPOSE_TILE_SIZE;
+    constexpr std::size_t num_tile_rows = (N + tile - 1) / tile;
+
+    Matrix<M,N> res;
+    const double* const src = mat.data();
+    double* const dst = res.data();
+
+    const auto transpose_tile_rows = [src, dst](const std::size_t, const std::size_t first,
+        const std::size_t last) {
+        for (std::size_t ii0 = first * tile; ii0 < std::min(last * tile, N); ii0 += tile)
+        {
+            const std::size_t ii_end = std::min(ii0 + tile, N);
+
+            for (std::size_t jj0 = 0; jj0 < M; jj0 += tile)
+            {
+                const std::size_t jj_end = std::min(jj0 + tile, M);
+
+                for (std::size_t ii = ii0; ii < ii_end; ii++)
+                {
+                    for (std::size_t jj = jj0; jj < jj_end; jj++)
+                    {
+                        dst[(jj * N) + ii] = src[(ii * M) + jj];
+                    }
+                }
+            }
+        }
+    };
+
+    Internal::parallel_chunks(num_tile_rows,
+        Internal::transpose_workers(N * M, num_tile_rows, num_threads),
+        transpose_tile_rows);
+
+    return res;
+}
+
+/**
+ * @brief Transpose a square matrix in-place.
+ *
+ * @details Swaps tiles across the diagonal so both tiles stay in cache for large matrices. Each
+ * row of tiles only swaps with its own column of tiles, so rows of tiles are split across worker
+ * threads without overlap.
+ *
+ * @tparam N Matrix dimension.
+ * @param mat Matrix to transpose.
+ * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency() for matrices with
+ * at least Internal::TRANSPOSE_PARALLEL_MIN_ELEMENTS elements and one thread otherwise.
+ */
+template<std::size_t N>
+void transpose_in_place(Matrix<N,N>& mat, const std::size_t num_threads = 0)
+{
+    constexpr std::size_t tile = Internal::TRANSPOSE_TILE_SIZE;
+    constexpr std::size_t num_tile_rows = (N + tile - 1) / tile;
+
+    double* const arr = mat.data();
+
+    const auto swap_tile_rows = [arr](const std::size_t, const std::size_t first,
+        const std::size_t last) {
+        for (std::size_t ii0 = first * tile; ii0 < std::min(last * tile, N); ii0 += tile)
+        {
+            const std::size_t ii_end = std::min(ii0 + tile, N);
+
+            for (std::size_t jj0 = ii0; jj0 < N; jj0 += tile)
+            {
+                const std::size_t jj_end = std::min(jj0 + tile, N);
+
+                for (std::size_t ii = ii0; ii < ii_end; ii++)
+                {
+                    // on diagonal tiles, only swap the upper triangle
+                    const std::size_t jj_start = (jj0 == ii0) ? (ii + 1) : jj0;
+
+                    for (std::size_t jj = jj_start; jj < jj_end; jj++)
+                    {
+                        std::swap(arr[(ii * N) + jj], arr[(jj * N) + ii]);
+                    }
+                }
+            }
+        }
+    };
+
+    Internal::parallel_chunks(num_tile_rows,
+        Internal::transpose_workers(N * N, num_tile_rows, num_threads),
+        swap_tile_rows);
 }
 
 }    // namespace MathUtils
@@ -0,0 +1,312 @@
+/**
+ * @file ScratchArena.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Bump allocator for large LinAlg temporaries.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace MathUtils {
+
+/**
+ * @brief Objects at least this large are placed in a ScratchArena by MathUtils::ScratchValue.
+ *
+ * @details Override by defining `MATHUTILS_SCRATCH_ARENA_THRESHOLD_BYTES` at compile time. The
+ * default puts `Matrix<23,23>` and larger in the arena.
+ */
+#ifdef MATHUTILS_SCRATCH_ARENA_THRESHOLD_BYTES
+constexpr inline std::size_t SCRATCH_ARENA_THRESHOLD_BYTES = MATHUTILS_SCRATCH_ARENA_THRESHOLD_BYTES;
+#else
+constexpr inline std::size_t SCRATCH_ARENA_THRESHOLD_BYTES = 4096;
+#endif
+
+/**
+ * @brief Capacity of each thread's default ScratchArena in [bytes].
+ */
+constexpr inline std::size_t SCRATCH_ARENA_DEFAULT_CAPACITY_BYTES = 1024 * 1024;
+
+/**
+ * @brief Criteria for a type that can live in a ScratchArena.
+ *
+ * @details The arena rewinds without running destructors.
+ *
+ * @tparam T Type to check.
+ */
+template<typename T>
+concept scratch_arena_compatible = std::is_trivially_destructible_v<T>;
+
+/**
+ * @brief Fixed-capacity bump allocator.
+ *
+ * @details Allocation is a pointer increment. Memory is only released by rewinding to an earlier
+ * marker, which is done by MathUtils::ScratchScope. Tracks the high-water mark so callers can
+ * size the arena.
+ *
+ * Not copyable or movable, since scopes and outstanding allocations refer to the arena by address.
+ */
+class ScratchArena {
+public:
+    /**
+     * @brief Create an arena.
+     *
+     * @param capacity_bytes Arena capacity in [bytes].
+     */
+    explicit ScratchArena(const std::size_t capacity_bytes);
+
+    ~ScratchArena() = default;
+
+    ScratchArena(const ScratchArena& other) = delete;
+
+    ScratchArena(ScratchArena&& other) = delete;
+
+    ScratchArena& operator=(const ScratchArena& other) = delete;
+
+    ScratchArena& operator=(ScratchArena&& other) = delete;
+
+    /**
+     * @brief Get the calling thread's arena.
+     *
+     * @details Created on first use with SCRATCH_ARENA_DEFAULT_CAPACITY_BYTES.
+     *
+     * @return Thread-local arena.
+     */
+    static ScratchArena& thread_local_instance();
+
+    /**
+     * @brief Allocate uninitialized memory.
+     *
+     * @param num_bytes Number of bytes.
+     * @param alignment Alignment in [bytes]. Power of two.
+     * @return Pointer to the memory.
+     *
+     * @exception std::bad_alloc Not enough space left in the arena.
+     */
+    [[nodiscard]] void* allocate(const std::size_t num_bytes, const std::size_t alignment);
+
+    /**
+     * @brief Construct an object in the arena.
+     *
+     * @tparam T Object type.
+     * @tparam Args Constructor argument types.
+     * @param args Constructor arguments.
+     * @return Reference to the new object.
+     *
+     * @exception std::bad_alloc Not enough space left in the arena.
+     */
+    template<typename T, typename... Args>
+    requires scratch_arena_compatible<T>
+    [[nodiscard]] T& create(Args&&... args)
+    {
+        void* const mem = allocate(sizeof(T), alignof(T));
+        return *::new (mem) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Get the current allocation offset. Pass to rewind() to free later allocations.
+     *
+     * @return Bytes currently in use.
+     */
+    [[nodiscard]] std::size_t used() const noexcept
+    {
+        return m_used;
+    }
+
+    /**
+     * @brief Free everything allocated after `marker`.
+     *
+     * @param marker Value previously returned by used().
+     */
+    void rewind(const std::size_t marker) noexcept;
+
+    /**
+     * @brief Get the arena capacity.
+     *
+     * @return Capacity in [bytes].
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /**
+     * @brief Get the most bytes that have been in use at once.
+     *
+     * @return Peak usage in [bytes].
+     */
+    [[nodiscard]] std::size_t peak() const noexcept
+    {
+        return m_peak;
+    }
+
+    /**
+     * @brief Reset the peak usage to the current usage.
+     */
+    void reset_peak() noexcept
+    {
+        m_peak = m_used;
+    }
+
+private:
+    std::unique_ptr<std::byte[]> m_buffer;  ///< Arena memory.
+    std::size_t m_capacity {0};  ///< Arena size in [bytes].
+    std::size_t m_used {0};  ///< Current allocation offset in [bytes].
+    std::size_t m_peak {0};  ///< High-water mark in [bytes].
+};
+
+/**
+ * @brief Rewinds a ScratchArena when it goes out of scope.
+ *
+ * @code {.cpp}
+ * {
+ *     ScratchScope scope;
+ *     auto& tmp = scope.create<Matrix<40,40>>(a);
+ *     tmp += b;
+ * }  // tmp's memory is released here
+ * @endcode
+ */
+class ScratchScope {
+public:
+    /**
+     * @brief Open a scope on an arena.
+     *
+     * @param arena Arena to allocate from. Defaults to the calling thread's arena.
+     */
+    explicit ScratchScope(ScratchArena& arena = ScratchArena::thread_local_instance()) noexcept
+        :m_arena{arena},
+        m_marker{arena.used()}
+    {}
+
+    ~ScratchScope()
+    {
+        m_arena.rewind(m_marker);
+    }
+
+    ScratchScope(const ScratchScope& other) = delete;
+
+    ScratchScope(ScratchScope&& other) = delete;
+
+    ScratchScope& operator=(const ScratchScope& other) = delete;
+
+    ScratchScope& operator=(ScratchScope&& other) = delete;
+
+    /**
+     * @brief Construct an object in the scope's arena.
+     *
+     * @tparam T Object type.
+     * @tparam Args Constructor argument types.
+     * @param args Constructor arguments.
+     * @return Reference to the new object. Valid until the scope ends.
+     *
+     * @exception std::bad_alloc Not enough space left in the arena.
+     */
+    template<typename T, typename... Args>
+    requires scratch_arena_compatible<T>
+    [[nodiscard]] T& create(Args&&... args)
+    {
+        return m_arena.create<T>(std::forward<Args>(args)...);
+    }
+
+private:
+    ScratchArena& m_arena;  ///< Arena to rewind.
+    std::size_t m_marker;  ///< Arena usage when the scope was opened.
+};
+
+/**
+ * @brief Temporary that lives on the stack if small and in a ScratchArena if large.
+ *
+ * @details The choice is made at compile time with SCRATCH_ARENA_THRESHOLD_BYTES.
+ *
+ * @code {.cpp}
+ * ScratchScope scope;
+ * ScratchValue<Matrix<40,40>> tmp(scope, a);
+ * *tmp += b;
+ * @endcode
+ *
+ * @tparam T Value type.
+ */
+template<typename T>
+requires scratch_arena_compatible<T>
+class ScratchValue {
+public:
+    static constexpr bool in_arena = sizeof(T) >= SCRATCH_ARENA_THRESHOLD_BYTES;  ///< True if stored in the arena.
+
+    /**
+     * @brief Construct the value.
+     *
+     * @tparam Args Constructor argument types.
+     * @param scope Scope that owns arena allocations. Unused for small types.
+     * @param args Constructor arguments.
+     */
+    template<typename... Args>
+    explicit ScratchValue(ScratchScope& scope, Args&&... args)
+        :m_storage{make_storage(scope, std::forward<Args>(args)...)}
+    {}
+
+    ~ScratchValue() = default;
+
+    ScratchValue(const ScratchValue& other) = delete;
+
+    ScratchValue(ScratchValue&& other) = delete;
+
+    ScratchValue& operator=(const ScratchValue& other) = delete;
+
+    ScratchValue& operator=(ScratchValue&& other) = delete;
+
+    /**
+     * @brief Access the value.
+     *
+     * @return Value.
+     */
+    [[nodiscard]] T& operator*() noexcept
+    {
+        if constexpr (in_arena)
+        {
+            return *m_storage;
+        }
+        else
+        {
+            return m_storage;
+        }
+    }
+
+    /**
+     * @brief Access the value's members.
+     *
+     * @return Pointer to the value.
+     */
+    [[nodiscard]] T* operator->() noexcept
+    {
+        return &(**this);
+    }
+
+private:
+    using StorageType = std::conditional_t<in_arena, T*, T>;
+
+    /**
+     * @brief Build the stored value or arena pointer.
+     */
+    template<typename... Args>
+    static StorageType make_storage(ScratchScope& scope, Args&&... args)
+    {
+        if constexpr (in_arena)
+        {
+            return &scope.create<T>(std::forward<Args>(args)...);
+        }
+        else
+        {
+            return T(std::forward<Args>(args)...);
+        }
+    }
+
+private:
+    StorageType m_storage;  ///< Value, or pointer to the value in the arena.
+};
+
+}  // namespace MathUtils
@@ -0,0 +1,155 @@
+/**
+ * @file SparseMatrix.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Sparse matrix in compressed sparse row (CSR) format.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace MathUtils {
+
+/**
+ * @brief One nonzero element used to build a SparseMatrix.
+ */
+struct SparseEntry {
+    std::size_t row;  ///< Row index.
+    std::size_t col;  ///< Column index.
+    double value;     ///< Element value.
+};
+
+/**
+ * @brief Sparse matrix in compressed sparse row (CSR) format.
+ *
+ * @details Column indices and values of each row are stored contiguously and sorted by column,
+ * so matrix-vector products stream through memory once.
+ *
+ * @ref https://en.wikipedia.org/wiki/Sparse_matrix#Compressed_sparse_row_(CSR,_CRS_or_Yale_format)
+ */
+class SparseMatrix {
+public:
+    SparseMatrix() = default;
+
+    ~SparseMatrix() = default;
+
+    /**
+     * @brief Build a matrix from nonzero elements in any order. Duplicate entries are summed.
+     *
+     * @param rows Number of rows.
+     * @param cols Number of columns.
+     * @param entries Nonzero elements.
+     *
+     * @exception std::out_of_range Entry index outside the matrix.
+     */
+    SparseMatrix(const std::size_t rows, const std::size_t cols,
+        std::span<const SparseEntry> entries);
+
+    SparseMatrix(const SparseMatrix& other) = default;
+
+    SparseMatrix(SparseMatrix&& other) noexcept = default;
+
+    SparseMatrix& operator=(const SparseMatrix& other) = default;
+
+    SparseMatrix& operator=(SparseMatrix&& other) noexcept = default;
+
+    /**
+     * @brief Get a matrix element. Elements that are not stored are zero.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Matrix element at specified index.
+     *
+     * @exception std::out_of_range Invalid matrix index.
+     */
+    [[nodiscard]] double operator()(const std::size_t row, const std::size_t col) const;
+
+    /**
+     * @brief Get the number of rows in the matrix.
+     *
+     * @return Matrix rows.
+     */
+    [[nodiscard]] std::size_t rows() const noexcept
+    {
+        return m_rows;
+    }
+
+    /**
+     * @brief Get the number of columns in the matrix.
+     *
+     * @return Matrix columns.
+     */
+    [[nodiscard]] std::size_t cols() const noexcept
+    {
+        return m_cols;
+    }
+
+    /**
+     * @brief Get the number of stored elements.
+     *
+     * @return Number of stored elements.
+     */
+    [[nodiscard]] std::size_t num_nonzero() const noexcept
+    {
+        return m_values.size();
+    }
+
+    /**
+     * @brief Get the start of each row in col_indices() and values(). Length rows() + 1.
+     *
+     * @return Row offsets.
+     */
+    [[nodiscard]] std::span<const std::size_t> row_offsets() const noexcept
+    {
+        return m_row_offsets;
+    }
+
+    /**
+     * @brief Get the column index of each stored element.
+     *
+     * @return Column indices.
+     */
+    [[nodiscard]] std::span<const std::size_t> col_indices() const noexcept
+    {
+        return m_col_indices;
+    }
+
+    /**
+     * @brief Get the value of each stored element.
+     *
+     * @return Values.
+     */
+    [[nodiscard]] std::span<const double> values() const noexcept
+    {
+        return m_values;
+    }
+
+    /**
+     * @brief Matrix-vector product, y = A * x.
+     *
+     * @param x Input. Length cols().
+     * @param y Output. Length rows(). Must not alias `x`.
+     *
+     * @exception std::length_error Mismatched lengths.
+     */
+    void multiply(std::span<const double> x, std::span<double> y) const;
+
+    /**
+     * @brief Get the main diagonal, e.g. for a Jacobi preconditioner.
+     *
+     * @return Diagonal elements. Length min(rows(), cols()).
+     */
+    [[nodiscard]] std::vector<double> diagonal() const;
+
+private:
+    std::size_t m_rows = 0;  ///< Number of rows.
+    std::size_t m_cols = 0;  ///< Number of columns.
+    std::vector<std::size_t> m_row_offsets {0};  ///< Start of each row, plus the end.
+    std::vector<std::size_t> m_col_indices;  ///< Column of each stored element.
+    std::vector<double> m_values;  ///< Value of each stored element.
+};
+
+}  // namespace MathUtils
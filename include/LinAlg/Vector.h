@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include "fast_rsqrt.h"
 #include "Internal/error_msg_helpers.h"
+#include "LinAlg/summation.h"
 
 #include <algorithm>
 #include <array>
@@ -18,8 +20,10 @@
 #include <iomanip>
 #include <numeric>
 #include <ostream>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 namespace MathUtils {
 
@@ -44,6 +48,10 @@ concept valid_vector_element = std::integral<T> || std::floating_point<T>;
  *
  * @details All elements are zero at initialization.
  *
+ * The rvalue-qualified operators write into a temporary left operand and return it. Because the
+ * storage is a std::array, the returned move copies the elements anyway, so they save one copy per
+ * expression rather than reusing memory outright.
+ *
  * @tparam LEN Length of the vector.
  */
 template<std::size_t LEN>
@@ -160,6 +168,26 @@ public:
         return m_arr.at(idx);
     }
 
+    /**
+     * @brief Access the underlying contiguous element storage.
+     *
+     * @return Pointer to the first element.
+     */
+    [[nodiscard]] double* data() noexcept
+    {
+        return m_arr.data();
+    }
+
+    /**
+     * @brief Get the underlying contiguous element storage.
+     *
+     * @return Pointer to the first element.
+     */
+    [[nodiscard]] const double* data() const noexcept
+    {
+        return m_arr.data();
+    }
+
     /**
      * @brief Get the vector length (number of elements).
      *
@@ -183,13 +211,15 @@ public:
     /**
      * @brief Return the magnitude/norm of the vector.
      *
+     * @param mode Summation algorithm for the sum of squares.
      * @return Vector magnitude.
      */
-    [[nodiscard]] double magnitude() const
+    [[nodiscard]] double magnitude(const SummationMode mode = SummationMode::Pairwise) const
     {
-        const double magn = std::accumulate(
-            m_arr.begin(), m_arr.end(), 0.0,
-            [](auto accum, const auto& val){return accum += val * val;}
+        const double magn = summation(
+            LEN,
+            [this](const std::size_t idx){return m_arr[idx] * m_arr[idx];},
+            mode
         );
 
         assert(magn >= 0.0);
@@ -208,14 +238,54 @@ public:
         std::for_each(m_arr.begin(), m_arr.end(), [magn](auto& val){val /= magn;});
     }
 
+    /**
+     * @brief Normalize the vector with an approximate reciprocal square root.
+     *
+     * @details No sqrt or divides. The resulting magnitude is within 4.6e-6 of one.
+     * The squared magnitude must be positive and normal, as fast_rsqrt requires.
+     *
+     * @see MathUtils::fast_rsqrt
+     */
+    void normalize_fast()
+    {
+        const double magn2 = dot_self();
+
+        assert(std::isnormal(magn2));
+
+        const double inv_magn = fast_rsqrt(magn2);
+
+        for (auto& val : m_arr)
+        {
+            val *= inv_magn;
+        }
+    }
+
+    /**
+     * @brief Renormalize a nearly-unit vector with a first-order correction.
+     *
+     * @details Scales by 1.5 - 0.5 * |v|^2. No sqrt or divides. If |v|^2 = 1 + e, the resulting
+     * magnitude is within (3/8) * e^2 of one, so only use it to remove accumulated drift (e.g.
+     * |e| < 1e-3 gives an error below 4e-7).
+     */
+    void renormalize_nearly_unit() noexcept
+    {
+        const double scale = 1.5 - (0.5 * dot_self());
+
+        for (auto& val : m_arr)
+        {
+            val *= scale;
+        }
+    }
+
     /**
      * @brief Return the sum of all elements in the vector.
      *
+     * @param mode Summation algorithm.
      * @return Sum of all vector elements.
      */
-    [[nodiscard]] double get_sum() const
+    [[nodiscard]] double get_sum(const SummationMode mode = SummationMode::Pairwise) const
     {
-        return std::accumulate(m_arr.begin(), m_arr.end(), 0.0, std::plus<double>());
+        return summation(LEN, [this](const std::size_t idx){return m_arr[idx];}, mode);
     }
 
     /**
@@ -281,12 +351,27 @@ public:
      */
     template<typename T>
     requires valid_vector_element<T>
-    Vector operator+(const T scalar) const
+    Vector operator+(const T scalar) const &
     {
         Vector result(*this);
         return result += scalar;
     }
 
+    /**
+     * @brief Add a scalar to a temporary vector. Reuses the temporary's storage.
+     *
+     * @tparam T Scalar type.
+     * @param scalar Scalar to add.
+     * @return Vector plus scalar.
+     */
+    template<typename T>
+    requires valid_vector_element<T>
+    Vector operator+(const T scalar) && noexcept
+    {
+        *this += scalar;
+        return std::move(*this);
+    }
+
     /**
      * @brief Add two vectors.
      *
@@ -295,12 +380,24 @@ public:
      * @param vec Other vector.
      * @return Vector sum, v1 + v2.
      */
-    Vector operator+(const Vector& vec) const
+    Vector operator+(const Vector& vec) const &
     {
         Vector result(*this);
         return result += vec;
     }
 
+    /**
+     * @brief Add a vector to a temporary vector. Reuses the temporary's storage.
+     *
+     * @param vec Other vector.
+     * @return Vector sum, v1 + v2.
+     */
+    Vector operator+(const Vector& vec) && noexcept
+    {
+        *this += vec;
+        return std::move(*this);
+    }
+
     // =============================================================================================
     // SUBTRACTION OPERATORS
     // =============================================================================================
@@ -354,12 +451,27 @@ public:
      */
     template<typename T>
     requires valid_vector_element<T>
-    Vector operator-(const T scalar) const
+    Vector operator-(const T scalar) const &
     {
         Vector result(*this);
         return result -= scalar;
     }
 
+    /**
+     * @brief Subtract a scalar from a temporary vector. Reuses the temporary's storage.
+     *
+     * @tparam T Scalar type.
+     * @param scalar Scalar to subtract.
+     * @return Vector minus scalar.
+     */
+    template<typename T>
+    requires valid_vector_element<T>
+    Vector operator-(const T scalar) && noexcept
+    {
+        *this -= scalar;
+        return std::move(*this);
+    }
+
     /**
      * @brief Subtract two vectors.
      *
@@ -368,12 +480,24 @@ public:
      * @param vec Vector to subtract.
      * @return Vector difference, v1 - v2.
      */
-    Vector operator-(const Vector& vec) const
+    Vector operator-(const Vector& vec) const &
     {
         Vector result(*this);
         return result -= vec;
     }
 
+    /**
+     * @brief Subtract a vector from a temporary vector. Reuses the temporary's storage.
+     *
+     * @param vec Vector to subtract.
+     * @return Vector difference, v1 - v2.
+     */
+    Vector operator-(const Vector& vec) && noexcept
+    {
+        *this -= vec;
+        return std::move(*this);
+    }
+
     // =============================================================================================
     // MULTIPLICATION OPERATORS
     // =============================================================================================
@@ -424,12 +548,24 @@ public:
      * @param vec Other vector.
      * @return vec1 * vec2.
      */
-    Vector operator*(const Vector& vec) const
+    Vector operator*(const Vector& vec) const &
     {
         Vector result(*this);
         return result *= vec;
     }
 
+    /**
+     * @brief Multiply a temporary vector by a vector. Reuses the temporary's storage.
+     *
+     * @param vec Other vector.
+     * @return vec1 * vec2.
+     */
+    Vector operator*(const Vector& vec) && noexcept
+    {
+        *this *= vec;
+        return std::move(*this);
+    }
+
     // =============================================================================================
     // DIVISION OPERATORS
     // =============================================================================================
@@ -460,6 +596,19 @@ public:
 
 protected:
 private:
+    /**
+     * @brief Sum of squared elements, |v|^2.
+     *
+     * @details Uses the same pairwise tree as magnitude(), so the fast normalizations see the same
+     * |v|^2 as normalize().
+     *
+     * @return Squared magnitude.
+     */
+    [[nodiscard]] double dot_self() const noexcept
+    {
+        return pairwise_sum(0, LEN, [this](const std::size_t idx){return m_arr[idx] * m_arr[idx];});
+    }
+
     std::array<double, LEN> m_arr {0};  ///< Underlying array to store vector values.
 };
 
@@ -506,6 +655,153 @@ Vector<N> operator*(const Vector<N>& vec, const T scalar)
     return scalar * vec;
 }
 
+/**
+ * @brief Multiply a temporary vector by a scalar (scalar * vector). Reuses the temporary's
+ * storage.
+ *
+ * @tparam N Vector length.
+ * @tparam T Scalar type.
+ * @param scalar Scalar to multiply by.
+ * @param vec Vector operand.
+ * @return Vector times scalar.
+ */
+template<std::size_t N, typename T>
+requires valid_vector_element<T>
+Vector<N> operator*(const T scalar, Vector<N>&& vec)
+{
+    vec *= scalar;
+    return std::move(vec);
+}
+
+/**
+ * @brief Multiply a temporary vector by a scalar (vector * scalar). Reuses the temporary's
+ * storage.
+ *
+ * @tparam N Vector length.
+ * @tparam T Scalar type.
+ * @param vec Vector operand.
+ * @param scalar Scalar to multiply by.
+ * @return Vector times scalar.
+ */
+template<std::size_t N, typename T>
+requires valid_vector_element<T>
+Vector<N> operator*(Vector<N>&& vec, const T scalar)
+{
+    vec *= scalar;
+    return std::move(vec);
+}
+
+// =================================================================================================
+// IN-PLACE FUNCTIONS
+// =================================================================================================
+
+/**
+ * @brief Element-wise vector sum into existing storage, out = a + b.
+ *
+ * @details `out` may alias `a` or `b`.
+ *
+ * @tparam N Vector length.
+ * @param a First vector.
+ * @param b Second vector.
+ * @param out Result.
+ */
+template<std::size_t N>
+void add_into(const Vector<N>& a, const Vector<N>& b, Vector<N>& out) noexcept
+{
+    const double* const pa = a.data();
+    const double* const pb = b.data();
+    double* const pout = out.data();
+
+    for (std::size_t idx = 0; idx < N; idx++)
+    {
+        pout[idx] = pa[idx] + pb[idx];
+    }
+}
+
+/**
+ * @brief Element-wise vector difference into existing storage, out = a - b.
+ *
+ * @details `out` may alias `a` or `b`.
+ *
+ * @tparam N Vector length.
+ * @param a First vector.
+ * @param b Second vector.
+ * @param out Result.
+ */
+template<std::size_t N>
+void sub_into(const Vector<N>& a, const Vector<N>& b, Vector<N>& out) noexcept
+{
+    const double* const pa = a.data();
+    const double* const pb = b.data();
+    double* const pout = out.data();
+
+    for (std::size_t idx = 0; idx < N; idx++)
+    {
+        pout[idx] = pa[idx] - pb[idx];
+    }
+}
+
+/**
+ * @brief Element-wise vector product into existing storage, out = a * b.
+ *
+ * @details `out` may alias `a` or `b`.
+ *
+ * @tparam N Vector length.
+ * @param a First vector.
+ * @param b Second vector.
+ * @param out Result.
+ */
+template<std::size_t N>
+void mul_into(const Vector<N>& a, const Vector<N>& b, Vector<N>& out) noexcept
+{
+    const double* const pa = a.data();
+    const double* const pb = b.data();
+    double* const pout = out.data();
+
+    for (std::size_t idx = 0; idx < N; idx++)
+    {
+        pout[idx] = pa[idx] * pb[idx];
+    }
+}
+
+// =================================================================================================
+// BATCH FUNCTIONS
+// =================================================================================================
+
+/**
+ * @brief Normalize every vector with an approximate reciprocal square root.
+ *
+ * @details Calls Vector::normalize_fast().
+ *
+ * @tparam N Vector length.
+ * @param vecs Vectors to normalize.
+ */
+template<std::size_t N>
+void normalize_fast(std::span<Vector<N>> vecs)
+{
+    for (auto& vec : vecs)
+    {
+        vec.normalize_fast();
+    }
+}
+
+/**
+ * @brief Renormalize every nearly-unit vector with a first-order correction.
+ *
+ * @details Calls Vector::renormalize_nearly_unit().
+ *
+ * @tparam N Vector length.
+ * @param vecs Vectors to renormalize.
+ */
+template<std::size_t N>
+void renormalize_nearly_unit(std::span<Vector<N>> vecs) noexcept
+{
+    for (auto& vec : vecs)
+    {
+        vec.renormalize_nearly_unit();
+    }
+}
+
 // =================================================================================================
 // OTHER OPERATORS
 // =================================================================================================
@@ -584,22 +880,23 @@ inline double dot(const Vector<3>& v1, const Vector<3>& v2)
 /**
  * @brief Compute the vector dot product.
  *
+ * @details Uses a fixed summation order, so results do not depend on how the products are
+ * evaluated.
+ *
  * @tparam N Vector length.
  * @param v1 First vector.
  * @param v2 Second vector.
+ * @param mode Summation algorithm.
  * @return Dot product.
  */
 template<std::size_t N>
-double dot(const Vector<N>& v1, const Vector<N>& v2)
+double dot(const Vector<N>& v1, const Vector<N>& v2,
+    const SummationMode mode = SummationMode::Pairwise)
 {
-    double dot_prod = 0.0;
-
-    for (std::size_t idx = 0; idx < N; idx++)
-    {
-        dot_prod += v1(idx) * v2(idx);
-    }
+    const double* const a = v1.data();
+    const double* const b = v2.data();
 
-    return dot_prod;
+    return summation(N, [a, b](const std::size_t idx){return a[idx] * b[idx];}, mode);
 }
 
 }  // namespace MathUtils
@@ -0,0 +1,252 @@
+/**
+ * @file Vector3Batch.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Structure-of-arrays storage for many 3D vectors, and batch kernels.
+ */
+
+#pragma once
+
+#include "LinAlg/Vector.h"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace MathUtils {
+
+/**
+ * @brief Many 3D vectors stored as separate x, y, and z arrays (structure-of-arrays).
+ *
+ * @details Keeping each component contiguous lets batch kernels stream through memory and
+ * operate on several vectors per SIMD instruction. All elements are zero at initialization.
+ */
+class Vector3Batch {
+public:
+    Vector3Batch() = default;
+
+    ~Vector3Batch() = default;
+
+    /**
+     * @brief Create a batch of zero vectors.
+     *
+     * @param size Number of vectors.
+     */
+    explicit Vector3Batch(const std::size_t size);
+
+    /**
+     * @brief Create a batch from array-of-structures vectors.
+     *
+     * @param vecs Vectors to copy.
+     */
+    explicit Vector3Batch(std::span<const Vector<3>> vecs);
+
+    Vector3Batch(const Vector3Batch& other) = default;
+
+    Vector3Batch(Vector3Batch&& other) noexcept = default;
+
+    Vector3Batch& operator=(const Vector3Batch& other) = default;
+
+    Vector3Batch& operator=(Vector3Batch&& other) noexcept = default;
+
+    /**
+     * @brief Get the number of vectors.
+     *
+     * @return Number of vectors.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_x.size();
+    }
+
+    /**
+     * @brief Change the number of vectors. New vectors are zero.
+     *
+     * @param size New number of vectors.
+     */
+    void resize(const std::size_t size);
+
+    /**
+     * @brief Get a vector.
+     *
+     * @param idx Vector index.
+     * @return Vector at specified index.
+     *
+     * @exception std::out_of_range Invalid index.
+     */
+    [[nodiscard]] Vector<3> get(const std::size_t idx) const;
+
+    /**
+     * @brief Set a vector.
+     *
+     * @param idx Vector index.
+     * @param vec New value.
+     *
+     * @exception std::out_of_range Invalid index.
+     */
+    void set(const std::size_t idx, const Vector<3>& vec);
+
+    /**
+     * @brief Access the x components.
+     *
+     * @return X components.
+     */
+    [[nodiscard]] std::span<double> x() noexcept
+    {
+        return m_x;
+    }
+
+    /**
+     * @brief Get the x components.
+     *
+     * @return X components.
+     */
+    [[nodiscard]] std::span<const double> x() const noexcept
+    {
+        return m_x;
+    }
+
+    /**
+     * @brief Access the y components.
+     *
+     * @return Y components.
+     */
+    [[nodiscard]] std::span<double> y() noexcept
+    {
+        return m_y;
+    }
+
+    /**
+     * @brief Get the y components.
+     *
+     * @return Y components.
+     */
+    [[nodiscard]] std::span<const double> y() const noexcept
+    {
+        return m_y;
+    }
+
+    /**
+     * @brief Access the z components.
+     *
+     * @return Z components.
+     */
+    [[nodiscard]] std::span<double> z() noexcept
+    {
+        return m_z;
+    }
+
+    /**
+     * @brief Get the z components.
+     *
+     * @return Z components.
+     */
+    [[nodiscard]] std::span<const double> z() const noexcept
+    {
+        return m_z;
+    }
+
+private:
+    std::vector<double> m_x;  ///< X components.
+    std::vector<double> m_y;  ///< Y components.
+    std::vector<double> m_z;  ///< Z components.
+};
+
+// =================================================================================================
+// BATCH KERNELS
+// =================================================================================================
+
+/**
+ * @brief Dot products of corresponding vectors, out[i] = a[i] . b[i].
+ *
+ * @param a First vectors.
+ * @param b Second vectors.
+ * @param out Dot products. Same length as the inputs.
+ *
+ * @exception std::length_error Mismatched lengths.
+ */
+void batch_dot(const Vector3Batch& a, const Vector3Batch& b, std::span<double> out);
+
+/**
+ * @brief Dot product of one vector with many, out[i] = a . b[i].
+ *
+ * @param a Vector broadcast to every element of `b`.
+ * @param b Vectors.
+ * @param out Dot products. Same length as `b`.
+ *
+ * @exception std::length_error Mismatched lengths.
+ */
+void batch_dot(const Vector<3>& a, const Vector3Batch& b, std::span<double> out);
+
+/**
+ * @brief Cross products of corresponding vectors, out[i] = a[i] x b[i].
+ *
+ * @param a First vectors (LHS).
+ * @param b Second vectors (RHS).
+ * @param out Cross products. Resized to match the inputs. May alias `a` or `b`.
+ *
+ * @exception std::length_error Mismatched lengths.
+ */
+void batch_cross(const Vector3Batch& a, const Vector3Batch& b, Vector3Batch& out);
+
+/**
+ * @brief Cross product of one vector with many, out[i] = a x b[i].
+ *
+ * @param a Vector broadcast to every element of `b` (LHS).
+ * @param b Vectors (RHS).
+ * @param out Cross products. Resized to match `b`. May alias `b`.
+ */
+void batch_cross(const Vector<3>& a, const Vector3Batch& b, Vector3Batch& out);
+
+/**
+ * @brief Unit-length cross products, out[i] = (a[i] x b[i]) / |a[i] x b[i]|.
+ *
+ * @details Parallel vectors give NaN.
+ *
+ * @param a First vectors (LHS).
+ * @param b Second vectors (RHS).
+ * @param out Normalized cross products. Resized to match the inputs.
+ *
+ * @exception std::length_error Mismatched lengths.
+ */
+void batch_cross_normalized(const Vector3Batch& a, const Vector3Batch& b, Vector3Batch& out);
+
+/**
+ * @brief Scalar triple products, out[i] = a[i] . (b[i] x c[i]).
+ *
+ * @param a First vectors.
+ * @param b Second vectors.
+ * @param c Third vectors.
+ * @param out Triple products. Same length as the inputs.
+ *
+ * @exception std::length_error Mismatched lengths.
+ */
+void batch_triple_product(const Vector3Batch& a, const Vector3Batch& b, const Vector3Batch& c,
+    std::span<double> out);
+
+/**
+ * @brief Angles between corresponding vectors in [0, pi] [rad].
+ *
+ * @details The cosine is constrained to [-1, 1] before calling MathUtils::acos_safe. Zero-length
+ * vectors give pi/2.
+ *
+ * @param a First vectors.
+ * @param b Second vectors.
+ * @param out Angles in [rad]. Same length as the inputs.
+ *
+ * @exception std::length_error Mismatched lengths.
+ */
+void batch_angle_between(const Vector3Batch& a, const Vector3Batch& b, std::span<double> out);
+
+/**
+ * @brief Angles between one vector and many, in [0, pi] [rad].
+ *
+ * @param a Vector broadcast to every element of `b`.
+ * @param b Vectors.
+ * @param out Angles in [rad]. Same length as `b`.
+ *
+ * @exception std::length_error Mismatched lengths.
+ */
+void batch_angle_between(const Vector<3>& a, const Vector3Batch& b, std::span<double> out);
+
+}  // namespace MathUtils
@@ -0,0 +1,145 @@
+/**
+ * @file cholesky.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Cholesky factorization and solves for symmetric positive-definite matrices.
+ */
+
+#pragma once
+
+#include "LinAlg/Matrix.h"
+#include "LinAlg/Vector.h"
+
+#include <cmath>
+#include <cstddef>
+
+namespace MathUtils {
+
+/**
+ * @brief Cholesky factorization A = L * L^T of a symmetric positive-definite matrix.
+ *
+ * @details Only the lower triangle of `a` is read. The strict upper triangle of `l` is zeroed.
+ * Returns false instead of throwing so filters can handle a non-positive-definite covariance at
+ * runtime. `l` may alias `a`.
+ *
+ * @tparam N Matrix dimension.
+ * @param a Symmetric positive-definite matrix.
+ * @param l Lower-triangular factor.
+ * @return True on success, false if `a` is not positive definite. On failure `l` holds a partial
+ * factor, so an aliased `a` is left partly overwritten; copy it first if it is needed afterwards.
+ *
+ * @ref https://en.wikipedia.org/wiki/Cholesky_decomposition#The_Cholesky%E2%80%93Banachiewicz_and_Cholesky%E2%80%93Crout_algorithms
+ */
+template<std::size_t N>
+[[nodiscard]] bool cholesky_decompose(const Matrix<N,N>& a, Matrix<N,N>& l) noexcept
+{
+    const double* const pa = a.data();
+    double* const pl = l.data();
+
+    for (std::size_t ii = 0; ii < N; ii++)
+    {
+        for (std::size_t jj = 0; jj <= ii; jj++)
+        {
+            double sum = pa[(ii * N) + jj];
+
+            for (std::size_t kk = 0; kk < jj; kk++)
+            {
+                sum -= pl[(ii * N) + kk] * pl[(jj * N) + kk];
+            }
+
+            if (ii == jj)
+            {
+                // also rejects NaN
+                if (!(sum > 0.0))
+                {
+                    return false;
+                }
+
+                pl[(ii * N) + ii] = std::sqrt(sum);
+            }
+            else
+            {
+                pl[(ii * N) + jj] = sum / pl[(jj * N) + jj];
+            }
+        }
+
+        for (std::size_t jj = ii + 1; jj < N; jj++)
+        {
+            pl[(ii * N) + jj] = 0.0;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Solve L * y = b for y by forward substitution.
+ *
+ * @tparam N Matrix dimension.
+ * @param l Lower-triangular matrix with a nonzero diagonal.
+ * @param b Right-hand side.
+ * @return Solution y.
+ */
+template<std::size_t N>
+[[nodiscard]] Vector<N> forward_substitute(const Matrix<N,N>& l, const Vector<N>& b) noexcept
+{
+    const double* const pl = l.data();
+    Vector<N> y(b);
+    double* const py = y.data();
+
+    for (std::size_t ii = 0; ii < N; ii++)
+    {
+        for (std::size_t kk = 0; kk < ii; kk++)
+        {
+            py[ii] -= pl[(ii * N) + kk] * py[kk];
+        }
+
+        py[ii] /= pl[(ii * N) + ii];
+    }
+
+    return y;
+}
+
+/**
+ * @brief Solve L^T * x = y for x by back substitution, given lower-triangular L.
+ *
+ * @tparam N Matrix dimension.
+ * @param l Lower-triangular matrix with a nonzero diagonal.
+ * @param y Right-hand side.
+ * @return Solution x.
+ */
+template<std::size_t N>
+[[nodiscard]] Vector<N> back_substitute_transposed(const Matrix<N,N>& l, const Vector<N>& y) noexcept
+{
+    const double* const pl = l.data();
+    Vector<N> x(y);
+    double* const px = x.data();
+
+    for (std::size_t ii = N; ii-- > 0;)
+    {
+        for (std::size_t kk = ii + 1; kk < N; kk++)
+        {
+            px[ii] -= pl[(kk * N) + ii] * px[kk];
+        }
+
+        px[ii] /= pl[(ii * N) + ii];
+    }
+
+    return x;
+}
+
+/**
+ * @brief Solve A * x = b given the Cholesky factor L of A.
+ *
+ * @tparam N Matrix dimension.
+ * @param l Lower-triangular Cholesky factor from cholesky_decompose().
+ * @param b Right-hand side.
+ * @return Solution x.
+ */
+template<std::size_t N>
+[[nodiscard]] Vector<N> cholesky_solve(const Matrix<N,N>& l, const Vector<N>& b) noexcept
+{
+    return back_substitute_transposed(l, forward_substitute(l, b));
+}
+
+}  // namespace MathUtils
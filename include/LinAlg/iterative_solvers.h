@@ -0,0 +1,463 @@
+/**
+ * @file iterative_solvers.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Preconditioned conjugate gradient and GMRES for large linear systems.
+ *
+ * @details Solvers work on any type satisfying MathUtils::linear_operator, e.g. SparseMatrix or
+ * DynamicMatrix, and only need matrix-vector products. Reusing a workspace across solves of the
+ * same size avoids all allocation.
+ */
+
+#pragma once
+
+#include "Internal/error_msg_helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace MathUtils {
+
+/**
+ * @brief Criteria for a linear operator y = A * x.
+ *
+ * @tparam T Operator type.
+ */
+template<typename T>
+concept linear_operator = requires(const T& op, std::span<const double> x, std::span<double> y)
+{
+    {op.rows()} -> std::convertible_to<std::size_t>;
+    {op.cols()} -> std::convertible_to<std::size_t>;
+    op.multiply(x, y);
+};
+
+/**
+ * @brief Criteria for a preconditioner z = M^-1 * r.
+ *
+ * @tparam T Preconditioner type.
+ */
+template<typename T>
+concept preconditioner = requires(const T& pc, std::span<const double> r, std::span<double> z)
+{
+    pc.apply(r, z);
+};
+
+/**
+ * @brief Preconditioner that does nothing, M = I.
+ */
+class IdentityPreconditioner {
+public:
+    /**
+     * @brief Copy `r` to `z`.
+     *
+     * @param r Residual.
+     * @param z Preconditioned residual. Same length as `r`.
+     */
+    void apply(std::span<const double> r, std::span<double> z) const noexcept;
+};
+
+/**
+ * @brief Diagonal (Jacobi) preconditioner, M = diag(A).
+ */
+class JacobiPreconditioner {
+public:
+    /**
+     * @brief Create a preconditioner from the diagonal of A. Zero elements are treated as one.
+     *
+     * @param diag Diagonal of A.
+     */
+    explicit JacobiPreconditioner(std::span<const double> diag);
+
+    /**
+     * @brief Divide `r` element-wise by the diagonal.
+     *
+     * @param r Residual.
+     * @param z Preconditioned residual. Same length as `r`.
+     */
+    void apply(std::span<const double> r, std::span<double> z) const noexcept;
+
+private:
+    std::vector<double> m_inv_diag;  ///< 1 / diag(A).
+};
+
+/**
+ * @brief Iterative solver settings.
+ */
+struct IterativeSolverOptions {
+    double tolerance = 1e-10;  ///< Stop when ||b - A * x|| <= tolerance * ||b||.
+    std::size_t max_iterations = 1000;  ///< Maximum matrix-vector products.
+    std::size_t restart = 30;  ///< GMRES Krylov subspace size before restarting.
+};
+
+/**
+ * @brief Why an iterative solver stopped.
+ */
+enum class IterativeSolverStatus {
+    Converged,      ///< Tolerance was met.
+    MaxIterations,  ///< Iteration limit reached first.
+    Breakdown,      ///< The method cannot continue on this operator, e.g. CG with p^T * A * p <= 0.
+};
+
+/**
+ * @brief Iterative solver outcome.
+ */
+struct IterativeSolverResult {
+    IterativeSolverStatus status;  ///< Why the solver stopped.
+    std::size_t iterations;  ///< Iterations performed.
+    double relative_residual;  ///< ||b - A * x|| / ||b|| at exit.
+};
+
+/**
+ * @brief Preallocated vectors for conjugate_gradient().
+ */
+struct ConjugateGradientWorkspace {
+    std::vector<double> r;  ///< Residual.
+    std::vector<double> z;  ///< Preconditioned residual.
+    std::vector<double> p;  ///< Search direction.
+    std::vector<double> ap;  ///< A * p.
+
+    /**
+     * @brief Size every vector for `len` unknowns. Does not allocate if already large enough.
+     *
+     * @param len Number of unknowns.
+     */
+    void resize(const std::size_t len);
+};
+
+/**
+ * @brief Preallocated vectors for gmres().
+ */
+struct GmresWorkspace {
+    std::vector<double> basis;  ///< Krylov basis, (restart + 1) vectors of length n.
+    std::vector<double> hessenberg;  ///< Upper Hessenberg matrix, (restart + 1) x restart.
+    std::vector<double> cs;  ///< Givens rotation cosines.
+    std::vector<double> sn;  ///< Givens rotation sines.
+    std::vector<double> g;  ///< Rotated residual vector.
+    std::vector<double> y;  ///< Least-squares solution.
+    std::vector<double> w;  ///< Work vector.
+    std::vector<double> z;  ///< Preconditioned work vector.
+
+    /**
+     * @brief Size every vector. Does not allocate if already large enough.
+     *
+     * @param len Number of unknowns.
+     * @param restart Krylov subspace size.
+     */
+    void resize(const std::size_t len, const std::size_t restart);
+};
+
+namespace Internal {
+
+/**
+ * @brief Shortest span that span_dot(), span_norm() and span_axpy() split across worker threads.
+ */
+constexpr std::size_t SPAN_PARALLEL_MIN_LEN = std::size_t{1} << 18;
+
+/**
+ * @brief Elements per chunk when a span is split across worker threads.
+ */
+constexpr std::size_t SPAN_CHUNK_LEN = std::size_t{1} << 15;
+
+/**
+ * @brief Dot product using pairwise summation.
+ *
+ * @details Long spans are summed in SPAN_CHUNK_LEN chunks on worker threads, and the chunk sums
+ * are combined pairwise in chunk order, so the result does not depend on the thread count.
+ */
+[[nodiscard]] double span_dot(std::span<const double> a, std::span<const double> b);
+
+/**
+ * @brief Euclidean norm using span_dot().
+ */
+[[nodiscard]] double span_norm(std::span<const double> a);
+
+/**
+ * @brief y += alpha * x. Long spans are split across worker threads.
+ */
+void span_axpy(const double alpha, std::span<const double> x, std::span<double> y);
+
+/**
+ * @brief r = b - A * x.
+ */
+template<typename Op>
+requires linear_operator<Op>
+void residual(const Op& op, std::span<const double> b, std::span<const double> x,
+    std::span<double> r)
+{
+    op.multiply(x, r);
+
+    for (std::size_t idx = 0; idx < r.size(); idx++)
+    {
+        r[idx] = b[idx] - r[idx];
+    }
+}
+
+/**
+ * @brief Check that A is square and matches `b` and `x`.
+ */
+template<typename Op>
+requires linear_operator<Op>
+void check_system(const Op& op, std::span<const double> b, std::span<const double> x)
+{
+    if (op.rows() != op.cols())
+    {
+        throw std::length_error(Internal::non_square_error_msg(op.rows(), op.cols()));
+    }
+
+    if (b.size() != op.rows())
+    {
+        throw std::length_error(Internal::mismatched_dimension_error_msg(b.size(), op.rows()));
+    }
+
+    if (x.size() != op.cols())
+    {
+        throw std::length_error(Internal::mismatched_dimension_error_msg(x.size(), op.cols()));
+    }
+}
+
+}  // namespace Internal
+
+/**
+ * @brief Solve A * x = b for symmetric positive-definite A with preconditioned conjugate gradient.
+ *
+ * @details If a search direction has p^T * A * p <= 0 (A indefinite or singular) or a non-finite
+ * curvature, the solver stops with IterativeSolverStatus::Breakdown and leaves `x` at the last
+ * finite iterate.
+ *
+ * @tparam Op Linear operator type.
+ * @tparam Pc Preconditioner type. Must be symmetric positive definite.
+ * @param op Operator A.
+ * @param b Right-hand side.
+ * @param x Initial guess on input, solution on output.
+ * @param pc Preconditioner.
+ * @param ws Workspace, resized as needed.
+ * @param options Solver settings.
+ * @return Solver outcome.
+ *
+ * @exception std::length_error A is not square or does not match `b` and `x`.
+ *
+ * @ref https://en.wikipedia.org/wiki/Conjugate_gradient_method#The_preconditioned_conjugate_gradient_method
+ */
+template<typename Op, typename Pc>
+requires linear_operator<Op> && preconditioner<Pc>
+IterativeSolverResult conjugate_gradient(const Op& op, std::span<const double> b,
+    std::span<double> x, const Pc& pc, ConjugateGradientWorkspace& ws,
+    const IterativeSolverOptions& options = {})
+{
+    Internal::check_system(op, b, x);
+    ws.resize(b.size());
+
+    const std::span<double> r(ws.r);
+    const std::span<double> z(ws.z);
+    const std::span<double> p(ws.p);
+    const std::span<double> ap(ws.ap);
+
+    const double b_norm = Internal::span_norm(b);
+    const double scale = (b_norm > 0.0) ? (1.0 / b_norm) : 1.0;
+
+    Internal::residual(op, b, x, r);
+    double rel_res = Internal::span_norm(r) * scale;
+
+    if (rel_res <= options.tolerance)
+    {
+        return {IterativeSolverStatus::Converged, 0, rel_res};
+    }
+
+    pc.apply(r, z);
+    std::copy(z.begin(), z.end(), p.begin());
+    double rz = Internal::span_dot(r, z);
+
+    for (std::size_t iter = 1; iter <= options.max_iterations; iter++)
+    {
+        op.multiply(p, ap);
+
+        // only an SPD operator guarantees positive curvature along every direction
+        const double p_ap = Internal::span_dot(p, ap);
+
+        if (!(p_ap > 0.0) || std::isinf(p_ap))
+        {
+            return {IterativeSolverStatus::Breakdown, iter, rel_res};
+        }
+
+        const double alpha = rz / p_ap;
+        Internal::span_axpy(alpha, p, x);
+        Internal::span_axpy(-alpha, ap, r);
+
+        rel_res = Internal::span_norm(r) * scale;
+
+        if (rel_res <= options.tolerance)
+        {
+            return {IterativeSolverStatus::Converged, iter, rel_res};
+        }
+
+        pc.apply(r, z);
+        const double rz_next = Internal::span_dot(r, z);
+        const double beta = rz_next / rz;
+        rz = rz_next;
+
+        for (std::size_t idx = 0; idx < p.size(); idx++)
+        {
+            p[idx] = z[idx] + (beta * p[idx]);
+        }
+    }
+
+    return {IterativeSolverStatus::MaxIterations, options.max_iterations, rel_res};
+}
+
+/**
+ * @brief Solve A * x = b for general square A with restarted, right-preconditioned GMRES(m).
+ *
+ * @details Right preconditioning keeps the monitored residual equal to the true residual of the
+ * unpreconditioned system. The Arnoldi process uses modified Gram-Schmidt, and the least-squares
+ * problem is updated with Givens rotations so the residual is known at every iteration.
+ *
+ * @tparam Op Linear operator type.
+ * @tparam Pc Preconditioner type.
+ * @param op Operator A.
+ * @param b Right-hand side.
+ * @param x Initial guess on input, solution on output.
+ * @param pc Preconditioner.
+ * @param ws Workspace, resized as needed.
+ * @param options Solver settings.
+ * @return Solver outcome.
+ *
+ * @exception std::length_error A is not square or does not match `b` and `x`.
+ *
+ * @ref https://en.wikipedia.org/wiki/Generalized_minimal_residual_method
+ * @ref Saad, "Iterative Methods for Sparse Linear Systems", 2nd ed., Algorithm 9.5.
+ */
+template<typename Op, typename Pc>
+requires linear_operator<Op> && preconditioner<Pc>
+IterativeSolverResult gmres(const Op& op, std::span<const double> b, std::span<double> x,
+    const Pc& pc, GmresWorkspace& ws, const IterativeSolverOptions& options = {})
+{
+    Internal::check_system(op, b, x);
+
+    const std::size_t len = b.size();
+    const std::size_t restart = (options.restart > 0) ? options.restart : 1;
+    ws.resize(len, restart);
+
+    const auto basis_vec = [&ws, len](const std::size_t idx){
+        return std::span<double>(ws.basis).subspan(idx * len, len);
+    };
+    const auto hess = [&ws, restart](const std::size_t row, const std::size_t col) -> double& {
+        return ws.hessenberg[(row * restart) + col];
+    };
+
+    const std::span<double> w(ws.w);
+    const std::span<double> z(ws.z);
+
+    const double b_norm = Internal::span_norm(b);
+    const double scale = (b_norm > 0.0) ? (1.0 / b_norm) : 1.0;
+
+    Internal::residual(op, b, x, w);
+    double beta = Internal::span_norm(w);
+    std::size_t iter = 0;
+
+    while ((beta * scale > options.tolerance) && (iter < options.max_iterations))
+    {
+        const std::span<double> v0 = basis_vec(0);
+
+        for (std::size_t idx = 0; idx < len; idx++)
+        {
+            v0[idx] = w[idx] / beta;
+        }
+
+        std::fill(ws.g.begin(), ws.g.end(), 0.0);
+        ws.g[0] = beta;
+        std::size_t steps = 0;
+
+        for (std::size_t jj = 0; (jj < restart) && (iter < options.max_iterations); jj++)
+        {
+            // w = A * M^-1 * v_j, orthogonalized against the basis
+            pc.apply(basis_vec(jj), z);
+            op.multiply(z, w);
+
+            for (std::size_t ii = 0; ii <= jj; ii++)
+            {
+                hess(ii, jj) = Internal::span_dot(w, basis_vec(ii));
+                Internal::span_axpy(-hess(ii, jj), basis_vec(ii), w);
+            }
+
+            const double w_norm = Internal::span_norm(w);
+            hess(jj + 1, jj) = w_norm;
+
+            if (w_norm > 0.0)
+            {
+                const std::span<double> v_next = basis_vec(jj + 1);
+
+                for (std::size_t idx = 0; idx < len; idx++)
+                {
+                    v_next[idx] = w[idx] / w_norm;
+                }
+            }
+
+            // apply previous rotations to the new column, then eliminate its subdiagonal
+            for (std::size_t ii = 0; ii < jj; ii++)
+            {
+                const double h_i = hess(ii, jj);
+                const double h_next = hess(ii + 1, jj);
+                hess(ii, jj) = (ws.cs[ii] * h_i) + (ws.sn[ii] * h_next);
+                hess(ii + 1, jj) = (ws.cs[ii] * h_next) - (ws.sn[ii] * h_i);
+            }
+
+            const double rho = std::hypot(hess(jj, jj), hess(jj + 1, jj));
+            ws.cs[jj] = (rho > 0.0) ? (hess(jj, jj) / rho) : 1.0;
+            ws.sn[jj] = (rho > 0.0) ? (hess(jj + 1, jj) / rho) : 0.0;
+            hess(jj, jj) = rho;
+            hess(jj + 1, jj) = 0.0;
+
+            ws.g[jj + 1] = -ws.sn[jj] * ws.g[jj];
+            ws.g[jj] *= ws.cs[jj];
+
+            iter++;
+            steps = jj + 1;
+
+            // lucky breakdown means the solution is in the current subspace
+            if ((std::abs(ws.g[jj + 1]) * scale <= options.tolerance) || !(w_norm > 0.0))
+            {
+                break;
+            }
+        }
+
+        // back substitution for y, then x += M^-1 * V * y
+        for (std::size_t ii = steps; ii-- > 0;)
+        {
+            double sum = ws.g[ii];
+
+            for (std::size_t kk = ii + 1; kk < steps; kk++)
+            {
+                sum -= hess(ii, kk) * ws.y[kk];
+            }
+
+            ws.y[ii] = sum / hess(ii, ii);
+        }
+
+        std::fill(w.begin(), w.end(), 0.0);
+
+        for (std::size_t ii = 0; ii < steps; ii++)
+        {
+            Internal::span_axpy(ws.y[ii], basis_vec(ii), w);
+        }
+
+        pc.apply(w, z);
+        Internal::span_axpy(1.0, z, x);
+
+        // recompute the true residual to avoid drift across restarts
+        Internal::residual(op, b, x, w);
+        beta = Internal::span_norm(w);
+    }
+
+    const double rel_res = beta * scale;
+    const IterativeSolverStatus status = (rel_res <= options.tolerance) ?
+        IterativeSolverStatus::Converged : IterativeSolverStatus::MaxIterations;
+
+    return {status, iter, rel_res};
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,414 @@
+/**
+ * @file least_squares.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Gauss-Newton and Levenberg-Marquardt nonlinear least squares.
+ */
+
+#pragma once
+
+#include "Internal/error_msg_helpers.h"
+#include "Internal/parallel_chunks.h"
+#include "LinAlg/cholesky.h"
+#include "LinAlg/elementwise.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/triangular.h"
+#include "LinAlg/Vector.h"
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace MathUtils {
+
+/**
+ * @brief Criteria for a least-squares problem with N unknowns and M residuals.
+ *
+ * @details Called as `problem(x, residual, jacobian)`, filling r(x) and J(x) = dr/dx.
+ *
+ * @tparam F Callable type.
+ * @tparam N Number of unknowns.
+ * @tparam M Number of residuals.
+ */
+template<typename F, std::size_t N, std::size_t M>
+concept least_squares_problem = requires(F& problem, const Vector<N>& x, Vector<M>& residual,
+    Matrix<M,N>& jacobian)
+{
+    problem(x, residual, jacobian);
+};
+
+/**
+ * @brief Criteria for one of many independent least-squares problems, selected by index.
+ *
+ * @details Called as `problem(idx, x, residual, jacobian)`.
+ *
+ * @tparam F Callable type.
+ * @tparam N Number of unknowns.
+ * @tparam M Number of residuals.
+ */
+template<typename F, std::size_t N, std::size_t M>
+concept least_squares_batch_problem = requires(F& problem, const std::size_t idx,
+    const Vector<N>& x, Vector<M>& residual, Matrix<M,N>& jacobian)
+{
+    problem(idx, x, residual, jacobian);
+};
+
+/**
+ * @brief Iteration used by least_squares().
+ */
+enum class LeastSquaresMethod {
+    GaussNewton,         ///< Undamped steps, always accepted. Fast near a well-conditioned solution.
+    LevenbergMarquardt,  ///< Damped steps, only accepted when the cost drops. Robust far away.
+};
+
+/**
+ * @brief Linear solve used for each step.
+ */
+enum class LeastSquaresStep {
+    Cholesky,  ///< Normal equations J^T * J. Cheapest, squares the condition number.
+    QR,        ///< Householder QR of J. More robust for ill-conditioned Jacobians.
+};
+
+/**
+ * @brief Least-squares solver settings.
+ */
+struct LeastSquaresOptions {
+    LeastSquaresMethod method = LeastSquaresMethod::LevenbergMarquardt;  ///< Iteration.
+    LeastSquaresStep step = LeastSquaresStep::Cholesky;  ///< Linear solve for each step.
+    std::size_t max_iterations = 50;  ///< Maximum iterations.
+    double gradient_tolerance = 1e-10;  ///< Stop when max |J^T * r| falls below this.
+    double step_tolerance = 1e-12;  ///< Stop when |dx| <= step_tolerance * (|x| + step_tolerance).
+    double initial_damping = 1e-3;  ///< Starting Levenberg-Marquardt damping.
+    double damping_factor = 10.0;  ///< Damping multiplier after a rejected step (divisor after accepted).
+};
+
+/**
+ * @brief Least-squares solver outcome.
+ *
+ * @tparam N Number of unknowns.
+ */
+template<std::size_t N>
+struct LeastSquaresResult {
+    Vector<N> x;  ///< Solution estimate.
+    double cost;  ///< 0.5 * |r(x)|^2.
+    std::size_t iterations;  ///< Iterations performed.
+    bool converged;  ///< A gradient or step tolerance was met.
+};
+
+/**
+ * @brief Preallocated temporaries for least_squares(), reused across iterations and solves.
+ *
+ * @tparam N Number of unknowns.
+ * @tparam M Number of residuals.
+ */
+template<std::size_t N, std::size_t M>
+struct LeastSquaresWorkspace {
+    Vector<M> residual;  ///< r(x).
+    Matrix<M,N> jacobian;  ///< J(x).
+    Vector<M> trial_residual;  ///< r(x + dx).
+    Matrix<M,N> trial_jacobian;  ///< J(x + dx).
+    Matrix<N,N> normal;  ///< J^T * J.
+    Matrix<N,N> chol;  ///< Cholesky factor of the damped normal matrix.
+    Vector<N> gradient;  ///< J^T * r.
+    Vector<N> scaling;  ///< Marquardt scaling D, the running maximum of diag(J^T * J).
+    Matrix<M + N, N + 1> augmented;  ///< [J, r; sqrt(lambda * D), 0] for QR steps.
+};
+
+namespace Internal {
+
+/**
+ * @brief Normal matrix J^T * J (upper triangle, mirrored) and gradient J^T * r.
+ */
+template<std::size_t N, std::size_t M>
+void normal_equations(const Matrix<M,N>& jac, const Vector<M>& res, Matrix<N,N>& normal,
+    Vector<N>& gradient) noexcept
+{
+    const double* const pj = jac.data();
+    const double* const pr = res.data();
+    double* const pn = normal.data();
+    double* const pg = gradient.data();
+
+    normal.fill(0.0);
+    gradient.fill(0.0);
+
+    // accumulate row by row so J is read contiguously
+    for (std::size_t kk = 0; kk < M; kk++)
+    {
+        const double* const row = pj + (kk * N);
+
+        for (std::size_t ii = 0; ii < N; ii++)
+        {
+            pg[ii] += row[ii] * pr[kk];
+
+            for (std::size_t jj = ii; jj < N; jj++)
+            {
+                pn[(ii * N) + jj] += row[ii] * row[jj];
+            }
+        }
+    }
+
+    for (std::size_t ii = 1; ii < N; ii++)
+    {
+        for (std::size_t jj = 0; jj < ii; jj++)
+        {
+            pn[(ii * N) + jj] = pn[(jj * N) + ii];
+        }
+    }
+}
+
+/**
+ * @brief Raise the Marquardt scaling to the current diag(J^T * J).
+ *
+ * @details As in MINPACK, D starts at diag(J^T * J) with zero entries replaced by one and never
+ * shrinks, so a parameter the residuals do not depend on still gets damped.
+ */
+template<std::size_t N, std::size_t M>
+void update_scaling(LeastSquaresWorkspace<N,M>& ws, const bool first) noexcept
+{
+    for (std::size_t ii = 0; ii < N; ii++)
+    {
+        const double diag = ws.normal(ii, ii);
+
+        if (first)
+        {
+            ws.scaling(ii) = (diag > 0.0) ? diag : 1.0;
+        }
+        else
+        {
+            ws.scaling(ii) = (diag > ws.scaling(ii)) ? diag : ws.scaling(ii);
+        }
+    }
+}
+
+/**
+ * @brief Solve (J^T * J + lambda * D) * dx = -J^T * r, D = ws.scaling. Returns false if singular.
+ */
+template<std::size_t N, std::size_t M>
+bool least_squares_step(LeastSquaresWorkspace<N,M>& ws, const double damping,
+    const LeastSquaresStep step, Vector<N>& dx) noexcept
+{
+    if (step == LeastSquaresStep::Cholesky)
+    {
+        ws.chol = ws.normal;
+
+        for (std::size_t ii = 0; ii < N; ii++)
+        {
+            ws.chol(ii, ii) += damping * ws.scaling(ii);
+        }
+
+        if (!cholesky_decompose(ws.chol, ws.chol))
+        {
+            return false;
+        }
+
+        dx = -1.0 * cholesky_solve(ws.chol, ws.gradient);
+        return true;
+    }
+
+    // minimize |[J; sqrt(lambda * D)] * dx + [r; 0]| by triangularizing [J, r; sqrt(lambda * D), 0]
+    double* const pa = ws.augmented.data();
+    const double* const pj = ws.jacobian.data();
+    constexpr std::size_t cols = N + 1;
+
+    ws.augmented.fill(0.0);
+
+    for (std::size_t kk = 0; kk < M; kk++)
+    {
+        for (std::size_t jj = 0; jj < N; jj++)
+        {
+            pa[(kk * cols) + jj] = pj[(kk * N) + jj];
+        }
+
+        pa[(kk * cols) + N] = ws.residual(kk);
+    }
+
+    for (std::size_t ii = 0; ii < N; ii++)
+    {
+        pa[((M + ii) * cols) + ii] = std::sqrt(damping * ws.scaling(ii));
+    }
+
+    qr_triangularize(ws.augmented);
+
+    // back substitution R * dx = -Q^T * r
+    for (std::size_t ii = N; ii-- > 0;)
+    {
+        const double r_ii = pa[(ii * cols) + ii];
+
+        if (!(r_ii > 0.0))
+        {
+            return false;
+        }
+
+        double sum = -pa[(ii * cols) + N];
+
+        for (std::size_t jj = ii + 1; jj < N; jj++)
+        {
+            sum -= pa[(ii * cols) + jj] * dx(jj);
+        }
+
+        dx(ii) = sum / r_ii;
+    }
+
+    return true;
+}
+
+}  // namespace Internal
+
+/**
+ * @brief Minimize 0.5 * |r(x)|^2 over x with Gauss-Newton or Levenberg-Marquardt.
+ *
+ * @details Damping is scaled by diag(J^T * J) (Marquardt's variant) so it is invariant to the
+ * units of each unknown. The scaling keeps the largest value seen for each unknown and starts at
+ * one for a zero Jacobian column, so an unobservable unknown does not leave every damped step
+ * singular. Problems with more than a few dozen unknowns should use the sparse
+ * iterative solvers instead of these dense steps.
+ *
+ * @tparam N Number of unknowns.
+ * @tparam M Number of residuals.
+ * @tparam F Problem type.
+ * @param problem Residual and Jacobian callback.
+ * @param x0 Initial guess.
+ * @param ws Workspace.
+ * @param options Solver settings.
+ * @return Solver outcome.
+ *
+ * @ref https://en.wikipedia.org/wiki/Levenberg%E2%80%93Marquardt_algorithm
+ */
+template<std::size_t N, std::size_t M, typename F>
+requires least_squares_problem<F, N, M> && (M >= N)
+LeastSquaresResult<N> least_squares(F&& problem, const Vector<N>& x0,
+    LeastSquaresWorkspace<N,M>& ws, const LeastSquaresOptions& options = {})
+{
+    const bool gauss_newton = (options.method == LeastSquaresMethod::GaussNewton);
+    double damping = gauss_newton ? 0.0 : options.initial_damping;
+
+    LeastSquaresResult<N> res {x0, 0.0, 0, false};
+    Vector<N> dx;
+
+    problem(res.x, ws.residual, ws.jacobian);
+    res.cost = 0.5 * dot(ws.residual, ws.residual);
+
+    while (res.iterations < options.max_iterations)
+    {
+        Internal::normal_equations(ws.jacobian, ws.residual, ws.normal, ws.gradient);
+        Internal::update_scaling(ws, res.iterations == 0);
+
+        if (norm_inf(ws.gradient) <= options.gradient_tolerance)
+        {
+            res.converged = true;
+            break;
+        }
+
+        res.iterations++;
+
+        if (!Internal::least_squares_step(ws, damping, options.step, dx))
+        {
+            if (gauss_newton)
+            {
+                break;
+            }
+
+            damping *= options.damping_factor;
+            continue;
+        }
+
+        const Vector<N> x_trial = res.x + dx;
+        problem(x_trial, ws.trial_residual, ws.trial_jacobian);
+        const double trial_cost = 0.5 * dot(ws.trial_residual, ws.trial_residual);
+
+        if (gauss_newton || (trial_cost < res.cost))
+        {
+            res.x = x_trial;
+            res.cost = trial_cost;
+            ws.residual = ws.trial_residual;
+            ws.jacobian = ws.trial_jacobian;
+            damping /= options.damping_factor;
+
+            if (dx.magnitude() <= options.step_tolerance * (res.x.magnitude() + options.step_tolerance))
+            {
+                res.converged = true;
+                break;
+            }
+        }
+        else
+        {
+            damping *= options.damping_factor;
+        }
+    }
+
+    return res;
+}
+
+/**
+ * @brief Minimize 0.5 * |r(x)|^2 with a temporary workspace.
+ *
+ * @tparam N Number of unknowns.
+ * @tparam M Number of residuals.
+ * @tparam F Problem type.
+ * @param problem Residual and Jacobian callback.
+ * @param x0 Initial guess.
+ * @param options Solver settings.
+ * @return Solver outcome.
+ */
+template<std::size_t N, std::size_t M, typename F>
+requires least_squares_problem<F, N, M> && (M >= N)
+LeastSquaresResult<N> least_squares(F&& problem, const Vector<N>& x0,
+    const LeastSquaresOptions& options = {})
+{
+    LeastSquaresWorkspace<N,M> ws;
+    return least_squares<N,M>(problem, x0, ws, options);
+}
+
+/**
+ * @brief Solve many independent small problems, e.g. one position fix per epoch.
+ *
+ * @details The problems are split into contiguous ranges, one per worker thread, and each worker
+ * reuses its own workspace. `problem` is called from several threads at once, so it must be safe
+ * to call concurrently for different indices. Results do not depend on the thread count.
+ *
+ * @tparam N Number of unknowns.
+ * @tparam M Number of residuals.
+ * @tparam F Problem type.
+ * @param problem Residual and Jacobian callback, given the problem index.
+ * @param x0 Initial guess for each problem.
+ * @param results Outcome for each problem. Same length as `x0`.
+ * @param options Solver settings.
+ * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency().
+ *
+ * @exception std::length_error Mismatched lengths.
+ */
+template<std::size_t N, std::size_t M, typename F>
+requires least_squares_batch_problem<F, N, M> && (M >= N)
+void least_squares_batch(F&& problem, std::span<const Vector<N>> x0,
+    std::span<LeastSquaresResult<N>> results, const LeastSquaresOptions& options = {},
+    const std::size_t num_threads = 0)
+{
+    if (x0.size() != results.size())
+    {
+        throw std::length_error(Internal::mismatched_length_error_msg(x0.size(), results.size()));
+    }
+
+    const std::size_t num_workers = Internal::worker_count(num_threads, x0.size());
+    std::vector<LeastSquaresWorkspace<N,M>> workspaces(num_workers);
+
+    Internal::parallel_chunks(x0.size(), num_workers,
+        [&](const std::size_t worker, const std::size_t first, const std::size_t last) {
+            LeastSquaresWorkspace<N,M>& ws = workspaces[worker];
+
+            for (std::size_t idx = first; idx < last; idx++)
+            {
+                results[idx] = least_squares<N,M>(
+                    [&problem, idx](const Vector<N>& x, Vector<M>& residual,
+                        Matrix<M,N>& jacobian){
+                        problem(idx, x, residual, jacobian);
+                    },
+                    x0[idx], ws, options
+                );
+            }
+        });
+}
+
+}  // namespace MathUtils
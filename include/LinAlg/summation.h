@@ -0,0 +1,157 @@
+/**
+ * @file summation.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Deterministic summation kernels used by vector and matrix reductions.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+
+namespace MathUtils {
+
+/**
+ * @brief Summation algorithm used by reductions.
+ */
+enum class SummationMode {
+    Pairwise,  ///< Fixed pairwise tree over blocks. Default.
+    Compensated  ///< Neumaier (improved Kahan-Babuska) compensated summation.
+};
+
+namespace Internal {
+
+/**
+ * @brief Number of terms summed sequentially at each leaf of the pairwise tree.
+ *
+ * @details Reductions of this many terms or fewer give the same result as a plain loop.
+ */
+constexpr std::size_t PAIRWISE_SUM_BLOCK_SIZE = 8;
+
+}  // namespace Internal
+
+/**
+ * @brief Sum `term(idx)` for idx in [first, last) with a fixed pairwise tree.
+ *
+ * @details The range is split on block boundaries that only depend on its length, and each
+ * block is summed sequentially. The association order is therefore fixed, so a vectorized or
+ * multithreaded evaluation of the same tree is bit-identical to this one. Rounding error grows
+ * with O(log n) instead of O(n).
+ *
+ * @tparam Term Callable `double(std::size_t)`.
+ * @param first First index.
+ * @param last One past the last index.
+ * @param term Returns the term at an index.
+ * @return Sum of all terms.
+ */
+template<typename Term>
+[[nodiscard]] double pairwise_sum(const std::size_t first, const std::size_t last, const Term& term)
+{
+    constexpr std::size_t block = Internal::PAIRWISE_SUM_BLOCK_SIZE;
+    const std::size_t len = last - first;
+
+    if (len <= block)
+    {
+        double sum = 0.0;
+
+        for (std::size_t idx = first; idx < last; idx++)
+        {
+            sum += term(idx);
+        }
+
+        return sum;
+    }
+
+    // split on a block boundary near the middle
+    std::size_t half = (len / (2 * block)) * block;
+    half = (half == 0) ? block : half;
+
+    return pairwise_sum(first, first + half, term) + pairwise_sum(first + half, last, term);
+}
+
+/**
+ * @brief Sum values with a fixed pairwise tree.
+ *
+ * @param vals Values to sum.
+ * @return Sum of all values.
+ */
+[[nodiscard]] inline double pairwise_sum(const std::span<const double> vals)
+{
+    return pairwise_sum(0, vals.size(), [vals](const std::size_t idx){return vals[idx];});
+}
+
+/**
+ * @brief Sum `term(idx)` for idx in [first, last) with Neumaier compensated summation.
+ *
+ * @details Tracks the rounding error of each addition and adds it back at the end. Error is
+ * independent of the number of terms, at roughly four times the cost of a plain loop.
+ *
+ * @tparam Term Callable `double(std::size_t)`.
+ * @param first First index.
+ * @param last One past the last index.
+ * @param term Returns the term at an index.
+ * @return Sum of all terms.
+ *
+ * @ref https://en.wikipedia.org/wiki/Kahan_summation_algorithm#Further_enhancements
+ */
+template<typename Term>
+[[nodiscard]] double compensated_sum(const std::size_t first, const std::size_t last,
+    const Term& term)
+{
+    double sum = 0.0;
+    double compensation = 0.0;
+
+    for (std::size_t idx = first; idx < last; idx++)
+    {
+        const double val = term(idx);
+        const double tmp = sum + val;
+
+        if (std::abs(sum) >= std::abs(val))
+        {
+            compensation += (sum - tmp) + val;
+        }
+        else
+        {
+            compensation += (val - tmp) + sum;
+        }
+
+        sum = tmp;
+    }
+
+    return sum + compensation;
+}
+
+/**
+ * @brief Sum values with Neumaier compensated summation.
+ *
+ * @param vals Values to sum.
+ * @return Sum of all values.
+ */
+[[nodiscard]] inline double compensated_sum(const std::span<const double> vals)
+{
+    return compensated_sum(0, vals.size(), [vals](const std::size_t idx){return vals[idx];});
+}
+
+/**
+ * @brief Sum `term(idx)` for idx in [0, len) with the selected algorithm.
+ *
+ * @tparam Term Callable `double(std::size_t)`.
+ * @param len Number of terms.
+ * @param term Returns the term at an index.
+ * @param mode Summation algorithm.
+ * @return Sum of all terms.
+ */
+template<typename Term>
+[[nodiscard]] double summation(const std::size_t len, const Term& term, const SummationMode mode)
+{
+    if (mode == SummationMode::Compensated)
+    {
+        return compensated_sum(0, len, term);
+    }
+
+    return pairwise_sum(0, len, term);
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,634 @@
+/**
+ * @file triangular.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Packed triangular matrices and QR-based factor updates for square-root filters.
+ *
+ * @details Square-root information filters (SRIF) keep an upper-triangular R with R^T * R = P^-1
+ * instead of P. Measurement updates stack R on top of the whitened measurement rows and
+ * re-triangularize them with orthogonal transformations, which never squares the condition number.
+ */
+
+#pragma once
+
+#include "Internal/error_msg_helpers.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/Vector.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+namespace MathUtils {
+
+/**
+ * @brief Which triangle of a square matrix is stored.
+ */
+enum class Triangle {
+    Lower,  ///< Elements on and below the diagonal.
+    Upper,  ///< Elements on and above the diagonal.
+};
+
+/**
+ * @brief Square triangular matrix with only the nonzero triangle stored.
+ *
+ * @details Rows of the triangle are packed back-to-back in row-major order, so an N x N triangle
+ * takes N * (N + 1) / 2 doubles: 45 instead of 81 for N = 9, and 231 instead of 441 for N = 21.
+ * Each stored row is contiguous, which keeps the multiply and solve inner loops unit-stride. All
+ * elements are zero at initialization.
+ *
+ * @tparam N Matrix dimension.
+ * @tparam TRI Stored triangle.
+ */
+template<std::size_t N, Triangle TRI>
+requires valid_matrix_dims<N, N>
+class PackedTriangular {
+public:
+    static constexpr std::size_t num_stored = (N * (N + 1)) / 2;  ///< Number of stored elements.
+
+    PackedTriangular() = default;
+
+    ~PackedTriangular() = default;
+
+    /**
+     * @brief Copy the stored triangle out of a full matrix. The other triangle is ignored.
+     *
+     * @param mat Full matrix.
+     */
+    explicit PackedTriangular(const Matrix<N,N>& mat)
+    {
+        const double* const pm = mat.data();
+
+        for (std::size_t ii = 0; ii < N; ii++)
+        {
+            for (std::size_t jj = row_begin(ii); jj < row_end(ii); jj++)
+            {
+                m_arr[packed_index(ii, jj)] = pm[(ii * N) + jj];
+            }
+        }
+    }
+
+    PackedTriangular(const PackedTriangular& other) = default;
+
+    PackedTriangular(PackedTriangular&& other) noexcept = default;
+
+    PackedTriangular& operator=(const PackedTriangular& other) = default;
+
+    PackedTriangular& operator=(PackedTriangular&& other) noexcept = default;
+
+    /**
+     * @brief Get a matrix element. Elements outside the stored triangle are zero.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Matrix element at specified index.
+     *
+     * @exception std::out_of_range Invalid matrix index.
+     */
+    [[nodiscard]] double operator()(const std::size_t row, const std::size_t col) const
+    {
+        if ((row >= N) || (col >= N))
+        {
+            throw std::out_of_range(Internal::invalid_index_error_msg(row, col, N, N));
+        }
+
+        return in_triangle(row, col) ? m_arr[packed_index(row, col)] : 0.0;
+    }
+
+    /**
+     * @brief Access a stored matrix element.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Matrix element at specified index.
+     *
+     * @exception std::out_of_range Invalid index, or index outside the stored triangle.
+     */
+    [[nodiscard]] double& at(const std::size_t row, const std::size_t col)
+    {
+        check_index(row, col);
+        return m_arr[packed_index(row, col)];
+    }
+
+    /**
+     * @brief Get a stored matrix element.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return Matrix element at specified index.
+     *
+     * @exception std::out_of_range Invalid index, or index outside the stored triangle.
+     */
+    [[nodiscard]] const double& at(const std::size_t row, const std::size_t col) const
+    {
+        check_index(row, col);
+        return m_arr[packed_index(row, col)];
+    }
+
+    /**
+     * @brief Access the packed element storage.
+     *
+     * @return Pointer to the first element.
+     */
+    [[nodiscard]] double* data() noexcept
+    {
+        return m_arr.data();
+    }
+
+    /**
+     * @brief Get the packed element storage.
+     *
+     * @return Pointer to the first element.
+     */
+    [[nodiscard]] const double* data() const noexcept
+    {
+        return m_arr.data();
+    }
+
+    /**
+     * @brief Expand to a full matrix with zeros outside the stored triangle.
+     *
+     * @return Full matrix.
+     */
+    [[nodiscard]] Matrix<N,N> to_matrix() const
+    {
+        Matrix<N,N> res;
+        double* const pres = res.data();
+
+        for (std::size_t ii = 0; ii < N; ii++)
+        {
+            for (std::size_t jj = row_begin(ii); jj < row_end(ii); jj++)
+            {
+                pres[(ii * N) + jj] = m_arr[packed_index(ii, jj)];
+            }
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief Check if an index is inside the stored triangle.
+     *
+     * @param row Row index.
+     * @param col Column index.
+     * @return True if the element is stored.
+     */
+    [[nodiscard]] static constexpr bool in_triangle(const std::size_t row,
+        const std::size_t col) noexcept
+    {
+        return (TRI == Triangle::Lower) ? (col <= row) : (row <= col);
+    }
+
+    /**
+     * @brief First stored column of a row.
+     *
+     * @param row Row index.
+     * @return Column index.
+     */
+    [[nodiscard]] static constexpr std::size_t row_begin(const std::size_t row) noexcept
+    {
+        return (TRI == Triangle::Lower) ? 0 : row;
+    }
+
+    /**
+     * @brief One past the last stored column of a row.
+     *
+     * @param row Row index.
+     * @return Column index.
+     */
+    [[nodiscard]] static constexpr std::size_t row_end(const std::size_t row) noexcept
+    {
+        return (TRI == Triangle::Lower) ? (row + 1) : N;
+    }
+
+    /**
+     * @brief Position of a stored element in the packed storage.
+     *
+     * @param row Row index.
+     * @param col Column index. Must be inside the stored triangle.
+     * @return Packed index.
+     */
+    [[nodiscard]] static constexpr std::size_t packed_index(const std::size_t row,
+        const std::size_t col) noexcept
+    {
+        if constexpr (TRI == Triangle::Lower)
+        {
+            return ((row * (row + 1)) / 2) + col;
+        }
+        else
+        {
+            return ((row * ((2 * N) - row + 1)) / 2) + (col - row);
+        }
+    }
+
+private:
+    void check_index(const std::size_t row, const std::size_t col) const
+    {
+        if ((row >= N) || (col >= N) || !in_triangle(row, col))
+        {
+            throw std::out_of_range(Internal::invalid_index_error_msg(row, col, N, N));
+        }
+    }
+
+    std::array<double, num_stored> m_arr {0};  ///< Packed triangle.
+};
+
+/**
+ * @brief Packed lower-triangular matrix.
+ *
+ * @tparam N Matrix dimension.
+ */
+template<std::size_t N>
+using LowerTriangular = PackedTriangular<N, Triangle::Lower>;
+
+/**
+ * @brief Packed upper-triangular matrix.
+ *
+ * @tparam N Matrix dimension.
+ */
+template<std::size_t N>
+using UpperTriangular = PackedTriangular<N, Triangle::Upper>;
+
+// =================================================================================================
+// MULTIPLY AND SOLVE
+// =================================================================================================
+
+/**
+ * @brief Transpose a triangular matrix. Lower becomes upper and vice versa.
+ *
+ * @tparam N Matrix dimension.
+ * @tparam TRI Stored triangle.
+ * @param tri Triangular matrix.
+ * @return Transposed matrix.
+ */
+template<std::size_t N, Triangle TRI>
+[[nodiscard]] auto transpose(const PackedTriangular<N, TRI>& tri)
+{
+    constexpr Triangle other = (TRI == Triangle::Lower) ? Triangle::Upper : Triangle::Lower;
+    using Tri = PackedTriangular<N, TRI>;
+    using Res = PackedTriangular<N, other>;
+
+    Res res;
+    const double* const pt = tri.data();
+    double* const pres = res.data();
+
+    for (std::size_t ii = 0; ii < N; ii++)
+    {
+        for (std::size_t jj = Tri::row_begin(ii); jj < Tri::row_end(ii); jj++)
+        {
+            pres[Res::packed_index(jj, ii)] = pt[Tri::packed_index(ii, jj)];
+        }
+    }
+
+    return res;
+}
+
+/**
+ * @brief Triangular matrix-vector product.
+ *
+ * @tparam N Matrix dimension.
+ * @tparam TRI Stored triangle.
+ * @param tri Triangular matrix.
+ * @param vec Vector.
+ * @return tri * vec.
+ */
+template<std::size_t N, Triangle TRI>
+[[nodiscard]] Vector<N> operator*(const PackedTriangular<N, TRI>& tri, const Vector<N>& vec)
+{
+    using Tri = PackedTriangular<N, TRI>;
+
+    Vector<N> res;
+    const double* const pt = tri.data();
+    const double* const pv = vec.data();
+    double* const pres = res.data();
+
+    for (std::size_t ii = 0; ii < N; ii++)
+    {
+        const double* const row = pt + Tri::packed_index(ii, Tri::row_begin(ii));
+        double sum = 0.0;
+
+        for (std::size_t jj = Tri::row_begin(ii); jj < Tri::row_end(ii); jj++)
+        {
+            sum += row[jj - Tri::row_begin(ii)] * pv[jj];
+        }
+
+        pres[ii] = sum;
+    }
+
+    return res;
+}
+
+/**
+ * @brief Triangular matrix-matrix product.
+ *
+ * @tparam N Rows.
+ * @tparam M Columns of `mat`.
+ * @tparam TRI Stored triangle.
+ * @param tri Triangular matrix.
+ * @param mat Matrix.
+ * @return tri * mat.
+ */
+template<std::size_t N, std::size_t M, Triangle TRI>
+[[nodiscard]] Matrix<N,M> operator*(const PackedTriangular<N, TRI>& tri, const Matrix<N,M>& mat)
+{
+    using Tri = PackedTriangular<N, TRI>;
+
+    Matrix<N,M> res;
+    const double* const pt = tri.data();
+    const double* const pm = mat.data();
+    double* const pres = res.data();
+
+    // i-k-j order so the innermost loop streams rows of `mat` and `res`
+    for (std::size_t ii = 0; ii < N; ii++)
+    {
+        for (std::size_t kk = Tri::row_begin(ii); kk < Tri::row_end(ii); kk++)
+        {
+            const double t_ik = pt[Tri::packed_index(ii, kk)];
+
+            for (std::size_t jj = 0; jj < M; jj++)
+            {
+                pres[(ii * M) + jj] += t_ik * pm[(kk * M) + jj];
+            }
+        }
+    }
+
+    return res;
+}
+
+/**
+ * @brief Solve tri * x = b by forward (lower) or back (upper) substitution.
+ *
+ * @tparam N Matrix dimension.
+ * @tparam TRI Stored triangle.
+ * @param tri Triangular matrix with a nonzero diagonal.
+ * @param b Right-hand side.
+ * @return Solution x.
+ */
+template<std::size_t N, Triangle TRI>
+[[nodiscard]] Vector<N> solve(const PackedTriangular<N, TRI>& tri, const Vector<N>& b)
+{
+    using Tri = PackedTriangular<N, TRI>;
+
+    Vector<N> x(b);
+    const double* const pt = tri.data();
+    double* const px = x.data();
+
+    for (std::size_t step = 0; step < N; step++)
+    {
+        const std::size_t ii = (TRI == Triangle::Lower) ? step : (N - 1 - step);
+        const std::size_t off_begin = (TRI == Triangle::Lower) ? 0 : (ii + 1);
+        const std::size_t off_end = (TRI == Triangle::Lower) ? ii : N;
+        double sum = px[ii];
+
+        for (std::size_t jj = off_begin; jj < off_end; jj++)
+        {
+            sum -= pt[Tri::packed_index(ii, jj)] * px[jj];
+        }
+
+        px[ii] = sum / pt[Tri::packed_index(ii, ii)];
+    }
+
+    return x;
+}
+
+/**
+ * @brief Solve tri^T * x = b without forming the transpose.
+ *
+ * @details Column-oriented substitution so the stored rows are still read contiguously.
+ *
+ * @tparam N Matrix dimension.
+ * @tparam TRI Stored triangle.
+ * @param tri Triangular matrix with a nonzero diagonal.
+ * @param b Right-hand side.
+ * @return Solution x.
+ */
+template<std::size_t N, Triangle TRI>
+[[nodiscard]] Vector<N> solve_transposed(const PackedTriangular<N, TRI>& tri, const Vector<N>& b)
+{
+    using Tri = PackedTriangular<N, TRI>;
+
+    Vector<N> x(b);
+    const double* const pt = tri.data();
+    double* const px = x.data();
+
+    // tri^T is upper for a lower `tri`, so walk the rows of `tri` from the bottom
+    for (std::size_t step = 0; step < N; step++)
+    {
+        const std::size_t ii = (TRI == Triangle::Lower) ? (N - 1 - step) : step;
+        const std::size_t off_begin = (TRI == Triangle::Lower) ? 0 : (ii + 1);
+        const std::size_t off_end = (TRI == Triangle::Lower) ? ii : N;
+        px[ii] /= pt[Tri::packed_index(ii, ii)];
+        const double xi = px[ii];
+
+        for (std::size_t jj = off_begin; jj < off_end; jj++)
+        {
+            px[jj] -= pt[Tri::packed_index(ii, jj)] * xi;
+        }
+    }
+
+    return x;
+}
+
+// =================================================================================================
+// QR FACTOR UPDATES
+// =================================================================================================
+
+/**
+ * @brief Reduce a matrix to upper-triangular form in place with Householder reflections.
+ *
+ * @details Computes A = Q * R and overwrites `a` with R, zeroing everything below the diagonal. Q
+ * is not formed. Rows are sign-adjusted so the diagonal of R is non-negative, which makes R the
+ * transposed Cholesky factor of A^T * A when A has full column rank.
+ *
+ * Stack a prior square-root factor on top of new rows (e.g. [R; H] in an SRIF, or [U * F^T; U_q]
+ * in a square-root covariance time update) and call this to get the updated factor.
+ *
+ * @tparam R Rows.
+ * @tparam C Columns.
+ * @param a Matrix to triangularize.
+ *
+ * @ref https://en.wikipedia.org/wiki/QR_decomposition#Using_Householder_reflections
+ */
+template<std::size_t R, std::size_t C>
+void qr_triangularize(Matrix<R,C>& a)
+{
+    constexpr std::size_t steps = (R - 1 < C) ? (R - 1) : C;
+
+    double* const pa = a.data();
+    std::array<double, C> w {};
+
+    for (std::size_t kk = 0; kk < steps; kk++)
+    {
+        double norm_sq = 0.0;
+
+        for (std::size_t ii = kk; ii < R; ii++)
+        {
+            norm_sq += pa[(ii * C) + kk] * pa[(ii * C) + kk];
+        }
+
+        const double x0 = pa[(kk * C) + kk];
+        const double alpha = (x0 < 0.0) ? std::sqrt(norm_sq) : -std::sqrt(norm_sq);
+        const double v0 = x0 - alpha;
+        const double vtv = norm_sq - (x0 * x0) + (v0 * v0);
+
+        if (vtv > 0.0)
+        {
+            // Householder vector is v = [v0, a(kk+1:R, kk)]; w = v^T * A(kk:R, kk+1:C)
+            for (std::size_t jj = kk + 1; jj < C; jj++)
+            {
+                w[jj] = v0 * pa[(kk * C) + jj];
+            }
+
+            for (std::size_t ii = kk + 1; ii < R; ii++)
+            {
+                const double vi = pa[(ii * C) + kk];
+
+                for (std::size_t jj = kk + 1; jj < C; jj++)
+                {
+                    w[jj] += vi * pa[(ii * C) + jj];
+                }
+            }
+
+            // A -= (2 / v^T v) * v * w^T
+            const double beta = 2.0 / vtv;
+
+            for (std::size_t jj = kk + 1; jj < C; jj++)
+            {
+                pa[(kk * C) + jj] -= beta * v0 * w[jj];
+            }
+
+            for (std::size_t ii = kk + 1; ii < R; ii++)
+            {
+                const double bvi = beta * pa[(ii * C) + kk];
+
+                for (std::size_t jj = kk + 1; jj < C; jj++)
+                {
+                    pa[(ii * C) + jj] -= bvi * w[jj];
+                }
+
+                pa[(ii * C) + kk] = 0.0;
+            }
+
+            pa[(kk * C) + kk] = alpha;
+        }
+
+        // row kk is final from here on
+        if (pa[(kk * C) + kk] < 0.0)
+        {
+            for (std::size_t jj = kk; jj < C; jj++)
+            {
+                pa[(kk * C) + jj] = -pa[(kk * C) + jj];
+            }
+        }
+    }
+
+    // a square matrix has one more diagonal element with nothing below it to reflect
+    if constexpr (R <= C)
+    {
+        if (pa[((R - 1) * C) + (R - 1)] < 0.0)
+        {
+            for (std::size_t jj = R - 1; jj < C; jj++)
+            {
+                pa[((R - 1) * C) + jj] = -pa[((R - 1) * C) + jj];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Upper-triangular R factor of a tall matrix, R^T * R = A^T * A.
+ *
+ * @tparam R Rows. At least `C`.
+ * @tparam C Columns.
+ * @param a Matrix.
+ * @return R factor with a non-negative diagonal.
+ */
+template<std::size_t R, std::size_t C>
+requires (R >= C)
+[[nodiscard]] UpperTriangular<C> qr_r_factor(Matrix<R,C> a)
+{
+    qr_triangularize(a);
+
+    UpperTriangular<C> res;
+    const double* const pa = a.data();
+    double* const pres = res.data();
+
+    for (std::size_t ii = 0; ii < C; ii++)
+    {
+        for (std::size_t jj = ii; jj < C; jj++)
+        {
+            pres[UpperTriangular<C>::packed_index(ii, jj)] = pa[(ii * C) + jj];
+        }
+    }
+
+    return res;
+}
+
+/**
+ * @brief Add one row to a square-root factor in place, so that R'^T * R' = R^T * R + a * a^T.
+ *
+ * @details Rotates the row into R with N Givens rotations, O(N^2), directly on the packed storage.
+ * This is an SRIF scalar measurement update when `row` is the whitened measurement row (append
+ * the whitened residual as an extra column of the system to carry the information vector along).
+ *
+ * @tparam N Matrix dimension.
+ * @param r Upper-triangular factor with a non-negative diagonal. Updated in place.
+ * @param row Row to add.
+ *
+ * @ref https://en.wikipedia.org/wiki/Givens_rotation
+ */
+template<std::size_t N>
+void qr_update(UpperTriangular<N>& r, Vector<N> row)
+{
+    using Tri = UpperTriangular<N>;
+
+    double* const pr = r.data();
+    double* const px = row.data();
+
+    for (std::size_t kk = 0; kk < N; kk++)
+    {
+        double* const r_row = pr + Tri::packed_index(kk, kk);
+        const double rho = std::hypot(r_row[0], px[kk]);
+
+        if (!(rho > 0.0))
+        {
+            continue;
+        }
+
+        const double c = r_row[0] / rho;
+        const double s = px[kk] / rho;
+        r_row[0] = rho;
+
+        for (std::size_t jj = kk + 1; jj < N; jj++)
+        {
+            const double r_kj = r_row[jj - kk];
+            r_row[jj - kk] = (c * r_kj) + (s * px[jj]);
+            px[jj] = (c * px[jj]) - (s * r_kj);
+        }
+    }
+}
+
+/**
+ * @brief Add several rows to a square-root factor in place, R'^T * R' = R^T * R + A^T * A.
+ *
+ * @tparam N Matrix dimension.
+ * @tparam M Number of rows to add.
+ * @param r Upper-triangular factor with a non-negative diagonal. Updated in place.
+ * @param rows Rows to add.
+ */
+template<std::size_t N, std::size_t M>
+void qr_update(UpperTriangular<N>& r, const Matrix<M,N>& rows)
+{
+    const double* const pa = rows.data();
+
+    for (std::size_t ii = 0; ii < M; ii++)
+    {
+        Vector<N> row;
+        std::copy(pa + (ii * N), pa + ((ii + 1) * N), row.data());
+        qr_update(r, row);
+    }
+}
+
+}  // namespace MathUtils
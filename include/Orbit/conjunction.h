@@ -0,0 +1,75 @@
+/**
+ * @file conjunction.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Close-approach screening of a satellite catalog.
+ */
+
+#pragma once
+
+#include "Orbit/orbital_elements.h"
+#include "Orbit/propagate.h"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace MathUtils {
+
+/**
+ * @brief Options for screen_conjunctions().
+ */
+struct ConjunctionOptions {
+    double threshold_m = 5'000.0;  ///< Report approaches with a miss distance below this [m].
+    double step_s = 10.0;  ///< Sampling step; smaller steps give smaller hash cells [s].
+    double time_tolerance_s = 1e-3;  ///< Time of closest approach tolerance [s].
+    OrbitModel model = OrbitModel::J2Secular;  ///< Force model used to propagate the catalog.
+};
+
+/**
+ * @brief One close approach between two catalog objects.
+ */
+struct Conjunction {
+    std::size_t primary;  ///< Catalog index of the first object.
+    std::size_t secondary;  ///< Catalog index of the second object, greater than `primary`.
+    double tca_s;  ///< Time of closest approach, relative to the catalog epoch [s].
+    double miss_distance_m;  ///< Distance at closest approach [m].
+    double relative_speed_mps;  ///< Relative speed at closest approach [m/s].
+};
+
+/**
+ * @brief Find every close approach between catalog objects within a time window.
+ *
+ * @details The window is sampled every `step_s`. At each sample the catalog is propagated into a
+ * reused state buffer, so memory is linear in the catalog size no matter how long the window is.
+ * Objects are hashed into a uniform grid, sorted by cell, and only pairs in neighboring cells are
+ * examined. Cells are sized from the threshold plus the farthest two objects can close in half a
+ * step, so no approach inside a sample's half-step interval is missed. Pairs whose perigee-apogee
+ * shells are farther apart than the threshold are skipped without a distance check.
+ *
+ * Each surviving pair whose range rate turns from negative to non-negative inside the sample's
+ * interval is refined to the time of closest approach with a bracketed root search on the range
+ * rate. Closest approaches at the window boundaries, where the range is still decreasing or
+ * already increasing, are not reported.
+ *
+ * Sample intervals partition the window, so disjoint windows report disjoint conjunctions. Within
+ * each sample, the candidate pairs of contiguous ranges of objects are checked on worker threads
+ * against the shared sorted cells. The result does not depend on the thread count.
+ *
+ * @param catalog Orbital elements of each object at the catalog epoch.
+ * @param start_s Window start, relative to the catalog epoch [s].
+ * @param duration_s Window length [s].
+ * @param options Screening options.
+ * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency(), with at least 256
+ * objects per worker.
+ * @return Conjunctions sorted by time of closest approach.
+ *
+ * @exception std::invalid_argument The threshold, step, or duration is not positive.
+ */
+[[nodiscard]] std::vector<Conjunction> screen_conjunctions(std::span<const OrbitalElements> catalog,
+    const double start_s,
+    const double duration_s,
+    const ConjunctionOptions& options = ConjunctionOptions {},
+    const std::size_t num_threads = 0);
+
+}  // namespace MathUtils
@@ -0,0 +1,205 @@
+/**
+ * @file ephemeris.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Low-precision analytic Sun and Moon ephemerides.
+ */
+
+#pragma once
+
+#include "LinAlg/Vector.h"
+#include "Time/Epoch.h"
+
+#include <cstddef>
+#include <span>
+
+namespace MathUtils {
+
+/**
+ * @brief Body evaluated by the batched ephemeris functions.
+ */
+enum class EphemerisBody {
+    Sun,  ///< Sun, about 0.01 deg in direction.
+    Moon  ///< Moon, about 0.3 deg in direction and 1000 km in range.
+};
+
+/**
+ * @brief Greenwich mean sidereal time.
+ *
+ * @details Earth rotation angle plus the IAU 2006 precession polynomial. Evaluated from the
+ * two-part epoch, so the angle keeps full precision decades from J2000.
+ *
+ * @ref IERS Conventions (2010), equations 5.15 and 5.32.
+ *
+ * @param ut1 Epoch in UT1. UTC is within 0.9 s of UT1.
+ * @return Sidereal angle in [0, 2pi) [rad].
+ */
+[[nodiscard]] double greenwich_mean_sidereal_time(const Epoch& ut1) noexcept;
+
+/**
+ * @brief Geocentric Sun position from the Astronomical Almanac low-precision series.
+ *
+ * @ref Vallado, D. A., "Fundamentals of Astrodynamics and Applications", 4th ed., Algorithm 29.
+ *
+ * @param tt Epoch in TT.
+ * @return Sun position in the mean equator and equinox of date [m].
+ */
+[[nodiscard]] Vector<3> sun_position_eci(const Epoch& tt) noexcept;
+
+/**
+ * @brief Geocentric Moon position from the Astronomical Almanac low-precision series.
+ *
+ * @ref Vallado, D. A., "Fundamentals of Astrodynamics and Applications", 4th ed., Algorithm 31.
+ *
+ * @param tt Epoch in TT.
+ * @return Moon position in the mean equator and equinox of date [m].
+ */
+[[nodiscard]] Vector<3> moon_position_eci(const Epoch& tt) noexcept;
+
+/**
+ * @brief Sun position in ECEF.
+ *
+ * @details Converts to TT with the built-in leap-second table for the series and rotates by
+ * greenwich_mean_sidereal_time(), taking UT1 as UTC. Nutation and polar motion are below the
+ * series error and are ignored.
+ *
+ * @param utc Epoch in UTC.
+ * @return Sun position in ECEF [m].
+ */
+[[nodiscard]] Vector<3> sun_position_ecef(const Epoch& utc);
+
+/**
+ * @brief Moon position in ECEF.
+ *
+ * @param utc Epoch in UTC.
+ * @return Moon position in ECEF [m].
+ *
+ * @see sun_position_ecef()
+ */
+[[nodiscard]] Vector<3> moon_position_ecef(const Epoch& utc);
+
+/**
+ * @brief Evaluate an ephemeris at an array of epochs.
+ *
+ * @details The series have no branches, so the loop over epochs is a straight run of
+ * multiply-adds and trig calls.
+ *
+ * @param body Body to evaluate.
+ * @param tt Epochs in TT.
+ * @param pos_eci_m Output positions in the mean equator and equinox of date [m].
+ *
+ * @exception std::length_error `tt` and `pos_eci_m` have different lengths.
+ */
+void ephemeris_eci(const EphemerisBody body,
+    std::span<const Epoch> tt,
+    std::span<Vector<3>> pos_eci_m);
+
+/**
+ * @brief Evaluate an ephemeris in ECEF at an array of epochs.
+ *
+ * @details One leap-second cursor is reused across the array.
+ *
+ * @param body Body to evaluate.
+ * @param utc Epochs in UTC.
+ * @param pos_ecef_m Output positions in ECEF [m].
+ *
+ * @exception std::length_error `utc` and `pos_ecef_m` have different lengths.
+ *
+ * @see sun_position_ecef()
+ */
+void ephemeris_ecef(const EphemerisBody body,
+    std::span<const Epoch> utc,
+    std::span<Vector<3>> pos_ecef_m);
+
+/**
+ * @brief Last-epoch cache of the Sun and Moon positions.
+ *
+ * @details Models that query the same epoch several times per step (eclipse checks, sun sensors,
+ * panel pointing) share one evaluation. Each body and frame keeps its own last epoch, so
+ * alternating Sun and Moon queries still hit. Not thread-safe; use one cache per thread.
+ */
+class EphemerisCache {
+public:
+    /**
+     * @brief Create a cache.
+     *
+     * @param tolerance_s Epochs closer than this to the cached one reuse its result [s].
+     */
+    explicit EphemerisCache(const double tolerance_s = 0.0) noexcept
+        :m_tolerance_s{tolerance_s}
+    {}
+
+    /**
+     * @brief Sun position in the mean equator and equinox of date.
+     *
+     * @param tt Epoch in TT.
+     * @return Sun position [m].
+     */
+    [[nodiscard]] const Vector<3>& sun_eci(const Epoch& tt);
+
+    /**
+     * @brief Moon position in the mean equator and equinox of date.
+     *
+     * @param tt Epoch in TT.
+     * @return Moon position [m].
+     */
+    [[nodiscard]] const Vector<3>& moon_eci(const Epoch& tt);
+
+    /**
+     * @brief Sun position in ECEF.
+     *
+     * @param utc Epoch in UTC.
+     * @return Sun position [m].
+     */
+    [[nodiscard]] const Vector<3>& sun_ecef(const Epoch& utc);
+
+    /**
+     * @brief Moon position in ECEF.
+     *
+     * @param utc Epoch in UTC.
+     * @return Moon position [m].
+     */
+    [[nodiscard]] const Vector<3>& moon_ecef(const Epoch& utc);
+
+    /**
+     * @brief Get the number of series evaluations so far.
+     *
+     * @return Cache misses.
+     */
+    [[nodiscard]] std::size_t num_evaluations() const noexcept
+    {
+        return m_num_evaluations;
+    }
+
+protected:
+private:
+    /**
+     * @brief Cached result for one body and frame.
+     */
+    struct Entry {
+        Epoch epoch;  ///< Epoch of `position_m`.
+        Vector<3> position_m;  ///< Cached position [m].
+        bool valid = false;  ///< True once `position_m` is set.
+    };
+
+    /**
+     * @brief Look up an entry, evaluating on a miss.
+     *
+     * @tparam F Callable taking an Epoch and returning a position.
+     * @param entry Cache slot.
+     * @param epoch Query epoch.
+     * @param evaluate Ephemeris to call on a miss.
+     * @return Cached position [m].
+     */
+    template<typename F>
+    const Vector<3>& lookup(Entry& entry, const Epoch& epoch, F evaluate);
+
+    double m_tolerance_s;  ///< Reuse tolerance [s].
+    std::size_t m_num_evaluations {0};  ///< Cache misses.
+    Entry m_sun_eci;  ///< Sun, mean of date.
+    Entry m_moon_eci;  ///< Moon, mean of date.
+    Entry m_sun_ecef;  ///< Sun, ECEF.
+    Entry m_moon_ecef;  ///< Moon, ECEF.
+};
+
+}  // namespace MathUtils
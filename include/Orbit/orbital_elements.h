@@ -0,0 +1,108 @@
+/**
+ * @file orbital_elements.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Keplerian orbital elements, Kepler's equation, and element/state conversions.
+ */
+
+#pragma once
+
+#include "constants.h"
+#include "LinAlg/Vector.h"
+
+#include <cstddef>
+#include <span>
+
+namespace MathUtils {
+
+/**
+ * @brief Classical elements of an elliptical orbit.
+ *
+ * @details Angles are in the inertial frame of the state they describe (e.g. ECI). Mean anomaly is
+ * stored rather than true anomaly so propagation is a linear update.
+ */
+struct OrbitalElements {
+    double semi_major_axis_m;  ///< Semi-major axis [m].
+    double eccentricity;  ///< Eccentricity, in [0, 1).
+    double inclination_rad;  ///< Inclination [rad].
+    double raan_rad;  ///< Right ascension of the ascending node [rad].
+    double arg_perigee_rad;  ///< Argument of perigee [rad].
+    double mean_anomaly_rad;  ///< Mean anomaly [rad].
+};
+
+/**
+ * @brief Inertial position and velocity.
+ */
+struct OrbitState {
+    Vector<3> position_m;  ///< Position [m].
+    Vector<3> velocity_mps;  ///< Velocity [m/s].
+};
+
+/**
+ * @brief Halley iterations used by solve_kepler().
+ *
+ * @details With the Danby starting guess, five iterations reach machine precision for every mean
+ * anomaly when the eccentricity is at most 0.99.
+ */
+constexpr inline std::size_t KEPLER_ITERATIONS = 5;
+
+/**
+ * @brief Solve Kepler's equation, M = E - e sin(E), for the eccentric anomaly.
+ *
+ * @details Runs a fixed KEPLER_ITERATIONS Halley steps with no convergence test, so the cost is
+ * the same for every input and batched calls have no data-dependent branches.
+ *
+ * @ref Danby, J. M. A. and Burkardt, T. M., "The Solution of Kepler's Equation, I", 1983.
+ *
+ * @param mean_anomaly_rad Mean anomaly [rad].
+ * @param eccentricity Eccentricity, in [0, 0.99].
+ * @return Eccentric anomaly in [-pi, pi] [rad], for the mean anomaly wrapped to [-pi, pi].
+ */
+[[nodiscard]] double solve_kepler(const double mean_anomaly_rad, const double eccentricity) noexcept;
+
+/**
+ * @brief Solve Kepler's equation for arrays of mean anomaly and eccentricity.
+ *
+ * @param mean_anomaly_rad Mean anomalies [rad].
+ * @param eccentricity Eccentricities, in [0, 0.99].
+ * @param eccentric_anomaly_rad Output eccentric anomalies [rad].
+ *
+ * @exception std::length_error Input and output lengths differ.
+ *
+ * @see solve_kepler(const double, const double)
+ */
+void solve_kepler(std::span<const double> mean_anomaly_rad,
+    std::span<const double> eccentricity,
+    std::span<double> eccentric_anomaly_rad);
+
+/**
+ * @brief Convert orbital elements to an inertial state.
+ *
+ * @ref Vallado, D. A., "Fundamentals of Astrodynamics and Applications", 4th ed., Algorithm 10.
+ *
+ * @param elements Orbital elements.
+ * @param gm_m3ps2 Gravitational parameter [m^3 / s^2].
+ * @return Inertial position and velocity.
+ */
+[[nodiscard]] OrbitState elements_to_state(const OrbitalElements& elements,
+    const double gm_m3ps2 = Constants::WGS84_GM_M3PS2);
+
+/**
+ * @brief Convert an inertial state to orbital elements.
+ *
+ * @details Circular orbits have their argument of perigee set to zero and equatorial orbits their
+ * right ascension of the ascending node, so the remaining angles stay well defined. Output angles
+ * are in [0, 2pi).
+ *
+ * @ref Vallado, D. A., "Fundamentals of Astrodynamics and Applications", 4th ed., Algorithm 9.
+ *
+ * @param state Inertial position and velocity.
+ * @param gm_m3ps2 Gravitational parameter [m^3 / s^2].
+ * @return Orbital elements.
+ *
+ * @exception std::invalid_argument The state is not a bound, elliptical orbit.
+ */
+[[nodiscard]] OrbitalElements state_to_elements(const OrbitState& state,
+    const double gm_m3ps2 = Constants::WGS84_GM_M3PS2);
+
+}  // namespace MathUtils
@@ -0,0 +1,88 @@
+/**
+ * @file propagate.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Two-body and J2 secular orbit propagation.
+ */
+
+#pragma once
+
+#include "constants.h"
+#include "Orbit/orbital_elements.h"
+
+#include <cstddef>
+#include <span>
+
+namespace MathUtils {
+
+/**
+ * @brief Force model for element propagation.
+ */
+enum class OrbitModel {
+    TwoBody,  ///< Point-mass gravity; only the mean anomaly changes.
+    J2Secular  ///< Adds the secular drift of the node, perigee, and mean anomaly due to J2.
+};
+
+/**
+ * @brief Propagate an inertial state under two-body gravity with universal variables.
+ *
+ * @details Valid for elliptical, parabolic, and hyperbolic orbits and for negative time steps.
+ * Newton's method on the universal anomaly stops when the step is below 1e-13 of its value.
+ *
+ * @ref Curtis, H. D., "Orbital Mechanics for Engineering Students", 3rd ed., Algorithms 3.3 and 3.4.
+ *
+ * @param state Inertial position and velocity at the initial time.
+ * @param dt_s Time step [s].
+ * @param gm_m3ps2 Gravitational parameter [m^3 / s^2].
+ * @return Inertial position and velocity at the initial time plus `dt_s`.
+ */
+[[nodiscard]] OrbitState propagate_kepler(const OrbitState& state,
+    const double dt_s,
+    const double gm_m3ps2 = Constants::WGS84_GM_M3PS2);
+
+/**
+ * @brief Propagate orbital elements.
+ *
+ * @details The J2 model applies the first-order secular rates of the right ascension of the
+ * ascending node, argument of perigee, and mean anomaly for the WGS84 radius and J2. Output angles
+ * are in [0, 2pi).
+ *
+ * @ref Vallado, D. A., "Fundamentals of Astrodynamics and Applications", 4th ed., Section 9.6.
+ *
+ * @param elements Orbital elements at the initial time.
+ * @param dt_s Time step [s].
+ * @param model Force model.
+ * @param gm_m3ps2 Gravitational parameter [m^3 / s^2].
+ * @return Orbital elements at the initial time plus `dt_s`.
+ */
+[[nodiscard]] OrbitalElements propagate_elements(const OrbitalElements& elements,
+    const double dt_s,
+    const OrbitModel model = OrbitModel::J2Secular,
+    const double gm_m3ps2 = Constants::WGS84_GM_M3PS2);
+
+/**
+ * @brief Propagate a constellation to a common time and convert to inertial states.
+ *
+ * @details Each satellite is propagated with propagate_elements() and converted with
+ * elements_to_state(). Kepler's equation is solved with a fixed iteration count, so the loop body
+ * has no data-dependent branches and every satellite costs the same, so contiguous chunks of the
+ * constellation split evenly across worker threads.
+ *
+ * @param elements Orbital elements of each satellite at the initial time.
+ * @param dt_s Time step [s].
+ * @param states Output inertial states at the initial time plus `dt_s`.
+ * @param model Force model.
+ * @param gm_m3ps2 Gravitational parameter [m^3 / s^2].
+ * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency(), with at least
+ * 1024 satellites per worker.
+ *
+ * @exception std::length_error `elements` and `states` have different lengths.
+ */
+void propagate_constellation(std::span<const OrbitalElements> elements,
+    const double dt_s,
+    std::span<OrbitState> states,
+    const OrbitModel model = OrbitModel::J2Secular,
+    const double gm_m3ps2 = Constants::WGS84_GM_M3PS2,
+    const std::size_t num_threads = 0);
+
+}  // namespace MathUtils
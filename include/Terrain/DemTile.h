@@ -0,0 +1,240 @@
+/**
+ * @file DemTile.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief One-degree digital elevation model tile.
+ */
+
+#pragma once
+
+#include "Geodesy/GeoCoord.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace MathUtils {
+
+/**
+ * @brief Integer-degree southwest corner identifying a one-degree tile.
+ */
+struct DemTileKey {
+    int south_deg;  ///< Southern edge latitude [deg], -90 to 89.
+    int west_deg;  ///< Western edge longitude [deg], -180 to 179.
+
+    /**
+     * @brief Dense index of the tile, for hashing and sorting.
+     *
+     * @return Index from 0 to 180*360 - 1.
+     */
+    [[nodiscard]] int index() const noexcept
+    {
+        return ((south_deg + 90) * 360) + (west_deg + 180);
+    }
+
+    [[nodiscard]] bool operator==(const DemTileKey& other) const noexcept = default;
+};
+
+/**
+ * @brief Get the tile containing a position.
+ *
+ * @details Longitude is wrapped to [-180, 180) deg. The north pole belongs to the 89 deg row.
+ *
+ * @param pos Geodetic position. Altitude is ignored.
+ * @return Tile key.
+ */
+[[nodiscard]] DemTileKey dem_tile_key(const GeoCoord& pos) noexcept;
+
+/**
+ * @brief Get the SRTM file name of a tile, e.g. "N40W105.hgt".
+ *
+ * @param key Tile key.
+ * @return File name.
+ */
+[[nodiscard]] std::string hgt_file_name(const DemTileKey& key);
+
+/**
+ * @brief Height grid covering one degree of latitude and longitude.
+ *
+ * @details Samples are row-major with row 0 on the northern edge and column 0 on the western
+ * edge. Edge samples are shared with neighbouring tiles, so a tile with `samples` points per side
+ * has a spacing of 1 / (samples - 1) deg. Voids are stored as NaN.
+ *
+ * Heights are held decoded in memory as floats, so a tile takes a little over 4 bytes per sample
+ * including the pyramid, about 52 MB for a 1 arc-second tile. load_hgt() maps the file only while
+ * decoding it and does not keep the mapping.
+ *
+ * A min/max pyramid is built on construction. Level 0 blocks span PYRAMID_BLOCK grid cells per
+ * side and each level above halves the block count, up to one block for the whole tile. Ray
+ * marchers use it to bound the terrain under a large region without touching the samples. Voids
+ * are ignored, and an all-void block has a min and max of -infinity.
+ *
+ * @ref https://www.usgs.gov/centers/eros/science/usgs-eros-archive-digital-elevation-shuttle-radar-topography-mission-srtm-1
+ */
+class DemTile {
+public:
+    static constexpr std::size_t PYRAMID_BLOCK = 8;  ///< Grid cells per side of a level 0 block.
+
+    DemTile() = default;
+
+    ~DemTile() = default;
+
+    /**
+     * @brief Build a tile from decoded heights.
+     *
+     * @param key Tile key.
+     * @param samples Samples per side.
+     * @param heights_m Row-major heights [m]. Length samples * samples.
+     *
+     * @exception std::invalid_argument Fewer than two samples per side.
+     * @exception std::length_error `heights_m` is not samples * samples long.
+     */
+    DemTile(const DemTileKey& key, const std::size_t samples, std::vector<float> heights_m);
+
+    DemTile(const DemTile& other) = default;
+
+    DemTile(DemTile&& other) noexcept = default;
+
+    DemTile& operator=(const DemTile& other) = default;
+
+    DemTile& operator=(DemTile&& other) noexcept = default;
+
+    /**
+     * @brief Memory-map and decode an SRTM .hgt file.
+     *
+     * @details The file is big-endian int16 heights, row 0 north, with -32768 marking voids. The
+     * sample count is taken from the file size, so 1 and 3 arc-second tiles both work. The file is
+     * unmapped once the heights are decoded.
+     *
+     * @param path File path.
+     * @param key Tile the file covers.
+     * @return Decoded tile.
+     *
+     * @exception std::runtime_error The file cannot be mapped, is empty, or is not a square grid.
+     */
+    [[nodiscard]] static DemTile load_hgt(const std::filesystem::path& path,
+        const DemTileKey& key);
+
+    /**
+     * @brief Get the tile key.
+     *
+     * @return Tile key.
+     */
+    [[nodiscard]] const DemTileKey& key() const noexcept
+    {
+        return m_key;
+    }
+
+    /**
+     * @brief Get the number of samples per side.
+     *
+     * @return Samples per side.
+     */
+    [[nodiscard]] std::size_t samples() const noexcept
+    {
+        return m_samples;
+    }
+
+    /**
+     * @brief Get the row-major heights.
+     *
+     * @return Heights [m].
+     */
+    [[nodiscard]] std::span<const float> heights() const noexcept
+    {
+        return m_heights;
+    }
+
+    /**
+     * @brief Get one sample.
+     *
+     * @param row Row index, 0 is north.
+     * @param col Column index, 0 is west.
+     * @return Height [m], NaN for a void.
+     *
+     * @exception std::out_of_range Invalid index.
+     */
+    [[nodiscard]] float sample(const std::size_t row, const std::size_t col) const;
+
+    /**
+     * @brief Bilinear height at a position.
+     *
+     * @param lat_rad Latitude [rad].
+     * @param lon_rad Longitude [rad].
+     * @return Height [m]. NaN outside the tile, next to a void, or for a default-constructed tile.
+     */
+    [[nodiscard]] double height(const double lat_rad, const double lon_rad) const noexcept;
+
+    /**
+     * @brief Get the number of pyramid levels.
+     *
+     * @return Pyramid levels. The last level is a single block.
+     */
+    [[nodiscard]] std::size_t pyramid_levels() const noexcept
+    {
+        return m_block_min.size();
+    }
+
+    /**
+     * @brief Get the grid cells per side of a pyramid block.
+     *
+     * @param level Pyramid level.
+     * @return Cells per side. Blocks on the south and east edges may be smaller.
+     */
+    [[nodiscard]] std::size_t block_cells(const std::size_t level) const noexcept
+    {
+        return PYRAMID_BLOCK << level;
+    }
+
+    /**
+     * @brief Get the number of pyramid blocks per side.
+     *
+     * @param level Pyramid level.
+     * @return Blocks per side.
+     *
+     * @exception std::out_of_range Invalid level.
+     */
+    [[nodiscard]] std::size_t num_blocks(const std::size_t level) const;
+
+    /**
+     * @brief Get the lowest sample in a pyramid block.
+     *
+     * @param level Pyramid level.
+     * @param row Block row, 0 is north.
+     * @param col Block column, 0 is west.
+     * @return Minimum height [m].
+     *
+     * @exception std::out_of_range Invalid level or block index.
+     */
+    [[nodiscard]] float block_min(const std::size_t level, const std::size_t row,
+        const std::size_t col) const;
+
+    /**
+     * @brief Get the highest sample in a pyramid block.
+     *
+     * @param level Pyramid level.
+     * @param row Block row, 0 is north.
+     * @param col Block column, 0 is west.
+     * @return Maximum height [m].
+     *
+     * @exception std::out_of_range Invalid level or block index.
+     */
+    [[nodiscard]] float block_max(const std::size_t level, const std::size_t row,
+        const std::size_t col) const;
+
+private:
+    /**
+     * @brief Build the min/max pyramid from the samples.
+     */
+    void build_pyramid();
+
+    DemTileKey m_key {0, 0};  ///< Southwest corner.
+    std::size_t m_samples = 0;  ///< Samples per side.
+    std::vector<float> m_heights;  ///< Row-major heights [m].
+    std::vector<std::vector<float>> m_block_min;  ///< Row-major block minimums of each level [m].
+    std::vector<std::vector<float>> m_block_max;  ///< Row-major block maximums of each level [m].
+};
+
+}  // namespace MathUtils
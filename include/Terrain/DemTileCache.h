@@ -0,0 +1,120 @@
+/**
+ * @file DemTileCache.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Bounded least-recently-used cache of DEM tiles read from a directory.
+ */
+
+#pragma once
+
+#include "Geodesy/GeoCoord.h"
+#include "Terrain/DemTile.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <utility>
+
+namespace MathUtils {
+
+/**
+ * @brief Height lookups over a directory of SRTM .hgt tiles with a bounded tile cache.
+ *
+ * @details Tiles are memory-mapped and decoded on first use, then kept in a least-recently-used
+ * cache of at most `max_tiles` tiles. Missing tiles are cached too, so open ocean does not hit
+ * the file system on every query.
+ *
+ * The cache holds decoded tiles, not file mappings, so memory use is up to `max_tiles` times the
+ * decoded tile size (about 52 MB for 1 arc-second tiles, 6 MB for 3 arc-second tiles), plus any
+ * tiles still held by callers. Size `max_tiles` to the working set, not to the whole DEM.
+ *
+ * All queries are const and safe to call from many threads. The cache is guarded by a mutex that
+ * is held only to look up or insert a tile. Interpolation runs on a shared pointer outside the
+ * lock, so an evicted tile stays valid until its last reader is done.
+ */
+class DemTileCache {
+public:
+    /**
+     * @brief Create a cache over a tile directory.
+     *
+     * @param directory Directory holding files named by hgt_file_name().
+     * @param max_tiles Maximum number of cached tiles.
+     *
+     * @exception std::invalid_argument `max_tiles` is zero.
+     */
+    DemTileCache(std::filesystem::path directory, const std::size_t max_tiles);
+
+    ~DemTileCache() = default;
+
+    DemTileCache(const DemTileCache& other) = delete;
+
+    DemTileCache(DemTileCache&& other) = delete;
+
+    DemTileCache& operator=(const DemTileCache& other) = delete;
+
+    DemTileCache& operator=(DemTileCache&& other) = delete;
+
+    /**
+     * @brief Get a tile, loading it on a miss.
+     *
+     * @param key Tile key.
+     * @return Tile, or null if there is no file for it.
+     *
+     * @exception std::runtime_error The tile file exists but cannot be decoded.
+     */
+    [[nodiscard]] std::shared_ptr<const DemTile> tile(const DemTileKey& key) const;
+
+    /**
+     * @brief Bilinear height at a position.
+     *
+     * @param pos Geodetic position. Altitude is ignored.
+     * @return Height [m]. NaN if the tile is missing or the position is next to a void.
+     */
+    [[nodiscard]] double height(const GeoCoord& pos) const;
+
+    /**
+     * @brief Bilinear heights at many positions.
+     *
+     * @details Queries are visited in tile order, so every tile is looked up once per call no
+     * matter how the positions are ordered. Results are written in input order.
+     *
+     * @param pos Geodetic positions. Altitude is ignored.
+     * @param heights_m Output heights [m]. Must be the same length as `pos`.
+     *
+     * @exception std::length_error Input and output lengths differ.
+     */
+    void heights(std::span<const GeoCoord> pos, std::span<double> heights_m) const;
+
+    /**
+     * @brief Get the number of cached tiles, including cached misses.
+     *
+     * @return Cached tiles.
+     */
+    [[nodiscard]] std::size_t num_cached() const;
+
+    /**
+     * @brief Get the maximum number of cached tiles.
+     *
+     * @return Maximum cached tiles.
+     */
+    [[nodiscard]] std::size_t max_tiles() const noexcept
+    {
+        return m_max_tiles;
+    }
+
+private:
+    using Entry = std::pair<int, std::shared_ptr<const DemTile>>;  ///< Tile index and tile.
+
+    std::filesystem::path m_directory;  ///< Tile directory.
+    std::size_t m_max_tiles;  ///< Maximum cached tiles.
+
+    mutable std::mutex m_mutex;  ///< Guards the LRU list and index.
+    mutable std::list<Entry> m_lru;  ///< Cached tiles, most recently used first.
+    mutable std::unordered_map<int, std::list<Entry>::iterator> m_index;  ///< Tile index to entry.
+};
+
+}  // namespace MathUtils
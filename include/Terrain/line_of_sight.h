@@ -0,0 +1,88 @@
+/**
+ * @file line_of_sight.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Line-of-sight queries over DEM terrain.
+ */
+
+#pragma once
+
+#include "Geodesy/GeoCoord.h"
+#include "Terrain/DemTileCache.h"
+
+#include <cstddef>
+#include <span>
+
+namespace MathUtils {
+
+/**
+ * @brief Options for line-of-sight queries.
+ */
+struct LineOfSightOptions {
+    double min_step_m = 30.0;  ///< Smallest march step, about one DEM sample spacing, > 0 [m].
+    double clearance_m = 0.0;  ///< Required clearance of the ray above terrain [m].
+    double missing_tile_height_m = 0.0;  ///< Terrain height where no tile exists [m].
+};
+
+/**
+ * @brief Result of a line-of-sight query.
+ */
+struct LineOfSightResult {
+    bool visible;  ///< True if no terrain blocks the segment.
+    double blocked_range_m;  ///< Range from the observer to the first blocked point, or NaN [m].
+    std::size_t steps;  ///< March steps taken.
+};
+
+/**
+ * @brief Check whether terrain blocks the straight segment between two points.
+ *
+ * @details Marches along the ECEF chord, so earth curvature is accounted for. At each point the
+ * DEM tile's min/max pyramid is searched for the block that allows the longest safe step: the
+ * ray's clearance above the block maximum, limited to the distance to the block edge. Open sky
+ * is therefore crossed in a few large steps. Near terrain the march falls back to `min_step_m`
+ * with a bilinear height check, and the march exits at the first blocked point.
+ *
+ * Heights are compared directly with GeoCoord altitudes, so both endpoints must use the DEM's
+ * vertical datum. The endpoints themselves are never reported as blocked.
+ *
+ * @param terrain DEM tiles.
+ * @param observer Observer position.
+ * @param target Target position.
+ * @param options Query options.
+ * @return Visibility result.
+ *
+ * @exception std::invalid_argument `options.min_step_m` is not positive.
+ * @exception std::runtime_error A tile file cannot be decoded.
+ */
+[[nodiscard]] LineOfSightResult line_of_sight(const DemTileCache& terrain,
+    const GeoCoord& observer,
+    const GeoCoord& target,
+    const LineOfSightOptions& options = LineOfSightOptions{});
+
+/**
+ * @brief Check many observer-target pairs into caller-owned storage.
+ *
+ * @details The pairs are split into contiguous chunks, one per worker thread, and every worker
+ * reads the same DemTileCache, so a tile decoded by one worker is reused by the others. Results
+ * do not depend on the thread count. If a tile fails to decode, the other workers finish their
+ * chunks and the first error is rethrown.
+ *
+ * @param terrain DEM tiles.
+ * @param observers Observer positions.
+ * @param targets Target positions. Must be the same length as `observers`.
+ * @param results Output visibility results. Must be the same length as `observers`.
+ * @param options Query options.
+ * @param num_threads Worker threads. 0 uses std::thread::hardware_concurrency().
+ *
+ * @exception std::length_error Mismatched lengths.
+ * @exception std::invalid_argument `options.min_step_m` is not positive.
+ * @exception std::runtime_error A tile file cannot be decoded.
+ */
+void line_of_sight(const DemTileCache& terrain,
+    std::span<const GeoCoord> observers,
+    std::span<const GeoCoord> targets,
+    std::span<LineOfSightResult> results,
+    const LineOfSightOptions& options = LineOfSightOptions{},
+    const std::size_t num_threads = 0);
+
+}  // namespace MathUtils
@@ -0,0 +1,174 @@
+/**
+ * @file Epoch.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Two-part Julian date epoch.
+ */
+
+#pragma once
+
+#include <ostream>
+
+namespace MathUtils {
+
+constexpr inline double SECONDS_PER_DAY = 86'400.0;  ///< Seconds in a day without a leap second.
+constexpr inline double MJD_OFFSET_DAYS = 2'400'000.5;  ///< Julian date of MJD zero.
+constexpr inline double J2000_JD = 2'451'545.0;  ///< Julian date of the J2000 epoch, 2000-01-01 12:00.
+constexpr inline double DAYS_PER_JULIAN_CENTURY = 36'525.0;  ///< Days in a Julian century.
+
+/**
+ * @brief Instant as a Julian date split into a whole day and a day fraction.
+ *
+ * @details A single double Julian date only resolves about 40 microseconds. Keeping the whole day
+ * and the fraction in [0, 1) separately resolves about 10 picoseconds, and differences between
+ * nearby epochs cancel the whole days exactly. The time scale (UTC, TAI, GPS, TT) is not stored;
+ * see convert_time().
+ */
+class Epoch {
+public:
+    Epoch() = default;
+
+    ~Epoch() = default;
+
+    /**
+     * @brief Create an epoch from a two-part Julian date.
+     *
+     * @details The parts may be split anywhere; they are normalized so the day is whole and the
+     * fraction is in [0, 1).
+     *
+     * @param day Julian date, or its leading part [day].
+     * @param fraction Remaining part of the Julian date [day].
+     */
+    Epoch(const double day, const double fraction);
+
+    Epoch(const Epoch& other) = default;
+
+    Epoch(Epoch&& other) = default;
+
+    Epoch& operator=(const Epoch& other) = default;
+
+    Epoch& operator=(Epoch&& other) = default;
+
+    /**
+     * @brief Create an epoch from a Gregorian calendar date and time of day.
+     *
+     * @details Days are 86400 s long, so a UTC leap second (second 60) is not representable.
+     *
+     * @ref Fliegel, H. F. and Van Flandern, T. C., "A Machine Algorithm for Processing Calendar
+     * Dates", Communications of the ACM, 1968.
+     *
+     * @param year Year.
+     * @param month Month, 1 to 12.
+     * @param day Day of the month, 1 to 31.
+     * @param hour Hour, 0 to 23.
+     * @param minute Minute, 0 to 59.
+     * @param second Second, in [0, 60).
+     * @return Epoch.
+     */
+    [[nodiscard]] static Epoch from_calendar(const int year,
+        const int month,
+        const int day,
+        const int hour = 0,
+        const int minute = 0,
+        const double second = 0.0);
+
+    /**
+     * @brief Create an epoch from a modified Julian date.
+     *
+     * @param mjd Modified Julian date [day].
+     * @return Epoch.
+     */
+    [[nodiscard]] static Epoch from_mjd(const double mjd);
+
+    /**
+     * @brief Get the whole Julian day.
+     *
+     * @return Whole part of the Julian date [day].
+     */
+    [[nodiscard]] double day() const noexcept
+    {
+        return m_day;
+    }
+
+    /**
+     * @brief Get the day fraction.
+     *
+     * @return Fraction of the Julian date past day(), in [0, 1) [day].
+     */
+    [[nodiscard]] double fraction() const noexcept
+    {
+        return m_fraction;
+    }
+
+    /**
+     * @brief Get the Julian date as one value, with reduced precision.
+     *
+     * @return Julian date [day].
+     */
+    [[nodiscard]] double julian_date() const noexcept
+    {
+        return m_day + m_fraction;
+    }
+
+    /**
+     * @brief Get the modified Julian date.
+     *
+     * @return Modified Julian date [day].
+     */
+    [[nodiscard]] double mjd() const noexcept
+    {
+        return (m_day - (MJD_OFFSET_DAYS - 0.5)) + (m_fraction - 0.5);
+    }
+
+    /**
+     * @brief Get Julian centuries since J2000, as used by precession and ephemeris series.
+     *
+     * @return Julian centuries past 2000-01-01 12:00 in this epoch's time scale.
+     */
+    [[nodiscard]] double julian_centuries_j2000() const noexcept
+    {
+        return ((m_day - J2000_JD) + m_fraction) / DAYS_PER_JULIAN_CENTURY;
+    }
+
+    /**
+     * @brief Offset the epoch.
+     *
+     * @param seconds Offset [s].
+     * @return Epoch `seconds` later.
+     */
+    [[nodiscard]] Epoch plus_seconds(const double seconds) const
+    {
+        return Epoch(m_day, m_fraction + (seconds / SECONDS_PER_DAY));
+    }
+
+    /**
+     * @brief Elapsed time since another epoch in the same time scale.
+     *
+     * @param other Earlier epoch.
+     * @return This epoch minus `other` [s].
+     */
+    [[nodiscard]] double seconds_since(const Epoch& other) const noexcept
+    {
+        return ((m_day - other.m_day) + (m_fraction - other.m_fraction)) * SECONDS_PER_DAY;
+    }
+
+protected:
+private:
+    double m_day {0};  ///< Whole Julian day [day].
+    double m_fraction {0};  ///< Day fraction in [0, 1) [day].
+};
+
+// =================================================================================================
+// OTHER FUNCTIONS
+// =================================================================================================
+
+/**
+ * @brief Print an Epoch to a stream as its day and fraction. No newline at the end.
+ *
+ * @param os Output stream.
+ * @param epoch Epoch to print.
+ * @return Output stream with Epoch.
+ */
+std::ostream& operator<<(std::ostream& os, const Epoch& epoch);
+
+}  // namespace MathUtils
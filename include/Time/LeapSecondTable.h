@@ -0,0 +1,175 @@
+/**
+ * @file LeapSecondTable.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief UTC leap-second table and a cached lookup cursor.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace MathUtils {
+
+/**
+ * @brief One step of TAI - UTC.
+ */
+struct LeapSecond {
+    double mjd_utc;  ///< UTC modified Julian date the offset takes effect, at 00:00 [day].
+    double tai_minus_utc_s;  ///< TAI - UTC from that date on [s].
+};
+
+/**
+ * @brief Sorted table of TAI - UTC steps since 1972.
+ *
+ * @details Epochs before the first entry use the first entry's offset, since UTC before 1972 did
+ * not step by whole seconds.
+ */
+class LeapSecondTable {
+public:
+    /**
+     * @brief Create a table.
+     *
+     * @param entries Steps sorted by date.
+     *
+     * @exception std::invalid_argument `entries` is empty or not sorted by date.
+     */
+    explicit LeapSecondTable(std::vector<LeapSecond> entries);
+
+    ~LeapSecondTable() = default;
+
+    LeapSecondTable(const LeapSecondTable& other) = default;
+
+    LeapSecondTable(LeapSecondTable&& other) noexcept = default;
+
+    LeapSecondTable& operator=(const LeapSecondTable& other) = default;
+
+    LeapSecondTable& operator=(LeapSecondTable&& other) noexcept = default;
+
+    /**
+     * @brief Get the built-in table, IERS Bulletin C through the 2017-01-01 leap second.
+     *
+     * @details Built on first use and shared by all threads.
+     *
+     * @ref https://hpiers.obspm.fr/iers/bul/bulc/Leap_Second.dat
+     *
+     * @return Built-in table.
+     */
+    [[nodiscard]] static const LeapSecondTable& builtin();
+
+    /**
+     * @brief Get the table entries.
+     *
+     * @return Entries sorted by date.
+     */
+    [[nodiscard]] std::span<const LeapSecond> entries() const noexcept
+    {
+        return m_entries;
+    }
+
+    /**
+     * @brief Get the number of entries.
+     *
+     * @return Number of entries.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_entries.size();
+    }
+
+    /**
+     * @brief Find the entry in effect at a UTC date with a binary search.
+     *
+     * @param mjd_utc UTC modified Julian date [day].
+     * @return Entry index, zero before the first entry.
+     */
+    [[nodiscard]] std::size_t find_utc(const double mjd_utc) const noexcept;
+
+    /**
+     * @brief Find the entry in effect at a TAI date with a binary search.
+     *
+     * @param mjd_tai TAI modified Julian date [day].
+     * @return Entry index, zero before the first entry.
+     */
+    [[nodiscard]] std::size_t find_tai(const double mjd_tai) const noexcept;
+
+    /**
+     * @brief Get the UTC date each entry takes effect.
+     *
+     * @return UTC modified Julian dates, one per entry [day].
+     */
+    [[nodiscard]] std::span<const double> mjd_utc() const noexcept
+    {
+        return m_mjd_utc;
+    }
+
+    /**
+     * @brief Get the TAI date each entry takes effect.
+     *
+     * @return TAI modified Julian dates, one per entry [day].
+     */
+    [[nodiscard]] std::span<const double> mjd_tai() const noexcept
+    {
+        return m_mjd_tai;
+    }
+
+protected:
+private:
+    std::vector<LeapSecond> m_entries;  ///< Steps sorted by date.
+    std::vector<double> m_mjd_utc;  ///< UTC date of each step [day].
+    std::vector<double> m_mjd_tai;  ///< TAI date of each step [day].
+};
+
+/**
+ * @brief Cached position in a LeapSecondTable for streams of nearby epochs.
+ *
+ * @details Remembers the last entry found. A lookup in the same or the next interval costs two
+ * comparisons, so monotonic streams such as log replay almost never search. Other lookups fall
+ * back to a binary search. One cursor per thread; the table itself may be shared.
+ */
+class LeapSecondCursor {
+public:
+    /**
+     * @brief Create a cursor.
+     *
+     * @param table Table to look up. Must outlive the cursor.
+     */
+    explicit LeapSecondCursor(const LeapSecondTable& table = LeapSecondTable::builtin()) noexcept
+        :m_table{&table}
+    {}
+
+    /**
+     * @brief Get TAI - UTC at a UTC date.
+     *
+     * @param mjd_utc UTC modified Julian date [day].
+     * @return TAI - UTC [s].
+     */
+    [[nodiscard]] double tai_minus_utc_at_utc(const double mjd_utc) noexcept;
+
+    /**
+     * @brief Get TAI - UTC at a TAI date.
+     *
+     * @param mjd_tai TAI modified Julian date [day].
+     * @return TAI - UTC [s].
+     */
+    [[nodiscard]] double tai_minus_utc_at_tai(const double mjd_tai) noexcept;
+
+    /**
+     * @brief Get the cached entry index.
+     *
+     * @return Index of the entry found by the last lookup.
+     */
+    [[nodiscard]] std::size_t index() const noexcept
+    {
+        return m_idx;
+    }
+
+protected:
+private:
+    const LeapSecondTable* m_table;  ///< Table to look up.
+    std::size_t m_idx {0};  ///< Entry found by the last lookup.
+};
+
+}  // namespace MathUtils
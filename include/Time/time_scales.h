@@ -0,0 +1,80 @@
+/**
+ * @file time_scales.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Conversions between UTC, TAI, GPS, and TT epochs.
+ */
+
+#pragma once
+
+#include "Time/Epoch.h"
+#include "Time/LeapSecondTable.h"
+
+#include <span>
+
+namespace MathUtils {
+
+constexpr inline double TAI_MINUS_GPS_S = 19.0;  ///< TAI - GPS time, fixed at the 1980 GPS epoch [s].
+constexpr inline double TT_MINUS_TAI_S = 32.184;  ///< TT - TAI [s].
+
+/**
+ * @brief Time scale of an Epoch.
+ */
+enum class TimeScale {
+    UTC,  ///< Coordinated Universal Time, steps by leap seconds.
+    TAI,  ///< International Atomic Time.
+    GPS,  ///< GPS system time.
+    TT  ///< Terrestrial Time, the argument of ephemeris series.
+};
+
+/**
+ * @brief Convert an epoch between time scales.
+ *
+ * @details Conversions go through TAI. Only UTC needs the leap-second table; the other offsets are
+ * constant. A TAI instant inside an inserted leap second maps into the first second of the next
+ * UTC day, since Epoch cannot represent second 60.
+ *
+ * @param epoch Epoch in `from`.
+ * @param from Time scale of `epoch`.
+ * @param to Time scale to convert to.
+ * @param cursor Leap-second lookup, advanced to this epoch.
+ * @return Epoch in `to`.
+ */
+[[nodiscard]] Epoch convert_time(const Epoch& epoch,
+    const TimeScale from,
+    const TimeScale to,
+    LeapSecondCursor& cursor);
+
+/**
+ * @brief Convert an epoch between time scales with the built-in leap-second table.
+ *
+ * @param epoch Epoch in `from`.
+ * @param from Time scale of `epoch`.
+ * @param to Time scale to convert to.
+ * @return Epoch in `to`.
+ *
+ * @see convert_time(const Epoch&, const TimeScale, const TimeScale, LeapSecondCursor&)
+ */
+[[nodiscard]] Epoch convert_time(const Epoch& epoch, const TimeScale from, const TimeScale to);
+
+/**
+ * @brief Convert an array of epochs between time scales.
+ *
+ * @details One LeapSecondCursor is reused across the array, so sorted or nearly sorted epochs
+ * rarely search the table.
+ *
+ * @param epochs Epochs in `from`.
+ * @param converted Output epochs in `to`. May alias `epochs`.
+ * @param from Time scale of `epochs`.
+ * @param to Time scale to convert to.
+ * @param table Leap-second table.
+ *
+ * @exception std::length_error `epochs` and `converted` have different lengths.
+ */
+void convert_time(std::span<const Epoch> epochs,
+    std::span<Epoch> converted,
+    const TimeScale from,
+    const TimeScale to,
+    const LeapSecondTable& table = LeapSecondTable::builtin());
+
+}  // namespace MathUtils
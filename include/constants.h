@@ -42,10 +42,13 @@ constexpr inline double WGS84_A_M = 6'378'137.0;  ///< WGS84 semimajor axis [m].
 constexpr inline double WGS84_B_M = WGS84_A_M * (1.0 - WGS84_F);  ///< WGS semiminor axis [m].
 constexpr inline double WGS84_GM_M3PS2 = 3.986'004'418e14;  ///< WGS84 gravitational parameter [m^3 / s^2].
 constexpr inline double WGS84_RATE_RPS = 7.292'115e-5;  ///< WGS84 mean angular velocity [rad/sec].
+constexpr inline double WGS84_J2 = 1.082'629'989'05e-3;  ///< WGS84 defining second zonal harmonic, -sqrt(5) * C20 with normalized C20 = -4.841668e-4.
 
 constexpr inline double EARTH_RADIUS_M = ((2.0 * WGS84_A_M) + WGS84_B_M) / 3.0;  ///< IUGG earth arithmetic mean radius, (2a + b) / 3 [m].
 
 constexpr inline double EARTH_GRAV_MPS2 = 9.806'65;  ///< Earth standard gravity [m/s/s].
 
+constexpr inline double ASTRONOMICAL_UNIT_M = 149'597'870'700.0;  ///< IAU 2012 astronomical unit [m].
+
 }  // namespace Constants
 }  // namespace MathUtils
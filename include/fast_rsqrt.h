@@ -0,0 +1,53 @@
+/**
+ * @file fast_rsqrt.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+
+namespace MathUtils {
+
+/**
+ * @brief Approximate reciprocal square root, 1 / sqrt(val), without sqrt or divide.
+ *
+ * @details Bit-level initial guess followed by Newton-Raphson refinement steps. Maximum relative
+ * error over positive normal inputs:
+ *
+ * | Iterations | Relative error |
+ * | ---------- | -------------- |
+ * | 0          | 3.5e-2         |
+ * | 1          | 1.8e-3         |
+ * | 2          | 4.6e-6         |
+ * | 3          | 3.2e-11        |
+ *
+ * @tparam ITERATIONS Number of Newton-Raphson steps.
+ * @param val Operand. Must be positive and normal.
+ * @return Approximate 1 / sqrt(val).
+ *
+ * @ref https://en.wikipedia.org/wiki/Fast_inverse_square_root
+ * @ref http://www.lomont.org/papers/2003/InvSqrt.pdf
+ */
+template<unsigned ITERATIONS = 2>
+[[nodiscard]] inline double fast_rsqrt(const double val) noexcept
+{
+    constexpr std::uint64_t magic = 0x5FE6'EB50'C7B5'37A9;
+
+    assert(val > 0.0);
+
+    auto res = std::bit_cast<double>(magic - (std::bit_cast<std::uint64_t>(val) >> 1U));
+    const double half_val = 0.5 * val;
+
+    for (unsigned ii = 0; ii < ITERATIONS; ii++)
+    {
+        res *= 1.5 - (half_val * res * res);
+    }
+
+    return res;
+}
+
+}  // namespace MathUtils
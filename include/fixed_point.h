@@ -0,0 +1,314 @@
+/**
+ * @file fixed_point.h
+ * @author Michael Wrona
+ * @date 2026-10-18
+ * @brief Q-format fixed-point scalar with saturating arithmetic.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace MathUtils {
+
+/**
+ * @brief Criteria for a valid MathUtils::FixedPoint storage type and fractional bit count.
+ *
+ * @details Products are computed in an integer twice as wide as the storage type, so storage is
+ * limited to 32 bits.
+ *
+ * @tparam T Storage type.
+ * @tparam FRAC_BITS Number of fractional bits.
+ */
+template<typename T, unsigned FRAC_BITS>
+concept valid_fixed_point = std::signed_integral<T> &&
+    (sizeof(T) <= sizeof(std::int32_t)) &&
+    (FRAC_BITS < std::numeric_limits<T>::digits + 1) &&
+    (FRAC_BITS > 0);
+
+/**
+ * @brief Signed Q-format fixed-point number.
+ *
+ * @details The represented value is `raw / 2^FRAC_BITS`. Arithmetic saturates at the storage
+ * limits instead of wrapping, and multiplication rounds to nearest. Intended for targets without
+ * an FPU, where every `double` operation is a soft-float library call.
+ *
+ * @code {.cpp}
+ * const Q15 a(0.5);
+ * const Q15 b(-0.25);
+ * const double c = (a * b).to_double();  // -0.125
+ * @endcode
+ *
+ * @tparam T Signed integer storage type.
+ * @tparam FRAC_BITS Number of fractional bits.
+ */
+template<typename T, unsigned FRAC_BITS>
+requires valid_fixed_point<T, FRAC_BITS>
+class FixedPoint {
+public:
+    using storage_type = T;  ///< Underlying integer type.
+    using wide_type = std::conditional_t<(sizeof(T) < sizeof(std::int32_t)),
+        std::int32_t, std::int64_t>;  ///< Integer type used for intermediate products.
+
+    static constexpr unsigned frac_bits = FRAC_BITS;  ///< Number of fractional bits.
+
+    FixedPoint() = default;
+
+    ~FixedPoint() = default;
+
+    /**
+     * @brief Convert from floating-point. Rounds to nearest and saturates.
+     *
+     * @details Out-of-range values, including infinities, saturate before rounding so the integer
+     * conversion is always defined. NaN converts to zero.
+     *
+     * @param val Value to convert.
+     */
+    explicit FixedPoint(const double val) noexcept
+        :m_raw{from_double(val)}
+    {}
+
+    FixedPoint(const FixedPoint& other) = default;
+
+    FixedPoint(FixedPoint&& other) noexcept = default;
+
+    FixedPoint& operator=(const FixedPoint& other) = default;
+
+    FixedPoint& operator=(FixedPoint&& other) noexcept = default;
+
+    /**
+     * @brief Create a fixed-point number from its raw integer representation.
+     *
+     * @param raw Raw value, `value * 2^FRAC_BITS`.
+     * @return Fixed-point number.
+     */
+    [[nodiscard]] static constexpr FixedPoint from_raw(const T raw) noexcept
+    {
+        FixedPoint result;
+        result.m_raw = raw;
+        return result;
+    }
+
+    /**
+     * @brief Largest representable value.
+     *
+     * @return Maximum value.
+     */
+    [[nodiscard]] static constexpr FixedPoint max() noexcept
+    {
+        return from_raw(std::numeric_limits<T>::max());
+    }
+
+    /**
+     * @brief Smallest (most negative) representable value.
+     *
+     * @return Minimum value.
+     */
+    [[nodiscard]] static constexpr FixedPoint min() noexcept
+    {
+        return from_raw(std::numeric_limits<T>::min());
+    }
+
+    /**
+     * @brief Get the raw integer representation.
+     *
+     * @return Raw value.
+     */
+    [[nodiscard]] constexpr T raw() const noexcept
+    {
+        return m_raw;
+    }
+
+    /**
+     * @brief Convert to floating-point.
+     *
+     * @return Represented value.
+     */
+    [[nodiscard]] double to_double() const noexcept
+    {
+        return static_cast<double>(m_raw) / scale();
+    }
+
+    /**
+     * @brief Saturating addition in-place.
+     *
+     * @param other Value to add.
+     * @return Sum.
+     */
+    FixedPoint& operator+=(const FixedPoint other) noexcept
+    {
+        m_raw = saturate(static_cast<wide_type>(m_raw) + static_cast<wide_type>(other.m_raw));
+        return *this;
+    }
+
+    /**
+     * @brief Saturating subtraction in-place.
+     *
+     * @param other Value to subtract.
+     * @return Difference.
+     */
+    FixedPoint& operator-=(const FixedPoint other) noexcept
+    {
+        m_raw = saturate(static_cast<wide_type>(m_raw) - static_cast<wide_type>(other.m_raw));
+        return *this;
+    }
+
+    /**
+     * @brief Saturating multiplication in-place. Rounds to nearest.
+     *
+     * @param other Value to multiply by.
+     * @return Product.
+     */
+    FixedPoint& operator*=(const FixedPoint other) noexcept
+    {
+        constexpr wide_type half = wide_type{1} << (FRAC_BITS - 1);
+
+        const wide_type prod = static_cast<wide_type>(m_raw) * static_cast<wide_type>(other.m_raw);
+        m_raw = saturate((prod + half) >> FRAC_BITS);
+        return *this;
+    }
+
+    /**
+     * @brief Saturating negation. The minimum value negates to the maximum value.
+     *
+     * @return Negated value.
+     */
+    [[nodiscard]] FixedPoint operator-() const noexcept
+    {
+        return from_raw(saturate(-static_cast<wide_type>(m_raw)));
+    }
+
+    /**
+     * @brief Compare two fixed-point numbers.
+     */
+    constexpr auto operator<=>(const FixedPoint& other) const noexcept = default;
+
+private:
+    /**
+     * @brief Scale factor between the raw and represented value, 2^FRAC_BITS.
+     *
+     * @return Scale factor.
+     */
+    static constexpr double scale() noexcept
+    {
+        return static_cast<double>(std::int64_t{1} << FRAC_BITS);
+    }
+
+    /**
+     * @brief Round a floating-point value to a raw value, saturating at the storage limits.
+     *
+     * @param val Value to convert.
+     * @return Raw value.
+     */
+    static T from_double(const double val) noexcept
+    {
+        constexpr auto lower = static_cast<double>(std::numeric_limits<T>::min());
+        constexpr auto upper = static_cast<double>(std::numeric_limits<T>::max());
+
+        const double scaled = val * scale();
+
+        if (std::isnan(scaled))
+        {
+            return T{0};
+        }
+
+        if (scaled <= lower)
+        {
+            return std::numeric_limits<T>::min();
+        }
+
+        if (scaled >= upper)
+        {
+            return std::numeric_limits<T>::max();
+        }
+
+        return saturate(std::llround(scaled));
+    }
+
+    /**
+     * @brief Clamp a wide integer to the storage type's range.
+     *
+     * @tparam W Wide integer type.
+     * @param val Value to clamp.
+     * @return Clamped value.
+     */
+    template<std::integral W>
+    static constexpr T saturate(const W val) noexcept
+    {
+        constexpr auto lower = static_cast<W>(std::numeric_limits<T>::min());
+        constexpr auto upper = static_cast<W>(std::numeric_limits<T>::max());
+
+        if (val < lower)
+        {
+            return std::numeric_limits<T>::min();
+        }
+
+        if (val > upper)
+        {
+            return std::numeric_limits<T>::max();
+        }
+
+        return static_cast<T>(val);
+    }
+
+private:
+    T m_raw {0};  ///< Raw integer value, `value * 2^FRAC_BITS`.
+};
+
+/**
+ * @brief Criteria for a MathUtils::FixedPoint type.
+ *
+ * @tparam Q Type to check.
+ */
+template<typename Q>
+concept fixed_point_type = std::same_as<Q, FixedPoint<typename Q::storage_type, Q::frac_bits>>;
+
+using Q15 = FixedPoint<std::int16_t, 15>;  ///< 16-bit fixed-point in [-1, 1).
+using Q31 = FixedPoint<std::int32_t, 31>;  ///< 32-bit fixed-point in [-1, 1).
+
+// =================================================================================================
+// ARITHMETIC OPERATORS
+// =================================================================================================
+
+/**
+ * @brief Saturating fixed-point addition.
+ *
+ * @details Calls operator+=(FixedPoint).
+ */
+template<typename Q>
+requires fixed_point_type<Q>
+[[nodiscard]] Q operator+(Q a, const Q b) noexcept
+{
+    return a += b;
+}
+
+/**
+ * @brief Saturating fixed-point subtraction.
+ *
+ * @details Calls operator-=(FixedPoint).
+ */
+template<typename Q>
+requires fixed_point_type<Q>
+[[nodiscard]] Q operator-(Q a, const Q b) noexcept
+{
+    return a -= b;
+}
+
+/**
+ * @brief Saturating fixed-point multiplication. Rounds to nearest.
+ *
+ * @details Calls operator*=(FixedPoint).
+ */
+template<typename Q>
+requires fixed_point_type<Q>
+[[nodiscard]] Q operator*(Q a, const Q b) noexcept
+{
+    return a *= b;
+}
+
+}  // namespace MathUtils
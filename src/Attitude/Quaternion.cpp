@@ -6,6 +6,7 @@
 
 #include "Attitude/Quaternion.h"
 
+#include "fast_rsqrt.h"
 #include "float_equality.h"
 #include "Internal/error_msg_helpers.h"
 
@@ -96,6 +97,38 @@ void Quaternion::normalize()
     m_arr[3] /= magn;
 }
 
+void Quaternion::normalize_fast()
+{
+    const double magn2 = (m_arr[0] * m_arr[0]) +
+        (m_arr[1] * m_arr[1]) +
+        (m_arr[2] * m_arr[2]) +
+        (m_arr[3] * m_arr[3]);
+
+    assert(std::isnormal(magn2));
+
+    const double inv_magn = fast_rsqrt(magn2);
+
+    m_arr[0] *= inv_magn;
+    m_arr[1] *= inv_magn;
+    m_arr[2] *= inv_magn;
+    m_arr[3] *= inv_magn;
+}
+
+void Quaternion::renormalize_nearly_unit() noexcept
+{
+    const double scale = 1.5 - 0.5 * (
+        (m_arr[0] * m_arr[0]) +
+        (m_arr[1] * m_arr[1]) +
+        (m_arr[2] * m_arr[2]) +
+        (m_arr[3] * m_arr[3])
+    );
+
+    m_arr[0] *= scale;
+    m_arr[1] *= scale;
+    m_arr[2] *= scale;
+    m_arr[3] *= scale;
+}
+
 [[nodiscard]] Vector<3> Quaternion::eigen_axis() const
 {
     // rotation angle divided by 2
@@ -127,6 +160,28 @@ Quaternion operator*(const Quaternion& q_b, const Quaternion& q_c)
     );
 }
 
+void mul_into(const Quaternion& q_b, const Quaternion& q_c, Quaternion& q_out)
+{
+    // product is fully evaluated before assignment, so aliasing is safe
+    q_out = q_b * q_c;
+}
+
+void normalize_fast(std::span<Quaternion> quats)
+{
+    for (auto& quat : quats)
+    {
+        quat.normalize_fast();
+    }
+}
+
+void renormalize_nearly_unit(std::span<Quaternion> quats) noexcept
+{
+    for (auto& quat : quats)
+    {
+        quat.renormalize_nearly_unit();
+    }
+}
+
 std::ostream& operator<<(std::ostream& os, const Quaternion& quat)
 {
     os << quat(0) << ", "
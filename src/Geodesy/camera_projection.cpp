@@ -0,0 +1,166 @@
+/**
+ * @file camera_projection.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Geodesy/camera_projection.h"
+
+#include "Attitude/quaternion_to_dcm.h"
+#include "Internal/error_msg_helpers.h"
+#include "Internal/parallel_chunks.h"
+#include "LinAlg/Matrix.h"
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace MathUtils {
+
+namespace {
+
+/**
+ * @brief Fewest points per worker thread when the thread count is picked automatically.
+ */
+constexpr std::size_t PROJECT_POINTS_PER_WORKER = 16384;
+
+/**
+ * @brief Largest squared normalized radius over which the radial distortion is monotonic.
+ *
+ * @details The distorted radius r * (1 + k1 * r^2 + k2 * r^4) has derivative
+ * 1 + 3 * k1 * r^2 + 5 * k2 * r^4, which is 1 at the boresight. Past its first positive root the
+ * polynomial folds back, so points far outside the field of view would land inside the image.
+ *
+ * @param camera Camera intrinsics.
+ * @return First positive root in r^2, or infinity if the derivative never reaches zero.
+ */
+double max_monotonic_r2(const PinholeCamera& camera) noexcept
+{
+    // roots of 5 * k2 * s^2 + 3 * k1 * s + 1 = 0 written as s = 2 / t, which also covers k2 = 0
+    const double b = 3.0 * camera.k1;
+    const double disc = (b * b) - (20.0 * camera.k2);
+
+    if (disc < 0.0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const double t = std::sqrt(disc) - b;
+    return (t > 0.0) ? (2.0 / t) : std::numeric_limits<double>::infinity();
+}
+
+}  // namespace
+
+std::size_t project_points(const PinholeCamera& camera,
+    const Vector<3>& cam_pos_ecef_m,
+    const Quaternion& q_ecef_cam,
+    std::span<const double> x_ecef_m,
+    std::span<const double> y_ecef_m,
+    std::span<const double> z_ecef_m,
+    std::span<double> u_px,
+    std::span<double> v_px,
+    std::span<std::uint8_t> visible,
+    const std::size_t num_threads)
+{
+    const std::size_t num = x_ecef_m.size();
+
+    for (const std::size_t len : {y_ecef_m.size(), z_ecef_m.size(), u_px.size(), v_px.size(),
+        visible.size()})
+    {
+        if (len != num)
+        {
+            throw std::length_error(Internal::mismatched_length_error_msg(num, len));
+        }
+    }
+
+    // camera-to-ECEF DCM, applied transposed to go ECEF-to-camera
+    const Matrix<3,3> dcm = quaternion_to_dcm(q_ecef_cam);
+    const double* const c = dcm.data();
+
+    const double px = cam_pos_ecef_m(0);
+    const double py = cam_pos_ecef_m(1);
+    const double pz = cam_pos_ecef_m(2);
+
+    const double* const xs = x_ecef_m.data();
+    const double* const ys = y_ecef_m.data();
+    const double* const zs = z_ecef_m.data();
+    double* const us = u_px.data();
+    double* const vs = v_px.data();
+    std::uint8_t* const vis = visible.data();
+
+    const double r2_max = max_monotonic_r2(camera);
+
+    const auto project_range = [&](const std::size_t first, const std::size_t last) {
+        constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+        std::size_t num_visible = 0;
+
+        for (std::size_t idx = first; idx < last; idx++)
+        {
+            const double dx = xs[idx] - px;
+            const double dy = ys[idx] - py;
+            const double dz = zs[idx] - pz;
+
+            const double xc = (c[0] * dx) + (c[3] * dy) + (c[6] * dz);
+            const double yc = (c[1] * dx) + (c[4] * dy) + (c[7] * dz);
+            const double zc = (c[2] * dx) + (c[5] * dy) + (c[8] * dz);
+
+            const bool in_front = zc > camera.near_m;
+            const double inv_z = 1.0 / zc;
+            const double xn = xc * inv_z;
+            const double yn = yc * inv_z;
+
+            const double r2 = (xn * xn) + (yn * yn);
+            const double radial = 1.0 + (r2 * (camera.k1 + (r2 * camera.k2)));
+            const double xd = (xn * radial) + (2.0 * camera.p1 * xn * yn) +
+                (camera.p2 * (r2 + (2.0 * xn * xn)));
+            const double yd = (yn * radial) + (camera.p1 * (r2 + (2.0 * yn * yn))) +
+                (2.0 * camera.p2 * xn * yn);
+
+            const double u = in_front ? ((camera.fx * xd) + camera.cx) : nan;
+            const double v = in_front ? ((camera.fy * yd) + camera.cy) : nan;
+
+            // NaN pixels fail every comparison, so points behind the camera are never visible.
+            // Points past the fold of the distortion are culled before their pixel can alias into
+            // the image.
+            const bool in_image = (r2 < r2_max) && (u >= 0.0) && (u < camera.width) &&
+                (v >= 0.0) && (v < camera.height);
+
+            us[idx] = u;
+            vs[idx] = v;
+            vis[idx] = static_cast<std::uint8_t>(in_image);
+            num_visible += static_cast<std::size_t>(in_image);
+        }
+
+        return num_visible;
+    };
+
+    // one visible count per chunk, added once every worker has joined
+    const std::size_t num_workers = Internal::worker_count(num_threads, num,
+        PROJECT_POINTS_PER_WORKER);
+    std::vector<std::size_t> chunk_visible(num_workers, 0);
+
+    Internal::parallel_chunks(num, num_workers,
+        [&project_range, &chunk_visible](const std::size_t worker, const std::size_t first,
+            const std::size_t last) {
+            chunk_visible[worker] = project_range(first, last);
+        });
+
+    return std::accumulate(chunk_visible.begin(), chunk_visible.end(), std::size_t{0});
+}
+
+std::size_t project_points(const PinholeCamera& camera,
+    const Vector<3>& cam_pos_ecef_m,
+    const Quaternion& q_ecef_cam,
+    const Vector3Batch& points_ecef_m,
+    std::span<double> u_px,
+    std::span<double> v_px,
+    std::span<std::uint8_t> visible,
+    const std::size_t num_threads)
+{
+    return project_points(camera, cam_pos_ecef_m, q_ecef_cam, points_ecef_m.x(),
+        points_ecef_m.y(), points_ecef_m.z(), u_px, v_px, visible, num_threads);
+}
+
+}  // namespace MathUtils
@@ -7,9 +7,11 @@
 #include "Geodesy/ecef_to_lla.h"
 
 #include "constants.h"
+#include "Internal/error_msg_helpers.h"
 
 #include <cassert>
 #include <cmath>
+#include <stdexcept>
 
 namespace MathUtils {
 
@@ -86,4 +88,19 @@ GeoCoord ecef_to_lla(const Vector<3>& pos_ecef_m)
     return GeoCoord(latitude_rad, longitude_rad, altitude_m);
 }
 
+void ecef_to_lla(std::span<const Vector<3>> pos_ecef_m, std::span<GeoCoord> lla)
+{
+    if (pos_ecef_m.size() != lla.size())
+    {
+        throw std::length_error(
+            Internal::mismatched_length_error_msg(pos_ecef_m.size(), lla.size())
+        );
+    }
+
+    for (std::size_t idx = 0; idx < pos_ecef_m.size(); idx++)
+    {
+        lla[idx] = ecef_to_lla(pos_ecef_m[idx]);
+    }
+}
+
 }  // namespace MathUtils
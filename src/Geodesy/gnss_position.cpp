@@ -0,0 +1,262 @@
+/**
+ * @file gnss_position.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Geodesy/gnss_position.h"
+
+#include "Geodesy/ecef_to_lla.h"
+#include "Internal/error_msg_helpers.h"
+#include "Internal/parallel_chunks.h"
+#include "LinAlg/cholesky.h"
+#include "LinAlg/Matrix.h"
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace MathUtils {
+
+namespace {
+
+constexpr std::size_t GNSS_NUM_UNKNOWNS = 4;  ///< Position and clock bias.
+
+/**
+ * @brief Check observation lengths.
+ *
+ * @param num_sats Number of satellite positions.
+ * @param num_ranges Number of pseudoranges.
+ *
+ * @exception std::length_error Mismatched lengths or fewer than four satellites.
+ */
+void check_observations(const std::size_t num_sats, const std::size_t num_ranges)
+{
+    if (num_sats != num_ranges)
+    {
+        throw std::length_error(Internal::mismatched_length_error_msg(num_sats, num_ranges));
+    }
+
+    if (num_sats < GNSS_NUM_UNKNOWNS)
+    {
+        throw std::length_error(
+            Internal::insufficient_length_error_msg(num_sats, GNSS_NUM_UNKNOWNS)
+        );
+    }
+}
+
+/**
+ * @brief DOP from the Cholesky factor of the normal matrix H^T * H.
+ *
+ * @param l Lower Cholesky factor of the normal matrix.
+ * @param lla Solution used for the east-north-up rotation.
+ * @return DOP values.
+ */
+GnssDop compute_dop(const Matrix<4,4>& l, const GeoCoord& lla)
+{
+    // cofactor matrix Q = (H^T * H)^-1, one column at a time
+    Matrix<4,4> q;
+    double* const pq = q.data();
+
+    for (std::size_t jj = 0; jj < GNSS_NUM_UNKNOWNS; jj++)
+    {
+        Vector<4> unit;
+        unit(jj) = 1.0;
+        const Vector<4> col = cholesky_solve(l, unit);
+
+        for (std::size_t ii = 0; ii < GNSS_NUM_UNKNOWNS; ii++)
+        {
+            pq[(ii * GNSS_NUM_UNKNOWNS) + jj] = col(ii);
+        }
+    }
+
+    const double slat = std::sin(lla.latitude());
+    const double clat = std::cos(lla.latitude());
+    const double slon = std::sin(lla.longitude());
+    const double clon = std::cos(lla.longitude());
+
+    const std::array<double, 3> east {-slon, clon, 0.0};
+    const std::array<double, 3> north {-slat * clon, -slat * slon, clat};
+    const std::array<double, 3> up {clat * clon, clat * slon, slat};
+
+    // quadratic form a^T * Q_pos * a over the position block
+    const auto project = [pq](const std::array<double, 3>& a) {
+        double sum = 0.0;
+
+        for (std::size_t ii = 0; ii < 3; ii++)
+        {
+            for (std::size_t jj = 0; jj < 3; jj++)
+            {
+                sum += (a[ii] * pq[(ii * GNSS_NUM_UNKNOWNS) + jj] * a[jj]);
+            }
+        }
+
+        return sum;
+    };
+
+    const double q_pos = pq[0] + pq[5] + pq[10];
+    const double q_time = pq[15];
+
+    GnssDop dop {};
+    dop.gdop = std::sqrt(q_pos + q_time);
+    dop.pdop = std::sqrt(q_pos);
+    dop.hdop = std::sqrt(project(east) + project(north));
+    dop.vdop = std::sqrt(project(up));
+    dop.tdop = std::sqrt(q_time);
+
+    return dop;
+}
+
+/**
+ * @brief Gauss-Newton solve without input checks.
+ */
+GnssSolution solve_unchecked(std::span<const Vector<3>> sat_pos_ecef_m,
+    std::span<const double> pseudorange_m,
+    const Vector<3>& initial_ecef_m,
+    const GnssSolverOptions& options)
+{
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+    GnssSolution sol {};
+    sol.position_ecef_m = initial_ecef_m;
+    sol.dop = GnssDop {nan, nan, nan, nan, nan};
+
+    double* const pos = sol.position_ecef_m.data();
+    double bias = 0.0;
+
+    // normal-equation workspace, reused across iterations
+    Matrix<4,4> normal;
+    Matrix<4,4> chol;
+    Vector<4> rhs;
+    double* const pn = normal.data();
+    double* const pr = rhs.data();
+
+    bool factored = false;
+
+    for (std::size_t iter = 0; iter < options.max_iterations; iter++)
+    {
+        normal.fill(0.0);
+        rhs.fill(0.0);
+
+        bool on_satellite = false;
+
+        for (std::size_t idx = 0; idx < sat_pos_ecef_m.size(); idx++)
+        {
+            const double* const sat = sat_pos_ecef_m[idx].data();
+            const double dx = pos[0] - sat[0];
+            const double dy = pos[1] - sat[1];
+            const double dz = pos[2] - sat[2];
+            const double range = std::sqrt((dx * dx) + (dy * dy) + (dz * dz));
+
+            // the line of sight is undefined when the estimate sits on a satellite
+            if (!(range > 0.0))
+            {
+                on_satellite = true;
+                break;
+            }
+
+            // Jacobian row [unit vector from satellite to receiver, 1]
+            const std::array<double, 4> h {dx / range, dy / range, dz / range, 1.0};
+            const double innovation = pseudorange_m[idx] - (range + bias);
+
+            // lower triangle only, which is all cholesky_decompose reads
+            for (std::size_t ii = 0; ii < GNSS_NUM_UNKNOWNS; ii++)
+            {
+                for (std::size_t jj = 0; jj <= ii; jj++)
+                {
+                    pn[(ii * GNSS_NUM_UNKNOWNS) + jj] += h[ii] * h[jj];
+                }
+
+                pr[ii] += h[ii] * innovation;
+            }
+        }
+
+        factored = !on_satellite && cholesky_decompose(normal, chol);
+
+        if (!factored)
+        {
+            sol.iterations = iter + 1;
+            sol.clock_bias_m = bias;
+            sol.position_lla = ecef_to_lla(sol.position_ecef_m);
+            return sol;
+        }
+
+        const Vector<4> step = cholesky_solve(chol, rhs);
+        pos[0] += step(0);
+        pos[1] += step(1);
+        pos[2] += step(2);
+        bias += step(3);
+
+        sol.iterations = iter + 1;
+
+        if (step.magnitude() < options.step_tolerance_m)
+        {
+            sol.converged = true;
+            break;
+        }
+    }
+
+    sol.clock_bias_m = bias;
+    sol.position_lla = ecef_to_lla(sol.position_ecef_m);
+
+    if (factored)
+    {
+        sol.dop = compute_dop(chol, sol.position_lla);
+    }
+
+    return sol;
+}
+
+}  // namespace
+
+GnssSolution solve_gnss_position(std::span<const Vector<3>> sat_pos_ecef_m,
+    std::span<const double> pseudorange_m,
+    const Vector<3>& initial_ecef_m,
+    const GnssSolverOptions& options)
+{
+    check_observations(sat_pos_ecef_m.size(), pseudorange_m.size());
+
+    return solve_unchecked(sat_pos_ecef_m, pseudorange_m, initial_ecef_m, options);
+}
+
+void solve_gnss_position(std::span<const GnssEpoch> epochs,
+    std::span<GnssSolution> solutions,
+    const GnssSolverOptions& options,
+    const std::size_t num_threads)
+{
+    if (epochs.size() != solutions.size())
+    {
+        throw std::length_error(
+            Internal::mismatched_length_error_msg(epochs.size(), solutions.size())
+        );
+    }
+
+    for (const auto& epoch : epochs)
+    {
+        check_observations(epoch.sat_pos_ecef_m.size(), epoch.pseudorange_m.size());
+    }
+
+    // each chunk warm-starts from its own previous epoch, beginning at the earth's center
+    const auto solve_range = [&](const std::size_t, const std::size_t first,
+        const std::size_t last) {
+        Vector<3> seed;
+
+        for (std::size_t idx = first; idx < last; idx++)
+        {
+            solutions[idx] = solve_unchecked(
+                epochs[idx].sat_pos_ecef_m, epochs[idx].pseudorange_m, seed, options
+            );
+
+            if (solutions[idx].converged)
+            {
+                seed = solutions[idx].position_ecef_m;
+            }
+        }
+    };
+
+    Internal::parallel_chunks(epochs.size(), Internal::worker_count(num_threads, epochs.size()),
+        solve_range);
+}
+
+}  // namespace MathUtils
@@ -7,11 +7,25 @@
 #include "Geodesy/lla_to_ecef.h"
 
 #include "constants.h"
+#include "Internal/error_msg_helpers.h"
+#include "Internal/parallel_chunks.h"
 
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
+#include <vector>
 
 namespace MathUtils {
 
+namespace {
+
+/**
+ * @brief Fewest grid points per worker thread when the thread count is picked automatically.
+ */
+constexpr std::size_t GRID_POINTS_PER_WORKER = 16384;
+
+}  // namespace
+
 Vector<3> lla_to_ecef(const GeoCoord& lla)
 {
     const double sin_lat_rad = std::sin(lla.latitude());
@@ -30,4 +44,91 @@ Vector<3> lla_to_ecef(const GeoCoord& lla)
     };
 }
 
+void lla_to_ecef_grid(std::span<const double> lat_rad,
+    std::span<const double> lon_rad,
+    std::span<const double> altitude_m,
+    std::span<double> x_m,
+    std::span<double> y_m,
+    std::span<double> z_m,
+    const std::size_t num_threads)
+{
+    const std::size_t rows = lat_rad.size();
+    const std::size_t cols = lon_rad.size();
+    const std::size_t num = rows * cols;
+
+    if (!altitude_m.empty() && (altitude_m.size() != num))
+    {
+        throw std::length_error(Internal::mismatched_length_error_msg(num, altitude_m.size()));
+    }
+
+    for (const std::size_t len : {x_m.size(), y_m.size(), z_m.size()})
+    {
+        if (len != num)
+        {
+            throw std::length_error(Internal::mismatched_length_error_msg(num, len));
+        }
+    }
+
+    // longitude trig once per column
+    std::vector<double> cos_lon(cols);
+    std::vector<double> sin_lon(cols);
+
+    for (std::size_t jj = 0; jj < cols; jj++)
+    {
+        cos_lon[jj] = std::cos(lon_rad[jj]);
+        sin_lon[jj] = std::sin(lon_rad[jj]);
+    }
+
+    const bool has_altitude = !altitude_m.empty();
+
+    // every worker reads the shared column trig
+    const auto convert_rows = [&](const std::size_t, const std::size_t first,
+        const std::size_t last) {
+        for (std::size_t ii = first; ii < last; ii++)
+        {
+            // latitude terms once per row
+            const double sin_lat_rad = std::sin(lat_rad[ii]);
+            const double cos_lat_rad = std::cos(lat_rad[ii]);
+            const double c_term = Constants::WGS84_A_M /
+                std::sqrt(1.0 - (Constants::WGS84_ECC2 * sin_lat_rad * sin_lat_rad));
+            const double s_term = c_term * (1.0 - Constants::WGS84_ECC2);
+
+            const std::size_t offset = ii * cols;
+            double* const xr = x_m.data() + offset;
+            double* const yr = y_m.data() + offset;
+            double* const zr = z_m.data() + offset;
+
+            if (!has_altitude)
+            {
+                const double rc = c_term * cos_lat_rad;
+                const double zs = s_term * sin_lat_rad;
+
+                for (std::size_t jj = 0; jj < cols; jj++)
+                {
+                    xr[jj] = rc * cos_lon[jj];
+                    yr[jj] = rc * sin_lon[jj];
+                    zr[jj] = zs;
+                }
+
+                continue;
+            }
+
+            const double* const hr = altitude_m.data() + offset;
+
+            for (std::size_t jj = 0; jj < cols; jj++)
+            {
+                const double rc = (c_term + hr[jj]) * cos_lat_rad;
+                xr[jj] = rc * cos_lon[jj];
+                yr[jj] = rc * sin_lon[jj];
+                zr[jj] = (s_term + hr[jj]) * sin_lat_rad;
+            }
+        }
+    };
+
+    const std::size_t min_rows = GRID_POINTS_PER_WORKER / std::max<std::size_t>(cols, 1);
+
+    Internal::parallel_chunks(rows, Internal::worker_count(num_threads, rows, min_rows),
+        convert_rows);
+}
+
 }  // namespace MathUtils
@@ -0,0 +1,143 @@
+/**
+ * @file ray_ellipsoid.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Geodesy/ray_ellipsoid.h"
+
+#include "Attitude/quaternion_to_dcm.h"
+#include "constants.h"
+#include "Geodesy/ecef_to_lla.h"
+#include "Internal/error_msg_helpers.h"
+#include "LinAlg/Matrix.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace MathUtils {
+
+namespace {
+
+/**
+ * @brief Nearer root of the ray and an origin-centered ellipsoid, all inputs pre-scaled.
+ *
+ * @details Coordinates are divided by the semi-axes, so the ellipsoid is the unit sphere.
+ *
+ * @param ox Scaled origin x.
+ * @param oy Scaled origin y.
+ * @param oz Scaled origin z.
+ * @param dx Scaled direction x.
+ * @param dy Scaled direction y.
+ * @param dz Scaled direction z.
+ * @return Ray parameter of the first intersection, NaN on a miss.
+ */
+inline double unit_sphere_range(const double ox, const double oy, const double oz,
+    const double dx, const double dy, const double dz) noexcept
+{
+    const double a = (dx * dx) + (dy * dy) + (dz * dz);
+    const double b = (ox * dx) + (oy * dy) + (oz * dz);
+    const double c = (ox * ox) + (oy * oy) + (oz * oz) - 1.0;
+    const double disc = (b * b) - (a * c);
+
+    const double t = (-b - std::sqrt(std::fmax(disc, 0.0))) / a;
+
+    // select, not branch: a miss has no real root or a root behind the origin
+    const bool hit = (disc >= 0.0) && (t >= 0.0);
+
+    return hit ? t : std::numeric_limits<double>::quiet_NaN();
+}
+
+}  // namespace
+
+double ray_ellipsoid_range(const Vector<3>& origin_ecef_m,
+    const Vector<3>& dir_ecef,
+    const double height_m) noexcept
+{
+    const double inv_a = 1.0 / (Constants::WGS84_A_M + height_m);
+    const double inv_b = 1.0 / (Constants::WGS84_B_M + height_m);
+
+    const double* const o = origin_ecef_m.data();
+    const double* const d = dir_ecef.data();
+
+    return unit_sphere_range(o[0] * inv_a, o[1] * inv_a, o[2] * inv_b,
+        d[0] * inv_a, d[1] * inv_a, d[2] * inv_b);
+}
+
+void ray_ellipsoid_range(const Vector<3>& origin_ecef_m,
+    const Vector3Batch& dir_ecef,
+    std::span<double> range,
+    const double height_m)
+{
+    if (dir_ecef.size() != range.size())
+    {
+        throw std::length_error(
+            Internal::mismatched_length_error_msg(dir_ecef.size(), range.size())
+        );
+    }
+
+    const double inv_a = 1.0 / (Constants::WGS84_A_M + height_m);
+    const double inv_b = 1.0 / (Constants::WGS84_B_M + height_m);
+
+    const double ox = origin_ecef_m(0) * inv_a;
+    const double oy = origin_ecef_m(1) * inv_a;
+    const double oz = origin_ecef_m(2) * inv_b;
+
+    const double* const dx = dir_ecef.x().data();
+    const double* const dy = dir_ecef.y().data();
+    const double* const dz = dir_ecef.z().data();
+    double* const out = range.data();
+
+    for (std::size_t idx = 0; idx < range.size(); idx++)
+    {
+        out[idx] = unit_sphere_range(ox, oy, oz,
+            dx[idx] * inv_a, dy[idx] * inv_a, dz[idx] * inv_b);
+    }
+}
+
+void geolocate_rays(const Vector<3>& cam_pos_ecef_m,
+    const Quaternion& q_ecef_cam,
+    const Vector3Batch& rays_cam,
+    std::span<GeoCoord> ground,
+    const double height_m)
+{
+    if (rays_cam.size() != ground.size())
+    {
+        throw std::length_error(
+            Internal::mismatched_length_error_msg(rays_cam.size(), ground.size())
+        );
+    }
+
+    const double inv_a = 1.0 / (Constants::WGS84_A_M + height_m);
+    const double inv_b = 1.0 / (Constants::WGS84_B_M + height_m);
+
+    const double px = cam_pos_ecef_m(0);
+    const double py = cam_pos_ecef_m(1);
+    const double pz = cam_pos_ecef_m(2);
+    const double ox = px * inv_a;
+    const double oy = py * inv_a;
+    const double oz = pz * inv_b;
+
+    // one rotation for the whole frame
+    const Matrix<3,3> dcm = quaternion_to_dcm(q_ecef_cam);
+    const double* const c = dcm.data();
+
+    const double* const rx = rays_cam.x().data();
+    const double* const ry = rays_cam.y().data();
+    const double* const rz = rays_cam.z().data();
+
+    for (std::size_t idx = 0; idx < ground.size(); idx++)
+    {
+        const double ex = (c[0] * rx[idx]) + (c[1] * ry[idx]) + (c[2] * rz[idx]);
+        const double ey = (c[3] * rx[idx]) + (c[4] * ry[idx]) + (c[5] * rz[idx]);
+        const double ez = (c[6] * rx[idx]) + (c[7] * ry[idx]) + (c[8] * rz[idx]);
+
+        const double t = unit_sphere_range(ox, oy, oz, ex * inv_a, ey * inv_a, ez * inv_b);
+
+        // NaN range carries through to a NaN ground point
+        ground[idx] = ecef_to_lla(Vector<3> {px + (t * ex), py + (t * ey), pz + (t * ez)});
+    }
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,61 @@
+/**
+ * @file DynamicMatrix.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/DynamicMatrix.h"
+
+#include "Internal/error_msg_helpers.h"
+#include "LinAlg/summation.h"
+
+#include <stdexcept>
+
+namespace MathUtils {
+
+DynamicMatrix::DynamicMatrix(const std::size_t rows, const std::size_t cols)
+    :m_rows{rows},
+    m_cols{cols},
+    m_arr(rows * cols, 0.0)
+{}
+
+double& DynamicMatrix::operator()(const std::size_t row, const std::size_t col)
+{
+    if ((row >= m_rows) || (col >= m_cols))
+    {
+        throw std::out_of_range(Internal::invalid_index_error_msg(row, col, m_rows, m_cols));
+    }
+
+    return m_arr[(row * m_cols) + col];
+}
+
+const double& DynamicMatrix::operator()(const std::size_t row, const std::size_t col) const
+{
+    if ((row >= m_rows) || (col >= m_cols))
+    {
+        throw std::out_of_range(Internal::invalid_index_error_msg(row, col, m_rows, m_cols));
+    }
+
+    return m_arr[(row * m_cols) + col];
+}
+
+void DynamicMatrix::multiply(std::span<const double> x, std::span<double> y) const
+{
+    if (x.size() != m_cols)
+    {
+        throw std::length_error(Internal::mismatched_dimension_error_msg(x.size(), m_cols));
+    }
+
+    if (y.size() != m_rows)
+    {
+        throw std::length_error(Internal::mismatched_dimension_error_msg(y.size(), m_rows));
+    }
+
+    for (std::size_t ii = 0; ii < m_rows; ii++)
+    {
+        const double* const row = m_arr.data() + (ii * m_cols);
+        y[ii] = pairwise_sum(0, m_cols, [row, x](const std::size_t jj){return row[jj] * x[jj];});
+    }
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,52 @@
+/**
+ * @file ScratchArena.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/ScratchArena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace MathUtils {
+
+ScratchArena::ScratchArena(const std::size_t capacity_bytes)
+    :m_buffer{std::make_unique<std::byte[]>(capacity_bytes)},
+    m_capacity{capacity_bytes}
+{}
+
+ScratchArena& ScratchArena::thread_local_instance()
+{
+    thread_local ScratchArena arena(SCRATCH_ARENA_DEFAULT_CAPACITY_BYTES);
+    return arena;
+}
+
+void* ScratchArena::allocate(const std::size_t num_bytes, const std::size_t alignment)
+{
+    assert((alignment != 0) && ((alignment & (alignment - 1)) == 0));
+
+    // align the absolute address, not the offset
+    const auto base = reinterpret_cast<std::uintptr_t>(m_buffer.get());
+    const std::uintptr_t aligned = (base + m_used + (alignment - 1)) & ~(alignment - 1);
+    const std::size_t start = aligned - base;
+
+    if ((start > m_capacity) || (num_bytes > (m_capacity - start)))
+    {
+        throw std::bad_alloc();
+    }
+
+    m_used = start + num_bytes;
+    m_peak = std::max(m_peak, m_used);
+
+    return m_buffer.get() + start;
+}
+
+void ScratchArena::rewind(const std::size_t marker) noexcept
+{
+    assert(marker <= m_used);
+    m_used = marker;
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,125 @@
+/**
+ * @file SparseMatrix.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/SparseMatrix.h"
+
+#include "Internal/error_msg_helpers.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace MathUtils {
+
+SparseMatrix::SparseMatrix(const std::size_t rows, const std::size_t cols,
+    std::span<const SparseEntry> entries)
+    :m_rows{rows},
+    m_cols{cols},
+    m_row_offsets(rows + 1, 0)
+{
+    std::vector<SparseEntry> sorted(entries.begin(), entries.end());
+
+    for (const auto& entry : sorted)
+    {
+        if ((entry.row >= rows) || (entry.col >= cols))
+        {
+            throw std::out_of_range(
+                Internal::invalid_index_error_msg(entry.row, entry.col, rows, cols)
+            );
+        }
+    }
+
+    std::sort(sorted.begin(), sorted.end(), [](const SparseEntry& a, const SparseEntry& b){
+        return (a.row < b.row) || ((a.row == b.row) && (a.col < b.col));
+    });
+
+    m_col_indices.reserve(sorted.size());
+    m_values.reserve(sorted.size());
+
+    for (std::size_t idx = 0; idx < sorted.size(); idx++)
+    {
+        const SparseEntry& entry = sorted[idx];
+        const bool duplicate = (idx > 0) && (sorted[idx - 1].row == entry.row) &&
+            (sorted[idx - 1].col == entry.col);
+
+        if (duplicate)
+        {
+            m_values.back() += entry.value;
+            continue;
+        }
+
+        m_col_indices.push_back(entry.col);
+        m_values.push_back(entry.value);
+        m_row_offsets[entry.row + 1]++;
+    }
+
+    // per-row counts to offsets
+    for (std::size_t ii = 0; ii < rows; ii++)
+    {
+        m_row_offsets[ii + 1] += m_row_offsets[ii];
+    }
+}
+
+double SparseMatrix::operator()(const std::size_t row, const std::size_t col) const
+{
+    if ((row >= m_rows) || (col >= m_cols))
+    {
+        throw std::out_of_range(Internal::invalid_index_error_msg(row, col, m_rows, m_cols));
+    }
+
+    const auto first = m_col_indices.begin() + static_cast<std::ptrdiff_t>(m_row_offsets[row]);
+    const auto last = m_col_indices.begin() + static_cast<std::ptrdiff_t>(m_row_offsets[row + 1]);
+    const auto found = std::lower_bound(first, last, col);
+
+    if ((found == last) || (*found != col))
+    {
+        return 0.0;
+    }
+
+    return m_values[static_cast<std::size_t>(found - m_col_indices.begin())];
+}
+
+void SparseMatrix::multiply(std::span<const double> x, std::span<double> y) const
+{
+    if (x.size() != m_cols)
+    {
+        throw std::length_error(Internal::mismatched_dimension_error_msg(x.size(), m_cols));
+    }
+
+    if (y.size() != m_rows)
+    {
+        throw std::length_error(Internal::mismatched_dimension_error_msg(y.size(), m_rows));
+    }
+
+    const std::size_t* const offsets = m_row_offsets.data();
+    const std::size_t* const cols = m_col_indices.data();
+    const double* const vals = m_values.data();
+
+    for (std::size_t ii = 0; ii < m_rows; ii++)
+    {
+        double sum = 0.0;
+
+        for (std::size_t idx = offsets[ii]; idx < offsets[ii + 1]; idx++)
+        {
+            sum += vals[idx] * x[cols[idx]];
+        }
+
+        y[ii] = sum;
+    }
+}
+
+std::vector<double> SparseMatrix::diagonal() const
+{
+    std::vector<double> res(std::min(m_rows, m_cols), 0.0);
+
+    for (std::size_t ii = 0; ii < res.size(); ii++)
+    {
+        res[ii] = (*this)(ii, ii);
+    }
+
+    return res;
+}
+
+}  // namespace MathUtils
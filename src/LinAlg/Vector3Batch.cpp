@@ -0,0 +1,270 @@
+/**
+ * @file Vector3Batch.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/Vector3Batch.h"
+
+#include "acos_safe.h"
+#include "Internal/error_msg_helpers.h"
+#include "range_constrain.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace MathUtils {
+
+namespace {
+
+/**
+ * @brief Read-only view of a Vector3Batch for the kernels below.
+ */
+struct BatchView {
+    const double* x;
+    const double* y;
+    const double* z;
+
+    explicit BatchView(const Vector3Batch& batch)
+        :x{batch.x().data()},
+        y{batch.y().data()},
+        z{batch.z().data()}
+    {}
+
+    [[nodiscard]] double get_x(const std::size_t idx) const noexcept {return x[idx];}
+    [[nodiscard]] double get_y(const std::size_t idx) const noexcept {return y[idx];}
+    [[nodiscard]] double get_z(const std::size_t idx) const noexcept {return z[idx];}
+};
+
+/**
+ * @brief Single vector broadcast to every index, with the same interface as BatchView.
+ */
+struct BroadcastView {
+    double x;
+    double y;
+    double z;
+
+    explicit BroadcastView(const Vector<3>& vec)
+        :x{vec(0)},
+        y{vec(1)},
+        z{vec(2)}
+    {}
+
+    [[nodiscard]] double get_x(const std::size_t /*idx*/) const noexcept {return x;}
+    [[nodiscard]] double get_y(const std::size_t /*idx*/) const noexcept {return y;}
+    [[nodiscard]] double get_z(const std::size_t /*idx*/) const noexcept {return z;}
+};
+
+void check_length(const std::size_t input_len, const std::size_t output_len)
+{
+    if (input_len != output_len)
+    {
+        throw std::length_error(Internal::mismatched_length_error_msg(input_len, output_len));
+    }
+}
+
+template<typename A>
+void dot_kernel(const A& a, const Vector3Batch& b, std::span<double> out)
+{
+    check_length(b.size(), out.size());
+
+    const BatchView vb(b);
+    double* const res = out.data();
+
+    for (std::size_t idx = 0; idx < out.size(); idx++)
+    {
+        res[idx] = (a.get_x(idx) * vb.x[idx]) + (a.get_y(idx) * vb.y[idx]) +
+            (a.get_z(idx) * vb.z[idx]);
+    }
+}
+
+template<typename A>
+void cross_kernel(const A& a, const Vector3Batch& b, Vector3Batch& out)
+{
+    const std::size_t len = b.size();
+    out.resize(len);
+
+    const BatchView vb(b);
+    double* const rx = out.x().data();
+    double* const ry = out.y().data();
+    double* const rz = out.z().data();
+
+    for (std::size_t idx = 0; idx < len; idx++)
+    {
+        const double ax = a.get_x(idx);
+        const double ay = a.get_y(idx);
+        const double az = a.get_z(idx);
+
+        rx[idx] = (ay * vb.z[idx]) - (az * vb.y[idx]);
+        ry[idx] = (az * vb.x[idx]) - (ax * vb.z[idx]);
+        rz[idx] = (ax * vb.y[idx]) - (ay * vb.x[idx]);
+    }
+}
+
+template<typename A>
+void angle_kernel(const A& a, const Vector3Batch& b, std::span<double> out)
+{
+    check_length(b.size(), out.size());
+
+    const BatchView vb(b);
+    double* const res = out.data();
+
+    // compute clamped cosines first so this loop stays branch-free
+    for (std::size_t idx = 0; idx < out.size(); idx++)
+    {
+        const double ax = a.get_x(idx);
+        const double ay = a.get_y(idx);
+        const double az = a.get_z(idx);
+
+        const double ab = (ax * vb.x[idx]) + (ay * vb.y[idx]) + (az * vb.z[idx]);
+        const double aa = (ax * ax) + (ay * ay) + (az * az);
+        const double bb = (vb.x[idx] * vb.x[idx]) + (vb.y[idx] * vb.y[idx]) +
+            (vb.z[idx] * vb.z[idx]);
+        const double denom = std::sqrt(aa * bb);
+
+        res[idx] = range_constrain((denom > 0.0) ? (ab / denom) : 0.0, -1.0, 1.0);
+    }
+
+    for (std::size_t idx = 0; idx < out.size(); idx++)
+    {
+        res[idx] = acos_safe(res[idx]);
+    }
+}
+
+}  // namespace
+
+// =================================================================================================
+// VECTOR3BATCH
+// =================================================================================================
+
+Vector3Batch::Vector3Batch(const std::size_t size)
+    :m_x(size, 0.0),
+    m_y(size, 0.0),
+    m_z(size, 0.0)
+{}
+
+Vector3Batch::Vector3Batch(std::span<const Vector<3>> vecs)
+    :Vector3Batch(vecs.size())
+{
+    for (std::size_t idx = 0; idx < vecs.size(); idx++)
+    {
+        m_x[idx] = vecs[idx](0);
+        m_y[idx] = vecs[idx](1);
+        m_z[idx] = vecs[idx](2);
+    }
+}
+
+void Vector3Batch::resize(const std::size_t size)
+{
+    m_x.resize(size, 0.0);
+    m_y.resize(size, 0.0);
+    m_z.resize(size, 0.0);
+}
+
+Vector<3> Vector3Batch::get(const std::size_t idx) const
+{
+    return Vector<3> {m_x.at(idx), m_y.at(idx), m_z.at(idx)};
+}
+
+void Vector3Batch::set(const std::size_t idx, const Vector<3>& vec)
+{
+    m_x.at(idx) = vec(0);
+    m_y.at(idx) = vec(1);
+    m_z.at(idx) = vec(2);
+}
+
+// =================================================================================================
+// BATCH KERNELS
+// =================================================================================================
+
+void batch_dot(const Vector3Batch& a, const Vector3Batch& b, std::span<double> out)
+{
+    check_length(a.size(), b.size());
+    dot_kernel(BatchView(a), b, out);
+}
+
+void batch_dot(const Vector<3>& a, const Vector3Batch& b, std::span<double> out)
+{
+    dot_kernel(BroadcastView(a), b, out);
+}
+
+void batch_cross(const Vector3Batch& a, const Vector3Batch& b, Vector3Batch& out)
+{
+    check_length(a.size(), b.size());
+
+    if ((&out == &a) || (&out == &b))
+    {
+        const Vector3Batch tmp(out);
+        batch_cross((&out == &a) ? tmp : a, (&out == &b) ? tmp : b, out);
+        return;
+    }
+
+    cross_kernel(BatchView(a), b, out);
+}
+
+void batch_cross(const Vector<3>& a, const Vector3Batch& b, Vector3Batch& out)
+{
+    if (&out == &b)
+    {
+        const Vector3Batch tmp(b);
+        cross_kernel(BroadcastView(a), tmp, out);
+        return;
+    }
+
+    cross_kernel(BroadcastView(a), b, out);
+}
+
+void batch_cross_normalized(const Vector3Batch& a, const Vector3Batch& b, Vector3Batch& out)
+{
+    batch_cross(a, b, out);
+
+    double* const rx = out.x().data();
+    double* const ry = out.y().data();
+    double* const rz = out.z().data();
+
+    for (std::size_t idx = 0; idx < out.size(); idx++)
+    {
+        const double inv_magn = 1.0 / std::sqrt(
+            (rx[idx] * rx[idx]) + (ry[idx] * ry[idx]) + (rz[idx] * rz[idx])
+        );
+
+        rx[idx] *= inv_magn;
+        ry[idx] *= inv_magn;
+        rz[idx] *= inv_magn;
+    }
+}
+
+void batch_triple_product(const Vector3Batch& a, const Vector3Batch& b, const Vector3Batch& c,
+    std::span<double> out)
+{
+    check_length(a.size(), b.size());
+    check_length(a.size(), c.size());
+    check_length(a.size(), out.size());
+
+    const BatchView va(a);
+    const BatchView vb(b);
+    const BatchView vc(c);
+    double* const res = out.data();
+
+    for (std::size_t idx = 0; idx < out.size(); idx++)
+    {
+        const double cx = (vb.y[idx] * vc.z[idx]) - (vb.z[idx] * vc.y[idx]);
+        const double cy = (vb.z[idx] * vc.x[idx]) - (vb.x[idx] * vc.z[idx]);
+        const double cz = (vb.x[idx] * vc.y[idx]) - (vb.y[idx] * vc.x[idx]);
+
+        res[idx] = (va.x[idx] * cx) + (va.y[idx] * cy) + (va.z[idx] * cz);
+    }
+}
+
+void batch_angle_between(const Vector3Batch& a, const Vector3Batch& b, std::span<double> out)
+{
+    check_length(a.size(), b.size());
+    angle_kernel(BatchView(a), b, out);
+}
+
+void batch_angle_between(const Vector<3>& a, const Vector3Batch& b, std::span<double> out)
+{
+    angle_kernel(BroadcastView(a), b, out);
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,149 @@
+/**
+ * @file iterative_solvers.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/iterative_solvers.h"
+
+#include "Internal/parallel_chunks.h"
+#include "LinAlg/summation.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+namespace MathUtils {
+
+void IdentityPreconditioner::apply(std::span<const double> r, std::span<double> z) const noexcept
+{
+    assert(r.size() == z.size());
+    std::copy(r.begin(), r.end(), z.begin());
+}
+
+JacobiPreconditioner::JacobiPreconditioner(std::span<const double> diag)
+    :m_inv_diag(diag.size(), 1.0)
+{
+    for (std::size_t idx = 0; idx < diag.size(); idx++)
+    {
+        const double val = diag[idx];
+        m_inv_diag[idx] = ((val < 0.0) || (val > 0.0)) ? (1.0 / val) : 1.0;
+    }
+}
+
+void JacobiPreconditioner::apply(std::span<const double> r, std::span<double> z) const noexcept
+{
+    assert(r.size() == m_inv_diag.size());
+    assert(z.size() == m_inv_diag.size());
+
+    const double* const inv_diag = m_inv_diag.data();
+
+    for (std::size_t idx = 0; idx < r.size(); idx++)
+    {
+        z[idx] = r[idx] * inv_diag[idx];
+    }
+}
+
+void ConjugateGradientWorkspace::resize(const std::size_t len)
+{
+    r.resize(len);
+    z.resize(len);
+    p.resize(len);
+    ap.resize(len);
+}
+
+void GmresWorkspace::resize(const std::size_t len, const std::size_t restart)
+{
+    basis.resize((restart + 1) * len);
+    hessenberg.resize((restart + 1) * restart);
+    cs.resize(restart);
+    sn.resize(restart);
+    g.resize(restart + 1);
+    y.resize(restart);
+    w.resize(len);
+    z.resize(len);
+}
+
+namespace Internal {
+
+namespace {
+
+/**
+ * @brief Number of fixed-size chunks covering a span of `len` elements.
+ */
+std::size_t span_chunk_count(const std::size_t len) noexcept
+{
+    return (len + SPAN_CHUNK_LEN - 1) / SPAN_CHUNK_LEN;
+}
+
+}  // namespace
+
+double span_dot(std::span<const double> a, std::span<const double> b)
+{
+    assert(a.size() == b.size());
+
+    const double* const pa = a.data();
+    const double* const pb = b.data();
+    const auto term = [pa, pb](const std::size_t idx){return pa[idx] * pb[idx];};
+
+    const std::size_t len = a.size();
+
+    if (len < SPAN_PARALLEL_MIN_LEN)
+    {
+        return pairwise_sum(0, len, term);
+    }
+
+    // chunk boundaries only depend on the length, so the sum does not depend on the thread count
+    const std::size_t num_chunks = span_chunk_count(len);
+    std::vector<double> partials(num_chunks);
+
+    parallel_chunks(num_chunks, worker_count(0, num_chunks),
+        [&partials, &term, len](const std::size_t, const std::size_t first, const std::size_t last) {
+            for (std::size_t chunk = first; chunk < last; chunk++)
+            {
+                partials[chunk] = pairwise_sum(chunk * SPAN_CHUNK_LEN,
+                    std::min((chunk + 1) * SPAN_CHUNK_LEN, len), term);
+            }
+        });
+
+    return pairwise_sum(partials);
+}
+
+double span_norm(std::span<const double> a)
+{
+    return std::sqrt(span_dot(a, a));
+}
+
+void span_axpy(const double alpha, std::span<const double> x, std::span<double> y)
+{
+    assert(x.size() == y.size());
+
+    const double* const px = x.data();
+    double* const py = y.data();
+
+    const auto axpy_range = [alpha, px, py](const std::size_t first, const std::size_t last) {
+        for (std::size_t idx = first; idx < last; idx++)
+        {
+            py[idx] += alpha * px[idx];
+        }
+    };
+
+    const std::size_t len = x.size();
+
+    if (len < SPAN_PARALLEL_MIN_LEN)
+    {
+        axpy_range(0, len);
+        return;
+    }
+
+    const std::size_t num_chunks = span_chunk_count(len);
+
+    parallel_chunks(num_chunks, worker_count(0, num_chunks),
+        [&axpy_range, len](const std::size_t, const std::size_t first, const std::size_t last) {
+            axpy_range(first * SPAN_CHUNK_LEN, std::min(last * SPAN_CHUNK_LEN, len));
+        });
+}
+
+}  // namespace Internal
+}  // namespace MathUtils
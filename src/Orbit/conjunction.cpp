@@ -0,0 +1,317 @@
+/**
+ * @file conjunction.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Orbit/conjunction.h"
+
+#include "constants.h"
+#include "Internal/parallel_chunks.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace MathUtils {
+
+namespace {
+
+/**
+ * @brief Fewest catalog objects per worker thread when the thread count is picked automatically.
+ */
+constexpr std::size_t OBJECTS_PER_WORKER = 256;
+
+/**
+ * @brief Iteration limit for the time of closest approach search.
+ */
+constexpr std::size_t TCA_MAX_ITERATIONS = 100;
+
+/**
+ * @brief Offset applied to each cell coordinate so it packs into 21 unsigned bits.
+ */
+constexpr std::int64_t CELL_OFFSET = std::int64_t {1} << 20;
+
+/**
+ * @brief Grid coordinate of a position component.
+ *
+ * @details Clamped so neighbors of edge cells still pack. Far objects that share a clamped cell
+ * only cost extra distance checks.
+ *
+ * @param pos_m Position component [m].
+ * @param inv_cell_m Reciprocal of the cell size [1/m].
+ * @return Cell coordinate.
+ */
+std::int64_t cell_coord(const double pos_m, const double inv_cell_m)
+{
+    constexpr auto limit = static_cast<double>(CELL_OFFSET - 2);
+    return static_cast<std::int64_t>(std::clamp(std::floor(pos_m * inv_cell_m), -limit, limit));
+}
+
+/**
+ * @brief Pack three cell coordinates into one sortable key.
+ *
+ * @param cx Cell x coordinate.
+ * @param cy Cell y coordinate.
+ * @param cz Cell z coordinate.
+ * @return Cell key.
+ */
+std::uint64_t cell_key(const std::int64_t cx, const std::int64_t cy, const std::int64_t cz)
+{
+    return (static_cast<std::uint64_t>(cx + CELL_OFFSET) << 42U) |
+        (static_cast<std::uint64_t>(cy + CELL_OFFSET) << 21U) |
+        static_cast<std::uint64_t>(cz + CELL_OFFSET);
+}
+
+/**
+ * @brief Relative position and velocity of two objects at a time.
+ */
+struct RelativeState {
+    Vector<3> position_m;  ///< Secondary minus primary position [m].
+    Vector<3> velocity_mps;  ///< Secondary minus primary velocity [m/s].
+};
+
+RelativeState relative_state(const OrbitalElements& primary,
+    const OrbitalElements& secondary,
+    const double t_s,
+    const OrbitModel model)
+{
+    const OrbitState s1 = elements_to_state(propagate_elements(primary, t_s, model));
+    const OrbitState s2 = elements_to_state(propagate_elements(secondary, t_s, model));
+
+    return RelativeState {s2.position_m - s1.position_m, s2.velocity_mps - s1.velocity_mps};
+}
+
+/**
+ * @brief Refine a time of closest approach with the Illinois method on the range rate.
+ *
+ * @param primary Elements of the first object.
+ * @param secondary Elements of the second object.
+ * @param lo_s Interval start, where the range rate is negative [s].
+ * @param hi_s Interval end, where the range rate is non-negative [s].
+ * @param g_lo Range rate times range at `lo_s` [m^2/s].
+ * @param g_hi Range rate times range at `hi_s` [m^2/s].
+ * @param options Screening options.
+ * @return Time of closest approach [s].
+ */
+double refine_tca(const OrbitalElements& primary,
+    const OrbitalElements& secondary,
+    double lo_s,
+    double hi_s,
+    double g_lo,
+    double g_hi,
+    const ConjunctionOptions& options)
+{
+    double t_s = 0.5 * (lo_s + hi_s);
+    int side = 0;
+
+    for (std::size_t iter = 0; iter < TCA_MAX_ITERATIONS; iter++)
+    {
+        if ((hi_s - lo_s) <= options.time_tolerance_s)
+        {
+            break;
+        }
+
+        t_s = ((lo_s * g_hi) - (hi_s * g_lo)) / (g_hi - g_lo);
+
+        const RelativeState rel = relative_state(primary, secondary, t_s, options.model);
+        const double g = dot(rel.position_m, rel.velocity_mps);
+
+        // halve the stale end's value when the same end moves twice, so both ends converge
+        if (g < 0.0)
+        {
+            lo_s = t_s;
+            g_lo = g;
+            g_hi *= (side < 0) ? 0.5 : 1.0;
+            side = -1;
+        }
+        else
+        {
+            hi_s = t_s;
+            g_hi = g;
+            g_lo *= (side > 0) ? 0.5 : 1.0;
+            side = 1;
+        }
+    }
+
+    return t_s;
+}
+
+}  // namespace
+
+std::vector<Conjunction> screen_conjunctions(std::span<const OrbitalElements> catalog,
+    const double start_s,
+    const double duration_s,
+    const ConjunctionOptions& options,
+    const std::size_t num_threads)
+{
+    if (!(options.threshold_m > 0.0) || !(options.step_s > 0.0) || !(duration_s > 0.0))
+    {
+        throw std::invalid_argument("Conjunction threshold, step, and duration must be positive.");
+    }
+
+    const std::size_t num = catalog.size();
+    const double end_s = start_s + duration_s;
+    const double threshold = options.threshold_m;
+
+    // perigee and apogee radii; J2 secular drift leaves both unchanged
+    std::vector<double> perigee_m(num);
+    std::vector<double> apogee_m(num);
+
+    for (std::size_t idx = 0; idx < num; idx++)
+    {
+        const double a = catalog[idx].semi_major_axis_m;
+        const double e = catalog[idx].eccentricity;
+        perigee_m[idx] = a * (1.0 - e);
+        apogee_m[idx] = a * (1.0 + e);
+    }
+
+    // buffers reused every step
+    std::vector<OrbitState> states(num);
+    std::vector<std::pair<std::uint64_t, std::size_t>> cells(num);
+
+    const auto key_less = [](const std::pair<std::uint64_t, std::size_t>& lhs, const std::uint64_t key)
+    {
+        return lhs.first < key;
+    };
+
+    // check one candidate pair in the sample interval [lo, hi)
+    const auto screen_pair = [&](const std::size_t ii, const std::size_t jj, const double lo_s,
+        const double hi_s, const double half_s, const double accel_pad_m,
+        std::vector<Conjunction>& found) {
+        // each pair once, and only if the radial shells come within range
+        if ((jj <= ii) ||
+            ((std::fmax(perigee_m[ii], perigee_m[jj]) - std::fmin(apogee_m[ii], apogee_m[jj])) >
+            threshold))
+        {
+            return;
+        }
+
+        const Vector<3> dr = states[jj].position_m - states[ii].position_m;
+        const Vector<3> dv = states[jj].velocity_mps - states[ii].velocity_mps;
+
+        const double closest_bound = dr.magnitude() - (dv.magnitude() * half_s) - accel_pad_m;
+
+        if (closest_bound >= threshold)
+        {
+            return;
+        }
+
+        // closest approach inside [lo, hi) needs the range rate to turn
+        const RelativeState rel_lo = relative_state(catalog[ii], catalog[jj], lo_s, options.model);
+        const RelativeState rel_hi = relative_state(catalog[ii], catalog[jj], hi_s, options.model);
+        const double g_lo = dot(rel_lo.position_m, rel_lo.velocity_mps);
+        const double g_hi = dot(rel_hi.position_m, rel_hi.velocity_mps);
+
+        if (!(g_lo < 0.0) || !(g_hi >= 0.0))
+        {
+            return;
+        }
+
+        const double tca_s = refine_tca(catalog[ii], catalog[jj], lo_s, hi_s, g_lo, g_hi, options);
+        const RelativeState rel = relative_state(catalog[ii], catalog[jj], tca_s, options.model);
+        const double miss_m = rel.position_m.magnitude();
+
+        if (miss_m < threshold)
+        {
+            found.push_back(Conjunction {ii, jj, tca_s, miss_m, rel.velocity_mps.magnitude()});
+        }
+    };
+
+    // one result list per worker, merged before the final sort
+    const std::size_t num_workers = Internal::worker_count(num_threads, num, OBJECTS_PER_WORKER);
+    std::vector<std::vector<Conjunction>> found_by_worker(num_workers);
+
+    const auto num_steps = static_cast<std::size_t>(std::ceil(duration_s / options.step_s));
+
+    for (std::size_t step = 0; step < num_steps; step++)
+    {
+        // each sample owns [lo, hi), so intervals partition the window
+        const double lo_s = start_s + (static_cast<double>(step) * options.step_s);
+        const double hi_s = std::fmin(lo_s + options.step_s, end_s);
+        const double half_s = 0.5 * (hi_s - lo_s);
+        const double mid_s = lo_s + half_s;
+
+        propagate_constellation(catalog, mid_s, states, options.model, Constants::WGS84_GM_M3PS2,
+            num_threads);
+
+        double max_speed = 0.0;
+        double min_radius = std::numeric_limits<double>::infinity();
+
+        for (const OrbitState& state : states)
+        {
+            max_speed = std::fmax(max_speed, state.velocity_mps.magnitude());
+            min_radius = std::fmin(min_radius, state.position_m.magnitude());
+        }
+
+        // bound on how far relative motion can close the range within half a step
+        const double max_rel_accel = 2.0 * Constants::WGS84_GM_M3PS2 / (min_radius * min_radius);
+        const double accel_pad_m = 0.5 * max_rel_accel * half_s * half_s;
+        const double cell_m = threshold + (2.0 * max_speed * half_s) + accel_pad_m;
+        const double inv_cell_m = 1.0 / cell_m;
+
+        for (std::size_t idx = 0; idx < num; idx++)
+        {
+            const Vector<3>& pos = states[idx].position_m;
+            cells[idx] = {cell_key(cell_coord(pos(0), inv_cell_m), cell_coord(pos(1), inv_cell_m),
+                cell_coord(pos(2), inv_cell_m)), idx};
+        }
+
+        std::sort(cells.begin(), cells.end());
+
+        // cells and states are read-only from here, so objects split across workers
+        const auto screen_range = [&](const std::size_t worker, const std::size_t first,
+            const std::size_t last) {
+            std::vector<Conjunction>& found = found_by_worker[worker];
+
+            for (std::size_t ii = first; ii < last; ii++)
+            {
+                const Vector<3>& pos_i = states[ii].position_m;
+                const std::int64_t cx = cell_coord(pos_i(0), inv_cell_m);
+                const std::int64_t cy = cell_coord(pos_i(1), inv_cell_m);
+                const std::int64_t cz = cell_coord(pos_i(2), inv_cell_m);
+
+                for (std::int64_t dx = -1; dx <= 1; dx++)
+                {
+                    for (std::int64_t dy = -1; dy <= 1; dy++)
+                    {
+                        for (std::int64_t dz = -1; dz <= 1; dz++)
+                        {
+                            const std::uint64_t key = cell_key(cx + dx, cy + dy, cz + dz);
+                            auto it = std::lower_bound(cells.begin(), cells.end(), key, key_less);
+
+                            for (; (it != cells.end()) && (it->first == key); ++it)
+                            {
+                                screen_pair(ii, it->second, lo_s, hi_s, half_s, accel_pad_m,
+                                    found);
+                            }
+                        }
+                    }
+                }
+            }
+        };
+
+        Internal::parallel_chunks(num, num_workers, screen_range);
+    }
+
+    std::vector<Conjunction> found;
+
+    for (const std::vector<Conjunction>& worker_found : found_by_worker)
+    {
+        found.insert(found.end(), worker_found.begin(), worker_found.end());
+    }
+
+    std::sort(found.begin(), found.end(), [](const Conjunction& lhs, const Conjunction& rhs)
+    {
+        return (lhs.tca_s < rhs.tca_s) ||
+            (!(rhs.tca_s < lhs.tca_s) && (std::pair(lhs.primary, lhs.secondary) <
+            std::pair(rhs.primary, rhs.secondary)));
+    });
+
+    return found;
+}
+
+}  // namespace MathUtils
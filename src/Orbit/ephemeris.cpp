@@ -0,0 +1,220 @@
+/**
+ * @file ephemeris.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Orbit/ephemeris.h"
+
+#include "constants.h"
+#include "conversions.h"
+#include "Internal/error_msg_helpers.h"
+#include "Time/LeapSecondTable.h"
+#include "Time/time_scales.h"
+#include "wrap_2pi.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace MathUtils {
+
+namespace {
+
+using Conversions::deg2rad;
+
+/**
+ * @brief Arcseconds to radians.
+ */
+constexpr double ARCSEC_TO_RAD = Constants::PI / (180.0 * 3'600.0);
+
+/**
+ * @brief Rotate a mean-of-date position into ECEF.
+ *
+ * @param pos_eci_m Position in the mean equator and equinox of date [m].
+ * @param gmst_rad Greenwich mean sidereal time [rad].
+ * @return Position in ECEF [m].
+ */
+Vector<3> rotate_to_ecef(const Vector<3>& pos_eci_m, const double gmst_rad) noexcept
+{
+    const double cos_g = std::cos(gmst_rad);
+    const double sin_g = std::sin(gmst_rad);
+
+    return Vector<3>{
+        (cos_g * pos_eci_m(0)) + (sin_g * pos_eci_m(1)),
+        (cos_g * pos_eci_m(1)) - (sin_g * pos_eci_m(0)),
+        pos_eci_m(2)
+    };
+}
+
+/**
+ * @brief Evaluate one body's series.
+ *
+ * @param body Body to evaluate.
+ * @param tt Epoch in TT.
+ * @return Position in the mean equator and equinox of date [m].
+ */
+Vector<3> body_position_eci(const EphemerisBody body, const Epoch& tt) noexcept
+{
+    return (body == EphemerisBody::Sun) ? sun_position_eci(tt) : moon_position_eci(tt);
+}
+
+}  // namespace
+
+double greenwich_mean_sidereal_time(const Epoch& ut1) noexcept
+{
+    // whole days drop out of the earth rotation angle, so only the small terms see them
+    const double du = (ut1.day() - J2000_JD) + ut1.fraction();
+    const double era_turns = ut1.fraction() + 0.779'057'273'264 + (0.002'737'811'911'354'48 * du);
+
+    const double t = ut1.julian_centuries_j2000();
+    const double precession_arcsec = 0.014'506 + (t * (4'612.156'534 + (t * (1.391'581'7 +
+        (t * (-0.000'000'44 + (t * -0.000'029'956)))))));
+
+    return wrap_2pi((Constants::TWO_PI * (era_turns - std::floor(era_turns))) +
+        (precession_arcsec * ARCSEC_TO_RAD));
+}
+
+Vector<3> sun_position_eci(const Epoch& tt) noexcept
+{
+    const double t = tt.julian_centuries_j2000();
+
+    const double mean_lon_deg = 280.460 + (36'000.771 * t);
+    const double mean_anom = deg2rad(357.529'109'2 + (35'999.050'34 * t));
+
+    const double ecl_lon = deg2rad(mean_lon_deg + (1.914'666'471 * std::sin(mean_anom)) +
+        (0.019'994'643 * std::sin(2.0 * mean_anom)));
+    const double range_au = 1.000'140'612 - (0.016'708'617 * std::cos(mean_anom)) -
+        (0.000'139'589 * std::cos(2.0 * mean_anom));
+    const double obliquity = deg2rad(23.439'291 - (0.013'004'2 * t));
+
+    const double range_m = range_au * Constants::ASTRONOMICAL_UNIT_M;
+    const double sin_lon = std::sin(ecl_lon);
+
+    return Vector<3>{
+        range_m * std::cos(ecl_lon),
+        range_m * std::cos(obliquity) * sin_lon,
+        range_m * std::sin(obliquity) * sin_lon
+    };
+}
+
+Vector<3> moon_position_eci(const Epoch& tt) noexcept
+{
+    const double t = tt.julian_centuries_j2000();
+
+    const double ecl_lon = deg2rad(218.32 + (481'267.881'3 * t) +
+        (6.29 * std::sin(deg2rad(134.9 + (477'198.85 * t)))) -
+        (1.27 * std::sin(deg2rad(259.2 - (413'335.38 * t)))) +
+        (0.66 * std::sin(deg2rad(235.7 + (890'534.23 * t)))) +
+        (0.21 * std::sin(deg2rad(269.9 + (954'397.70 * t)))) -
+        (0.19 * std::sin(deg2rad(357.5 + (35'999.05 * t)))) -
+        (0.11 * std::sin(deg2rad(186.6 + (966'404.05 * t)))));
+
+    const double ecl_lat = deg2rad((5.13 * std::sin(deg2rad(93.3 + (483'202.03 * t)))) +
+        (0.28 * std::sin(deg2rad(228.2 + (960'400.87 * t)))) -
+        (0.28 * std::sin(deg2rad(318.3 + (6'003.18 * t)))) -
+        (0.17 * std::sin(deg2rad(217.6 - (407'332.20 * t)))));
+
+    const double parallax = deg2rad(0.950'8 +
+        (0.051'8 * std::cos(deg2rad(134.9 + (477'198.85 * t)))) +
+        (0.009'5 * std::cos(deg2rad(259.2 - (413'335.38 * t)))) +
+        (0.007'8 * std::cos(deg2rad(235.7 + (890'534.23 * t)))) +
+        (0.002'8 * std::cos(deg2rad(269.9 + (954'397.70 * t)))));
+
+    const double obliquity = deg2rad(23.439'291 - (0.013'004'2 * t));
+    const double range_m = Constants::WGS84_A_M / std::sin(parallax);
+
+    const double cos_lat = std::cos(ecl_lat);
+    const double sin_lat = std::sin(ecl_lat);
+    const double cos_lon = std::cos(ecl_lon);
+    const double sin_lon = std::sin(ecl_lon);
+    const double cos_obl = std::cos(obliquity);
+    const double sin_obl = std::sin(obliquity);
+
+    return Vector<3>{
+        range_m * cos_lat * cos_lon,
+        range_m * ((cos_obl * cos_lat * sin_lon) - (sin_obl * sin_lat)),
+        range_m * ((sin_obl * cos_lat * sin_lon) + (cos_obl * sin_lat))
+    };
+}
+
+Vector<3> sun_position_ecef(const Epoch& utc)
+{
+    const Epoch tt = convert_time(utc, TimeScale::UTC, TimeScale::TT);
+    return rotate_to_ecef(sun_position_eci(tt), greenwich_mean_sidereal_time(utc));
+}
+
+Vector<3> moon_position_ecef(const Epoch& utc)
+{
+    const Epoch tt = convert_time(utc, TimeScale::UTC, TimeScale::TT);
+    return rotate_to_ecef(moon_position_eci(tt), greenwich_mean_sidereal_time(utc));
+}
+
+void ephemeris_eci(const EphemerisBody body,
+    std::span<const Epoch> tt,
+    std::span<Vector<3>> pos_eci_m)
+{
+    if (tt.size() != pos_eci_m.size())
+    {
+        throw std::length_error(Internal::mismatched_length_error_msg(tt.size(), pos_eci_m.size()));
+    }
+
+    for (std::size_t idx = 0; idx < tt.size(); idx++)
+    {
+        pos_eci_m[idx] = body_position_eci(body, tt[idx]);
+    }
+}
+
+void ephemeris_ecef(const EphemerisBody body,
+    std::span<const Epoch> utc,
+    std::span<Vector<3>> pos_ecef_m)
+{
+    if (utc.size() != pos_ecef_m.size())
+    {
+        throw std::length_error(Internal::mismatched_length_error_msg(utc.size(), pos_ecef_m.size()));
+    }
+
+    LeapSecondCursor cursor;
+
+    for (std::size_t idx = 0; idx < utc.size(); idx++)
+    {
+        const Epoch tt = convert_time(utc[idx], TimeScale::UTC, TimeScale::TT, cursor);
+        pos_ecef_m[idx] = rotate_to_ecef(body_position_eci(body, tt),
+            greenwich_mean_sidereal_time(utc[idx]));
+    }
+}
+
+template<typename F>
+const Vector<3>& EphemerisCache::lookup(Entry& entry, const Epoch& epoch, F evaluate)
+{
+    if (!entry.valid || !(std::abs(epoch.seconds_since(entry.epoch)) <= m_tolerance_s))
+    {
+        entry.epoch = epoch;
+        entry.position_m = evaluate(epoch);
+        entry.valid = true;
+        m_num_evaluations++;
+    }
+
+    return entry.position_m;
+}
+
+const Vector<3>& EphemerisCache::sun_eci(const Epoch& tt)
+{
+    return lookup(m_sun_eci, tt, [](const Epoch& ep){return sun_position_eci(ep);});
+}
+
+const Vector<3>& EphemerisCache::moon_eci(const Epoch& tt)
+{
+    return lookup(m_moon_eci, tt, [](const Epoch& ep){return moon_position_eci(ep);});
+}
+
+const Vector<3>& EphemerisCache::sun_ecef(const Epoch& utc)
+{
+    return lookup(m_sun_ecef, utc, [](const Epoch& ep){return sun_position_ecef(ep);});
+}
+
+const Vector<3>& EphemerisCache::moon_ecef(const Epoch& utc)
+{
+    return lookup(m_moon_ecef, utc, [](const Epoch& ep){return moon_position_ecef(ep);});
+}
+
+}  // namespace MathUtils
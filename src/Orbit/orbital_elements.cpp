@@ -0,0 +1,180 @@
+/**
+ * @file orbital_elements.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Orbit/orbital_elements.h"
+
+#include "acos_safe.h"
+#include "Internal/error_msg_helpers.h"
+#include "wrap_2pi.h"
+#include "wrap_pi.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace MathUtils {
+
+namespace {
+
+/**
+ * @brief Eccentricity below which an orbit is treated as circular.
+ */
+constexpr double CIRCULAR_ECCENTRICITY = 1e-11;
+
+/**
+ * @brief Fixed-iteration Halley solve of Kepler's equation.
+ *
+ * @param mean_anomaly_rad Mean anomaly [rad].
+ * @param eccentricity Eccentricity.
+ * @return Eccentric anomaly [rad].
+ */
+inline double kepler_halley(const double mean_anomaly_rad, const double eccentricity) noexcept
+{
+    const double mean_anom = wrap_pi(mean_anomaly_rad);
+
+    // Danby starter, E0 = M + 0.85 e sign(M)
+    double ecc_anom = mean_anom + std::copysign(0.85 * eccentricity, mean_anom);
+
+    for (std::size_t iter = 0; iter < KEPLER_ITERATIONS; iter++)
+    {
+        const double e_sin = eccentricity * std::sin(ecc_anom);
+        const double e_cos = eccentricity * std::cos(ecc_anom);
+
+        const double f = ecc_anom - e_sin - mean_anom;
+        const double df = 1.0 - e_cos;
+
+        ecc_anom -= f / (df - (0.5 * f * e_sin / df));
+    }
+
+    return ecc_anom;
+}
+
+}  // namespace
+
+double solve_kepler(const double mean_anomaly_rad, const double eccentricity) noexcept
+{
+    return kepler_halley(mean_anomaly_rad, eccentricity);
+}
+
+void solve_kepler(std::span<const double> mean_anomaly_rad,
+    std::span<const double> eccentricity,
+    std::span<double> eccentric_anomaly_rad)
+{
+    const std::size_t num = mean_anomaly_rad.size();
+
+    for (const std::size_t len : {eccentricity.size(), eccentric_anomaly_rad.size()})
+    {
+        if (len != num)
+        {
+            throw std::length_error(Internal::mismatched_length_error_msg(num, len));
+        }
+    }
+
+    const double* const mean_anom = mean_anomaly_rad.data();
+    const double* const ecc = eccentricity.data();
+    double* const ecc_anom = eccentric_anomaly_rad.data();
+
+    for (std::size_t idx = 0; idx < num; idx++)
+    {
+        ecc_anom[idx] = kepler_halley(mean_anom[idx], ecc[idx]);
+    }
+}
+
+OrbitState elements_to_state(const OrbitalElements& elements, const double gm_m3ps2)
+{
+    const double a = elements.semi_major_axis_m;
+    const double e = elements.eccentricity;
+
+    const double ecc_anom = kepler_halley(elements.mean_anomaly_rad, e);
+    const double sin_ea = std::sin(ecc_anom);
+    const double cos_ea = std::cos(ecc_anom);
+
+    const double sqrt_1me2 = std::sqrt(1.0 - (e * e));
+    const double mean_motion = std::sqrt(gm_m3ps2 / (a * a * a));
+    const double vel_scale = a * mean_motion / (1.0 - (e * cos_ea));
+
+    // perifocal position and velocity
+    const double xp = a * (cos_ea - e);
+    const double yp = a * sqrt_1me2 * sin_ea;
+    const double vxp = -vel_scale * sin_ea;
+    const double vyp = vel_scale * sqrt_1me2 * cos_ea;
+
+    const double sin_raan = std::sin(elements.raan_rad);
+    const double cos_raan = std::cos(elements.raan_rad);
+    const double sin_argp = std::sin(elements.arg_perigee_rad);
+    const double cos_argp = std::cos(elements.arg_perigee_rad);
+    const double sin_inc = std::sin(elements.inclination_rad);
+    const double cos_inc = std::cos(elements.inclination_rad);
+
+    // perifocal P (toward perigee) and Q axes in the inertial frame
+    const Vector<3> p_hat {
+        (cos_raan * cos_argp) - (sin_raan * sin_argp * cos_inc),
+        (sin_raan * cos_argp) + (cos_raan * sin_argp * cos_inc),
+        sin_argp * sin_inc
+    };
+    const Vector<3> q_hat {
+        -(cos_raan * sin_argp) - (sin_raan * cos_argp * cos_inc),
+        -(sin_raan * sin_argp) + (cos_raan * cos_argp * cos_inc),
+        cos_argp * sin_inc
+    };
+
+    return OrbitState {(xp * p_hat) + (yp * q_hat), (vxp * p_hat) + (vyp * q_hat)};
+}
+
+OrbitalElements state_to_elements(const OrbitState& state, const double gm_m3ps2)
+{
+    const Vector<3>& pos = state.position_m;
+    const Vector<3>& vel = state.velocity_mps;
+
+    const double r = pos.magnitude();
+    const Vector<3> h_vec = cross(pos, vel);
+    const double h = h_vec.magnitude();
+    const double energy = (0.5 * dot(vel, vel)) - (gm_m3ps2 / r);
+
+    if (!(energy < 0.0) || !(h > 0.0))
+    {
+        throw std::invalid_argument("Orbit state is not a bound, elliptical orbit.");
+    }
+
+    OrbitalElements elements {};
+    elements.semi_major_axis_m = -gm_m3ps2 / (2.0 * energy);
+
+    // eccentricity vector components along and across the position
+    const double e_cos_nu = (h * h / (gm_m3ps2 * r)) - 1.0;
+    const double e_sin_nu = h * dot(pos, vel) / (gm_m3ps2 * r);
+    const double e = std::hypot(e_cos_nu, e_sin_nu);
+
+    elements.eccentricity = e;
+    elements.inclination_rad = acos_safe(h_vec(2) / h);
+
+    // ascending node, k x h
+    const double node_x = -h_vec(1);
+    const double node_y = h_vec(0);
+    const bool equatorial = std::hypot(node_x, node_y) < (1e-12 * h);
+    const double raan = equatorial ? 0.0 : std::atan2(node_y, node_x);
+
+    const double sin_raan = std::sin(raan);
+    const double cos_raan = std::cos(raan);
+
+    // argument of latitude, measured from the node in the orbit plane
+    const double node_dot_r = (cos_raan * pos(0)) + (sin_raan * pos(1));
+    const double node_cross_r_dot_h = ((sin_raan * pos(2) * h_vec(0)) -
+        (cos_raan * pos(2) * h_vec(1)) + (((cos_raan * pos(1)) - (sin_raan * pos(0))) * h_vec(2))) / h;
+    const double arg_lat = std::atan2(node_cross_r_dot_h, node_dot_r);
+
+    const bool circular = e < CIRCULAR_ECCENTRICITY;
+    const double true_anom = circular ? arg_lat : std::atan2(e_sin_nu, e_cos_nu);
+
+    const double ecc_anom = std::atan2(std::sqrt(1.0 - (e * e)) * std::sin(true_anom),
+        e + std::cos(true_anom));
+
+    elements.raan_rad = wrap_2pi(raan);
+    elements.arg_perigee_rad = circular ? 0.0 : wrap_2pi(arg_lat - true_anom);
+    elements.mean_anomaly_rad = wrap_2pi(ecc_anom - (e * std::sin(ecc_anom)));
+
+    return elements;
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,184 @@
+/**
+ * @file propagate.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Orbit/propagate.h"
+
+#include "Internal/error_msg_helpers.h"
+#include "Internal/parallel_chunks.h"
+#include "wrap_2pi.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace MathUtils {
+
+namespace {
+
+/**
+ * @brief Fewest satellites per worker thread when the thread count is picked automatically.
+ */
+constexpr std::size_t SATELLITES_PER_WORKER = 1024;
+
+/**
+ * @brief Newton iteration limit for the universal anomaly.
+ */
+constexpr std::size_t UNIVERSAL_MAX_ITERATIONS = 50;
+
+/**
+ * @brief Stumpff functions S(z) and C(z).
+ *
+ * @details Near zero the closed forms cancel, so a truncated series is used instead.
+ *
+ * @param z Argument, alpha * chi^2.
+ * @param stumpff_s Output S(z).
+ * @param stumpff_c Output C(z).
+ */
+void stumpff(const double z, double& stumpff_s, double& stumpff_c) noexcept
+{
+    if (z > 1e-2)
+    {
+        const double sz = std::sqrt(z);
+        stumpff_s = (sz - std::sin(sz)) / (sz * sz * sz);
+        stumpff_c = (1.0 - std::cos(sz)) / z;
+    }
+    else if (z < -1e-2)
+    {
+        const double sz = std::sqrt(-z);
+        stumpff_s = (std::sinh(sz) - sz) / (sz * sz * sz);
+        stumpff_c = (std::cosh(sz) - 1.0) / (-z);
+    }
+    else
+    {
+        stumpff_s = (1.0 / 6.0) - (z * ((1.0 / 120.0) - (z * ((1.0 / 5040.0) -
+            (z * ((1.0 / 362880.0) - (z / 39916800.0)))))));
+        stumpff_c = 0.5 - (z * ((1.0 / 24.0) - (z * ((1.0 / 720.0) -
+            (z * ((1.0 / 40320.0) - (z / 3628800.0)))))));
+    }
+}
+
+}  // namespace
+
+OrbitState propagate_kepler(const OrbitState& state, const double dt_s, const double gm_m3ps2)
+{
+    const Vector<3>& r0_vec = state.position_m;
+    const Vector<3>& v0_vec = state.velocity_mps;
+
+    const double sqrt_gm = std::sqrt(gm_m3ps2);
+    const double r0 = r0_vec.magnitude();
+    const double vr0 = dot(r0_vec, v0_vec) / r0;
+
+    // reciprocal of the semi-major axis, negative for hyperbolic orbits
+    const double alpha = (2.0 / r0) - (dot(v0_vec, v0_vec) / gm_m3ps2);
+
+    const double rvr_term = r0 * vr0 / sqrt_gm;
+    const double one_m_alpha_r0 = 1.0 - (alpha * r0);
+
+    double chi = sqrt_gm * std::abs(alpha) * dt_s;
+    double stumpff_s = 0.0;
+    double stumpff_c = 0.0;
+
+    for (std::size_t iter = 0; iter < UNIVERSAL_MAX_ITERATIONS; iter++)
+    {
+        const double chi2 = chi * chi;
+        stumpff(alpha * chi2, stumpff_s, stumpff_c);
+
+        const double f = (rvr_term * chi2 * stumpff_c) + (one_m_alpha_r0 * chi2 * chi * stumpff_s) +
+            (r0 * chi) - (sqrt_gm * dt_s);
+        const double df = (rvr_term * chi * (1.0 - (alpha * chi2 * stumpff_s))) +
+            (one_m_alpha_r0 * chi2 * stumpff_c) + r0;
+
+        const double step = f / df;
+        chi -= step;
+
+        if (std::abs(step) <= (1e-13 * std::abs(chi)))
+        {
+            break;
+        }
+    }
+
+    const double chi2 = chi * chi;
+    stumpff(alpha * chi2, stumpff_s, stumpff_c);
+
+    // Lagrange coefficients
+    const double f = 1.0 - (chi2 / r0 * stumpff_c);
+    const double g = dt_s - (chi2 * chi / sqrt_gm * stumpff_s);
+
+    OrbitState out {};
+    out.position_m = (f * r0_vec) + (g * v0_vec);
+
+    const double r = out.position_m.magnitude();
+    const double fdot = sqrt_gm / (r * r0) * ((alpha * chi2 * chi * stumpff_s) - chi);
+    const double gdot = 1.0 - (chi2 / r * stumpff_c);
+
+    out.velocity_mps = (fdot * r0_vec) + (gdot * v0_vec);
+
+    return out;
+}
+
+OrbitalElements propagate_elements(const OrbitalElements& elements,
+    const double dt_s,
+    const OrbitModel model,
+    const double gm_m3ps2)
+{
+    const double a = elements.semi_major_axis_m;
+    const double e = elements.eccentricity;
+    const double mean_motion = std::sqrt(gm_m3ps2 / (a * a * a));
+
+    double raan_rate = 0.0;
+    double argp_rate = 0.0;
+    double mean_anom_rate = mean_motion;
+
+    if (model == OrbitModel::J2Secular)
+    {
+        const double p = a * (1.0 - (e * e));
+        const double re_p = Constants::WGS84_A_M / p;
+        const double sin_inc = std::sin(elements.inclination_rad);
+        const double sin2_inc = sin_inc * sin_inc;
+        const double k = 1.5 * Constants::WGS84_J2 * re_p * re_p * mean_motion;
+
+        raan_rate = -k * std::cos(elements.inclination_rad);
+        argp_rate = k * (2.0 - (2.5 * sin2_inc));
+        mean_anom_rate += k * std::sqrt(1.0 - (e * e)) * (1.0 - (1.5 * sin2_inc));
+    }
+
+    OrbitalElements out = elements;
+    out.raan_rad = wrap_2pi(elements.raan_rad + (raan_rate * dt_s));
+    out.arg_perigee_rad = wrap_2pi(elements.arg_perigee_rad + (argp_rate * dt_s));
+    out.mean_anomaly_rad = wrap_2pi(elements.mean_anomaly_rad + (mean_anom_rate * dt_s));
+
+    return out;
+}
+
+void propagate_constellation(std::span<const OrbitalElements> elements,
+    const double dt_s,
+    std::span<OrbitState> states,
+    const OrbitModel model,
+    const double gm_m3ps2,
+    const std::size_t num_threads)
+{
+    if (elements.size() != states.size())
+    {
+        throw std::length_error(Internal::mismatched_length_error_msg(elements.size(), states.size()));
+    }
+
+    const OrbitalElements* const el = elements.data();
+    OrbitState* const out = states.data();
+
+    const auto propagate_range = [=](const std::size_t, const std::size_t first,
+        const std::size_t last) {
+        for (std::size_t idx = first; idx < last; idx++)
+        {
+            out[idx] = elements_to_state(propagate_elements(el[idx], dt_s, model, gm_m3ps2),
+                gm_m3ps2);
+        }
+    };
+
+    Internal::parallel_chunks(states.size(),
+        Internal::worker_count(num_threads, states.size(), SATELLITES_PER_WORKER),
+        propagate_range);
+}
+
+}  // namespace MathUtils
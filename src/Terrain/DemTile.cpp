@@ -0,0 +1,367 @@
+/**
+ * @file DemTile.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Terrain/DemTile.h"
+
+#include "conversions.h"
+#include "Internal/error_msg_helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace MathUtils {
+
+namespace {
+
+constexpr std::int16_t HGT_VOID = -32768;  ///< SRTM void marker.
+
+/**
+ * @brief Read-only memory map of a whole file, unmapped on destruction.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+
+        if (fd < 0)
+        {
+            throw std::runtime_error(std::string("Cannot open ") + path.string() + ".");
+        }
+
+        struct stat info {};
+
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error(std::string("Cannot stat ") + path.string() + ".");
+        }
+
+        // mmap rejects a zero length, so name the real problem here
+        if (info.st_size <= 0)
+        {
+            ::close(fd);
+            throw std::runtime_error(path.string() + " is empty, not an SRTM tile.");
+        }
+
+        m_size = static_cast<std::size_t>(info.st_size);
+        void* const addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        // the mapping keeps its own reference to the file
+        ::close(fd);
+
+        if (addr == MAP_FAILED)
+        {
+            throw std::runtime_error(std::string("Cannot map ") + path.string() + ".");
+        }
+
+        m_addr = addr;
+    }
+
+    ~MappedFile()
+    {
+        ::munmap(m_addr, m_size);
+    }
+
+    MappedFile(const MappedFile& other) = delete;
+
+    MappedFile& operator=(const MappedFile& other) = delete;
+
+    [[nodiscard]] const unsigned char* bytes() const noexcept
+    {
+        return static_cast<const unsigned char*>(m_addr);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+private:
+    void* m_addr = nullptr;  ///< Start of the mapping.
+    std::size_t m_size = 0;  ///< Mapped length [bytes].
+};
+
+}  // namespace
+
+DemTileKey dem_tile_key(const GeoCoord& pos) noexcept
+{
+    const double lat_deg = Conversions::rad2deg(pos.latitude());
+    double lon_deg = std::fmod(Conversions::rad2deg(pos.longitude()) + 180.0, 360.0);
+
+    if (lon_deg < 0.0)
+    {
+        lon_deg += 360.0;
+    }
+
+    int south = static_cast<int>(std::floor(lat_deg));
+    south = (south < -90) ? -90 : ((south > 89) ? 89 : south);
+
+    int west = static_cast<int>(std::floor(lon_deg)) - 180;
+    west = (west > 179) ? 179 : west;
+
+    return DemTileKey {south, west};
+}
+
+std::string hgt_file_name(const DemTileKey& key)
+{
+    char name[32] {};
+    std::snprintf(name, sizeof(name), "%c%02d%c%03d.hgt",
+        (key.south_deg < 0) ? 'S' : 'N', std::abs(key.south_deg),
+        (key.west_deg < 0) ? 'W' : 'E', std::abs(key.west_deg));
+
+    return std::string(name);
+}
+
+DemTile::DemTile(const DemTileKey& key, const std::size_t samples, std::vector<float> heights_m)
+    :m_key{key},
+    m_samples{samples},
+    m_heights{std::move(heights_m)}
+{
+    if (samples < 2)
+    {
+        throw std::invalid_argument("DEM tile needs at least two samples per side.");
+    }
+
+    if (m_heights.size() != samples * samples)
+    {
+        throw std::length_error(
+            Internal::invalid_grid_size_error_msg(m_heights.size(), samples, samples)
+        );
+    }
+
+    build_pyramid();
+}
+
+DemTile DemTile::load_hgt(const std::filesystem::path& path, const DemTileKey& key)
+{
+    const MappedFile file(path);
+
+    const std::size_t num_samples = file.size() / 2;
+    const auto samples = static_cast<std::size_t>(std::llround(std::sqrt(
+        static_cast<double>(num_samples)
+    )));
+
+    if ((file.size() % 2 != 0) || (samples * samples != num_samples))
+    {
+        throw std::runtime_error(path.string() + " is not a square grid of int16 heights.");
+    }
+
+    std::vector<float> heights(num_samples);
+    const unsigned char* const bytes = file.bytes();
+
+    for (std::size_t idx = 0; idx < num_samples; idx++)
+    {
+        const auto raw = static_cast<std::int16_t>(
+            static_cast<std::uint16_t>((bytes[2 * idx] << 8) | bytes[(2 * idx) + 1])
+        );
+
+        heights[idx] = (raw == HGT_VOID) ?
+            std::numeric_limits<float>::quiet_NaN() : static_cast<float>(raw);
+    }
+
+    return DemTile(key, samples, std::move(heights));
+}
+
+float DemTile::sample(const std::size_t row, const std::size_t col) const
+{
+    if ((row >= m_samples) || (col >= m_samples))
+    {
+        throw std::out_of_range(Internal::invalid_index_error_msg(row, col, m_samples, m_samples));
+    }
+
+    return m_heights[(row * m_samples) + col];
+}
+
+double DemTile::height(const double lat_rad, const double lon_rad) const noexcept
+{
+    // a default-constructed tile has no grid cells to interpolate
+    if (m_samples < 2)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    const double north_frac =
+        Conversions::rad2deg(lat_rad) - static_cast<double>(m_key.south_deg);
+    double east_frac = Conversions::rad2deg(lon_rad) - static_cast<double>(m_key.west_deg);
+
+    // longitude may arrive on the other side of the antimeridian
+    if (east_frac < -180.0)
+    {
+        east_frac += 360.0;
+    }
+    else if (east_frac > 180.0)
+    {
+        east_frac -= 360.0;
+    }
+
+    if ((north_frac < 0.0) || (north_frac > 1.0) || (east_frac < 0.0) || (east_frac > 1.0))
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    const double scale = static_cast<double>(m_samples - 1);
+    const double y = (1.0 - north_frac) * scale;
+    const double x = east_frac * scale;
+
+    auto row = static_cast<std::size_t>(y);
+    auto col = static_cast<std::size_t>(x);
+    row = (row > m_samples - 2) ? (m_samples - 2) : row;
+    col = (col > m_samples - 2) ? (m_samples - 2) : col;
+
+    const double ty = y - static_cast<double>(row);
+    const double tx = x - static_cast<double>(col);
+
+    const float* const h_top = m_heights.data() + (row * m_samples) + col;
+    const float* const h_bot = h_top + m_samples;
+
+    const double top = (static_cast<double>(h_top[0]) * (1.0 - tx)) +
+        (static_cast<double>(h_top[1]) * tx);
+    const double bot = (static_cast<double>(h_bot[0]) * (1.0 - tx)) +
+        (static_cast<double>(h_bot[1]) * tx);
+
+    return (top * (1.0 - ty)) + (bot * ty);
+}
+
+std::size_t DemTile::num_blocks(const std::size_t level) const
+{
+    if (level >= m_block_min.size())
+    {
+        throw std::out_of_range(Internal::invalid_index_error_msg(level, m_block_min.size()));
+    }
+
+    const std::size_t cells = m_samples - 1;
+    const std::size_t size = block_cells(level);
+
+    return (cells + size - 1) / size;
+}
+
+float DemTile::block_min(const std::size_t level, const std::size_t row,
+    const std::size_t col) const
+{
+    const std::size_t blocks = num_blocks(level);
+
+    if ((row >= blocks) || (col >= blocks))
+    {
+        throw std::out_of_range(Internal::invalid_index_error_msg(row, col, blocks, blocks));
+    }
+
+    return m_block_min[level][(row * blocks) + col];
+}
+
+float DemTile::block_max(const std::size_t level, const std::size_t row,
+    const std::size_t col) const
+{
+    const std::size_t blocks = num_blocks(level);
+
+    if ((row >= blocks) || (col >= blocks))
+    {
+        throw std::out_of_range(Internal::invalid_index_error_msg(row, col, blocks, blocks));
+    }
+
+    return m_block_max[level][(row * blocks) + col];
+}
+
+void DemTile::build_pyramid()
+{
+    constexpr float neg_inf = -std::numeric_limits<float>::infinity();
+    const std::size_t cells = m_samples - 1;
+
+    m_block_min.clear();
+    m_block_max.clear();
+
+    // level 0 from the samples, including the shared edge samples of each block
+    std::size_t blocks = (cells + PYRAMID_BLOCK - 1) / PYRAMID_BLOCK;
+    std::vector<float> lo(blocks * blocks, neg_inf);
+    std::vector<float> hi(blocks * blocks, neg_inf);
+
+    for (std::size_t br = 0; br < blocks; br++)
+    {
+        const std::size_t r0 = br * PYRAMID_BLOCK;
+        const std::size_t r1 = std::min(r0 + PYRAMID_BLOCK, cells);
+
+        for (std::size_t bc = 0; bc < blocks; bc++)
+        {
+            const std::size_t c0 = bc * PYRAMID_BLOCK;
+            const std::size_t c1 = std::min(c0 + PYRAMID_BLOCK, cells);
+
+            float block_lo = std::numeric_limits<float>::infinity();
+            float block_hi = neg_inf;
+
+            for (std::size_t ii = r0; ii <= r1; ii++)
+            {
+                for (std::size_t jj = c0; jj <= c1; jj++)
+                {
+                    // fmin/fmax skip NaN voids
+                    const float h = m_heights[(ii * m_samples) + jj];
+                    block_lo = std::fmin(block_lo, h);
+                    block_hi = std::fmax(block_hi, h);
+                }
+            }
+
+            lo[(br * blocks) + bc] = std::isinf(block_hi) ? neg_inf : block_lo;
+            hi[(br * blocks) + bc] = block_hi;
+        }
+    }
+
+    m_block_min.push_back(std::move(lo));
+    m_block_max.push_back(std::move(hi));
+
+    // each level above reduces 2x2 blocks of the one below
+    while (blocks > 1)
+    {
+        const std::size_t below = blocks;
+        blocks = (blocks + 1) / 2;
+
+        const std::vector<float>& lo_below = m_block_min.back();
+        const std::vector<float>& hi_below = m_block_max.back();
+        std::vector<float> lo_level(blocks * blocks);
+        std::vector<float> hi_level(blocks * blocks);
+
+        for (std::size_t br = 0; br < blocks; br++)
+        {
+            for (std::size_t bc = 0; bc < blocks; bc++)
+            {
+                float block_lo = std::numeric_limits<float>::infinity();
+                float block_hi = neg_inf;
+
+                for (std::size_t ii = 2 * br; ii < std::min(2 * br + 2, below); ii++)
+                {
+                    for (std::size_t jj = 2 * bc; jj < std::min(2 * bc + 2, below); jj++)
+                    {
+                        const std::size_t idx = (ii * below) + jj;
+
+                        // all-void children are skipped
+                        if (!std::isinf(hi_below[idx]))
+                        {
+                            block_lo = std::min(block_lo, lo_below[idx]);
+                            block_hi = std::max(block_hi, hi_below[idx]);
+                        }
+                    }
+                }
+
+                lo_level[(br * blocks) + bc] = std::isinf(block_hi) ? neg_inf : block_lo;
+                hi_level[(br * blocks) + bc] = block_hi;
+            }
+        }
+
+        m_block_min.push_back(std::move(lo_level));
+        m_block_max.push_back(std::move(hi_level));
+    }
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,135 @@
+/**
+ * @file DemTileCache.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Terrain/DemTileCache.h"
+
+#include "Internal/error_msg_helpers.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace MathUtils {
+
+DemTileCache::DemTileCache(std::filesystem::path directory, const std::size_t max_tiles)
+    :m_directory{std::move(directory)},
+    m_max_tiles{max_tiles}
+{
+    if (max_tiles == 0)
+    {
+        throw std::invalid_argument("DEM tile cache needs room for at least one tile.");
+    }
+}
+
+std::shared_ptr<const DemTile> DemTileCache::tile(const DemTileKey& key) const
+{
+    const int index = key.index();
+
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        const auto found = m_index.find(index);
+
+        if (found != m_index.end())
+        {
+            m_lru.splice(m_lru.begin(), m_lru, found->second);
+            return found->second->second;
+        }
+    }
+
+    // decode without holding the lock so hits on other tiles are not blocked
+    std::shared_ptr<const DemTile> loaded;
+    const std::filesystem::path path = m_directory / hgt_file_name(key);
+
+    if (std::filesystem::exists(path))
+    {
+        loaded = std::make_shared<const DemTile>(DemTile::load_hgt(path, key));
+    }
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    const auto found = m_index.find(index);
+
+    // another reader loaded the same tile first
+    if (found != m_index.end())
+    {
+        m_lru.splice(m_lru.begin(), m_lru, found->second);
+        return found->second->second;
+    }
+
+    m_lru.emplace_front(index, loaded);
+    m_index.emplace(index, m_lru.begin());
+
+    if (m_lru.size() > m_max_tiles)
+    {
+        m_index.erase(m_lru.back().first);
+        m_lru.pop_back();
+    }
+
+    return loaded;
+}
+
+double DemTileCache::height(const GeoCoord& pos) const
+{
+    const std::shared_ptr<const DemTile> found = tile(dem_tile_key(pos));
+
+    if (found == nullptr)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    return found->height(pos.latitude(), pos.longitude());
+}
+
+void DemTileCache::heights(std::span<const GeoCoord> pos, std::span<double> heights_m) const
+{
+    if (pos.size() != heights_m.size())
+    {
+        throw std::length_error(Internal::mismatched_length_error_msg(pos.size(), heights_m.size()));
+    }
+
+    std::vector<int> keys(pos.size());
+    std::vector<std::size_t> order(pos.size());
+
+    for (std::size_t idx = 0; idx < pos.size(); idx++)
+    {
+        keys[idx] = dem_tile_key(pos[idx]).index();
+    }
+
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [&keys](const std::size_t a, const std::size_t b){
+        return keys[a] < keys[b];
+    });
+
+    std::size_t start = 0;
+
+    while (start < order.size())
+    {
+        const int index = keys[order[start]];
+        const std::shared_ptr<const DemTile> found = tile(dem_tile_key(pos[order[start]]));
+
+        std::size_t stop = start;
+
+        for (; (stop < order.size()) && (keys[order[stop]] == index); stop++)
+        {
+            const GeoCoord& p = pos[order[stop]];
+            heights_m[order[stop]] = (found == nullptr) ?
+                std::numeric_limits<double>::quiet_NaN() :
+                found->height(p.latitude(), p.longitude());
+        }
+
+        start = stop;
+    }
+}
+
+std::size_t DemTileCache::num_cached() const
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    return m_lru.size();
+}
+
+}  // namespace MathUtils
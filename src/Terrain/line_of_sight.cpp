@@ -0,0 +1,272 @@
+/**
+ * @file line_of_sight.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Terrain/line_of_sight.h"
+
+#include "conversions.h"
+#include "Geodesy/ecef_to_lla.h"
+#include "Geodesy/lla_to_ecef.h"
+#include "Internal/error_msg_helpers.h"
+#include "Internal/parallel_chunks.h"
+#include "LinAlg/Vector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+namespace MathUtils {
+
+namespace {
+
+/**
+ * @brief Shortest ground length of one degree of latitude, at the equator [m].
+ *
+ * @details Used as a lower bound for both axes so block-edge distances are never overestimated.
+ */
+constexpr double MIN_METERS_PER_DEG = 110'574.0;
+
+/**
+ * @brief Position inside a one-degree tile.
+ */
+struct TileFraction {
+    double north;  ///< Fraction from the southern edge, 0 to 1.
+    double east;  ///< Fraction from the western edge, 0 to 1.
+    double meters_per_deg_east;  ///< Lower bound of the east-west length of one degree [m].
+};
+
+/**
+ * @brief Locate a position inside its tile.
+ */
+TileFraction tile_fraction(const DemTileKey& key, const GeoCoord& pos)
+{
+    double east = Conversions::rad2deg(pos.longitude()) - static_cast<double>(key.west_deg);
+
+    if (east < -180.0)
+    {
+        east += 360.0;
+    }
+    else if (east > 180.0)
+    {
+        east -= 360.0;
+    }
+
+    const double north = Conversions::rad2deg(pos.latitude()) - static_cast<double>(key.south_deg);
+
+    // the tile's edge closest to a pole has the shortest degree of longitude
+    const double max_abs_lat = std::max(std::abs(key.south_deg), std::abs(key.south_deg + 1));
+
+    return TileFraction {
+        std::clamp(north, 0.0, 1.0),
+        std::clamp(east, 0.0, 1.0),
+        MIN_METERS_PER_DEG * std::cos(Conversions::deg2rad(max_abs_lat))
+    };
+}
+
+/**
+ * @brief Safe march step at a point.
+ */
+struct StepBound {
+    bool blocked;  ///< The point is below terrain.
+    double step_m;  ///< Distance the ray can advance without reaching terrain [m].
+};
+
+/**
+ * @brief Bound the next step where no tile exists, from a flat terrain height.
+ */
+StepBound missing_tile_step(const TileFraction& frac, const double alt_m,
+    const LineOfSightOptions& options)
+{
+    const double clearance = alt_m - options.missing_tile_height_m;
+
+    if (clearance < 0.0)
+    {
+        return StepBound {true, 0.0};
+    }
+
+    const double edge_north = std::min(frac.north, 1.0 - frac.north) * MIN_METERS_PER_DEG;
+    const double edge_east = std::min(frac.east, 1.0 - frac.east) * frac.meters_per_deg_east;
+
+    return StepBound {false, std::min({clearance, edge_north, edge_east})};
+}
+
+/**
+ * @brief Bound the next step over a tile using its min/max pyramid.
+ */
+StepBound tile_step(const DemTile& tile, const TileFraction& frac, const GeoCoord& pos,
+    const double alt_m, const LineOfSightOptions& options)
+{
+    const std::size_t cells = tile.samples() - 1;
+    const double cells_d = static_cast<double>(cells);
+
+    // grid position in cells, row 0 north
+    const double y = (1.0 - frac.north) * cells_d;
+    const double x = frac.east * cells_d;
+    const std::size_t row = std::min(static_cast<std::size_t>(y), cells - 1);
+    const std::size_t col = std::min(static_cast<std::size_t>(x), cells - 1);
+
+    const double cell_north_m = MIN_METERS_PER_DEG / cells_d;
+    const double cell_east_m = frac.meters_per_deg_east / cells_d;
+
+    double best = 0.0;
+
+    for (std::size_t level = tile.pyramid_levels(); level-- > 0;)
+    {
+        const std::size_t size = tile.block_cells(level);
+        const std::size_t br = row / size;
+        const std::size_t bc = col / size;
+        const double lo = static_cast<double>(tile.block_min(level, br, bc));
+
+        // the bilinear surface never dips below the block minimum
+        if (alt_m < lo)
+        {
+            return StepBound {true, 0.0};
+        }
+
+        const double clearance = alt_m - static_cast<double>(tile.block_max(level, br, bc));
+
+        if (clearance <= best)
+        {
+            continue;
+        }
+
+        const double r0 = static_cast<double>(br * size);
+        const double r1 = static_cast<double>(std::min((br + 1) * size, cells));
+        const double c0 = static_cast<double>(bc * size);
+        const double c1 = static_cast<double>(std::min((bc + 1) * size, cells));
+
+        const double edge_north = std::min(y - r0, r1 - y) * cell_north_m;
+        const double edge_east = std::min(x - c0, c1 - x) * cell_east_m;
+
+        best = std::max(best, std::min({clearance, edge_north, edge_east}));
+    }
+
+    if (best >= options.min_step_m)
+    {
+        return StepBound {false, best};
+    }
+
+    // close to terrain: check the surface itself, NaN voids never block
+    const double height = tile.height(pos.latitude(), pos.longitude());
+
+    return StepBound {alt_m < height, best};
+}
+
+/**
+ * @brief Check query options.
+ *
+ * @exception std::invalid_argument The minimum step is not positive.
+ */
+void check_options(const LineOfSightOptions& options)
+{
+    // a zero step would stall the march wherever the pyramid bound is also zero
+    if (!(options.min_step_m > 0.0))
+    {
+        throw std::invalid_argument("Line-of-sight minimum step must be positive.");
+    }
+}
+
+}  // namespace
+
+LineOfSightResult line_of_sight(const DemTileCache& terrain,
+    const GeoCoord& observer,
+    const GeoCoord& target,
+    const LineOfSightOptions& options)
+{
+    check_options(options);
+
+    const Vector<3> start = lla_to_ecef(observer);
+    const Vector<3> delta = lla_to_ecef(target) - start;
+    const double length = delta.magnitude();
+
+    LineOfSightResult result {true, std::numeric_limits<double>::quiet_NaN(), 0};
+
+    if (length < options.min_step_m)
+    {
+        return result;
+    }
+
+    const Vector<3> dir = (1.0 / length) * delta;
+
+    // reuse the tile while the march stays inside it
+    DemTileKey key {0, 0};
+    std::shared_ptr<const DemTile> tile;
+    bool have_key = false;
+
+    double range = 0.0;
+
+    while (range < length)
+    {
+        const GeoCoord pos = ecef_to_lla(start + (range * dir));
+        const DemTileKey pos_key = dem_tile_key(pos);
+
+        if (!have_key || !(pos_key == key))
+        {
+            key = pos_key;
+            tile = terrain.tile(key);
+            have_key = true;
+        }
+
+        const TileFraction frac = tile_fraction(key, pos);
+        const double alt_m = pos.altitude() - options.clearance_m;
+
+        const StepBound bound = (tile == nullptr) ?
+            missing_tile_step(frac, alt_m, options) : tile_step(*tile, frac, pos, alt_m, options);
+
+        result.steps++;
+
+        if (bound.blocked && (range > 0.0))
+        {
+            result.visible = false;
+            result.blocked_range_m = range;
+            return result;
+        }
+
+        range += std::max(bound.step_m, options.min_step_m);
+    }
+
+    return result;
+}
+
+void line_of_sight(const DemTileCache& terrain,
+    std::span<const GeoCoord> observers,
+    std::span<const GeoCoord> targets,
+    std::span<LineOfSightResult> results,
+    const LineOfSightOptions& options,
+    const std::size_t num_threads)
+{
+    if (observers.size() != targets.size())
+    {
+        throw std::length_error(
+            Internal::mismatched_length_error_msg(observers.size(), targets.size())
+        );
+    }
+
+    if (observers.size() != results.size())
+    {
+        throw std::length_error(
+            Internal::mismatched_length_error_msg(observers.size(), results.size())
+        );
+    }
+
+    check_options(options);
+
+    const auto check_range = [&](const std::size_t, const std::size_t first,
+        const std::size_t last) {
+        for (std::size_t idx = first; idx < last; idx++)
+        {
+            results[idx] = line_of_sight(terrain, observers[idx], targets[idx], options);
+        }
+    };
+
+    // contiguous chunks, one per worker, all reading the shared tile cache
+    Internal::parallel_chunks(observers.size(),
+        Internal::worker_count(num_threads, observers.size()), check_range);
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,61 @@
+/**
+ * @file Epoch.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Time/Epoch.h"
+
+#include <cmath>
+
+namespace MathUtils {
+
+Epoch::Epoch(const double day, const double fraction)
+{
+    // move any fractional day into the fraction, then any whole days out of it
+    const double day_whole = std::floor(day);
+    const double frac = fraction + (day - day_whole);
+    const double frac_whole = std::floor(frac);
+
+    m_day = day_whole + frac_whole;
+    m_fraction = frac - frac_whole;
+
+    // a tiny negative fraction rounds up to exactly 1 in the subtraction above
+    if (m_fraction >= 1.0)
+    {
+        m_day += 1.0;
+        m_fraction -= 1.0;
+    }
+}
+
+Epoch Epoch::from_calendar(const int year,
+    const int month,
+    const int day,
+    const int hour,
+    const int minute,
+    const double second)
+{
+    // Julian day number of the date, which starts at noon
+    const int a = (month - 14) / 12;
+    const int jdn = ((1461 * (year + 4800 + a)) / 4) + ((367 * (month - 2 - (12 * a))) / 12) -
+        ((3 * ((year + 4900 + a) / 100)) / 4) + day - 32075;
+
+    const double day_seconds = (3'600.0 * hour) + (60.0 * minute) + second;
+
+    return Epoch(static_cast<double>(jdn), (day_seconds / SECONDS_PER_DAY) - 0.5);
+}
+
+Epoch Epoch::from_mjd(const double mjd)
+{
+    const double mjd_whole = std::floor(mjd);
+    return Epoch(mjd_whole + (MJD_OFFSET_DAYS - 0.5), (mjd - mjd_whole) + 0.5);
+}
+
+std::ostream& operator<<(std::ostream& os, const Epoch& epoch)
+{
+    os << epoch.day() << ", " << epoch.fraction();
+
+    return os;
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,154 @@
+/**
+ * @file LeapSecondTable.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Time/LeapSecondTable.h"
+
+#include "Time/Epoch.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace MathUtils {
+
+namespace {
+
+/**
+ * @brief Index of the interval holding a date, by binary search.
+ *
+ * @param starts Sorted interval start dates [day].
+ * @param mjd Date to find [day].
+ * @return Index of the last start at or before `mjd`, zero if none.
+ */
+std::size_t find_interval(std::span<const double> starts, const double mjd) noexcept
+{
+    const auto it = std::upper_bound(starts.begin(), starts.end(), mjd);
+    const auto past = static_cast<std::size_t>(it - starts.begin());
+
+    return (past > 0) ? (past - 1) : 0;
+}
+
+/**
+ * @brief Index of the interval holding a date, trying the cached and next intervals first.
+ *
+ * @param starts Sorted interval start dates [day].
+ * @param mjd Date to find [day].
+ * @param idx Cached index, updated to the result.
+ */
+void advance_cursor(std::span<const double> starts, const double mjd, std::size_t& idx) noexcept
+{
+    const std::size_t num = starts.size();
+
+    const auto in_interval = [starts, num, mjd](const std::size_t ii)
+    {
+        return (mjd >= starts[ii]) && (((ii + 1) == num) || (mjd < starts[ii + 1]));
+    };
+
+    if (in_interval(idx))
+    {
+        return;
+    }
+
+    if (((idx + 1) < num) && in_interval(idx + 1))
+    {
+        idx++;
+        return;
+    }
+
+    idx = find_interval(starts, mjd);
+}
+
+}  // namespace
+
+LeapSecondTable::LeapSecondTable(std::vector<LeapSecond> entries)
+    :m_entries{std::move(entries)}
+{
+    if (m_entries.empty())
+    {
+        throw std::invalid_argument("Leap second table needs at least one entry.");
+    }
+
+    const auto date_less = [](const LeapSecond& lhs, const LeapSecond& rhs)
+    {
+        return lhs.mjd_utc < rhs.mjd_utc;
+    };
+
+    if (std::adjacent_find(m_entries.begin(), m_entries.end(),
+        [date_less](const LeapSecond& lhs, const LeapSecond& rhs){return !date_less(lhs, rhs);}) !=
+        m_entries.end())
+    {
+        throw std::invalid_argument("Leap second table entries must be sorted by date.");
+    }
+
+    m_mjd_utc.reserve(m_entries.size());
+    m_mjd_tai.reserve(m_entries.size());
+
+    for (const LeapSecond& entry : m_entries)
+    {
+        m_mjd_utc.push_back(entry.mjd_utc);
+        m_mjd_tai.push_back(entry.mjd_utc + (entry.tai_minus_utc_s / SECONDS_PER_DAY));
+    }
+}
+
+const LeapSecondTable& LeapSecondTable::builtin()
+{
+    static const LeapSecondTable table(std::vector<LeapSecond> {
+        {41'317.0, 10.0},  // 1972-01-01
+        {41'499.0, 11.0},  // 1972-07-01
+        {41'683.0, 12.0},  // 1973-01-01
+        {42'048.0, 13.0},  // 1974-01-01
+        {42'413.0, 14.0},  // 1975-01-01
+        {42'778.0, 15.0},  // 1976-01-01
+        {43'144.0, 16.0},  // 1977-01-01
+        {43'509.0, 17.0},  // 1978-01-01
+        {43'874.0, 18.0},  // 1979-01-01
+        {44'239.0, 19.0},  // 1980-01-01
+        {44'786.0, 20.0},  // 1981-07-01
+        {45'151.0, 21.0},  // 1982-07-01
+        {45'516.0, 22.0},  // 1983-07-01
+        {46'247.0, 23.0},  // 1985-07-01
+        {47'161.0, 24.0},  // 1988-01-01
+        {47'892.0, 25.0},  // 1990-01-01
+        {48'257.0, 26.0},  // 1991-01-01
+        {48'804.0, 27.0},  // 1992-07-01
+        {49'169.0, 28.0},  // 1993-07-01
+        {49'534.0, 29.0},  // 1994-07-01
+        {50'083.0, 30.0},  // 1996-01-01
+        {50'630.0, 31.0},  // 1997-07-01
+        {51'179.0, 32.0},  // 1999-01-01
+        {53'736.0, 33.0},  // 2006-01-01
+        {54'832.0, 34.0},  // 2009-01-01
+        {56'109.0, 35.0},  // 2012-07-01
+        {57'204.0, 36.0},  // 2015-07-01
+        {57'754.0, 37.0}  // 2017-01-01
+    });
+
+    return table;
+}
+
+std::size_t LeapSecondTable::find_utc(const double mjd_utc) const noexcept
+{
+    return find_interval(m_mjd_utc, mjd_utc);
+}
+
+std::size_t LeapSecondTable::find_tai(const double mjd_tai) const noexcept
+{
+    return find_interval(m_mjd_tai, mjd_tai);
+}
+
+double LeapSecondCursor::tai_minus_utc_at_utc(const double mjd_utc) noexcept
+{
+    advance_cursor(m_table->mjd_utc(), mjd_utc, m_idx);
+    return m_table->entries()[m_idx].tai_minus_utc_s;
+}
+
+double LeapSecondCursor::tai_minus_utc_at_tai(const double mjd_tai) noexcept
+{
+    advance_cursor(m_table->mjd_tai(), mjd_tai, m_idx);
+    return m_table->entries()[m_idx].tai_minus_utc_s;
+}
+
+}  // namespace MathUtils
@@ -0,0 +1,97 @@
+/**
+ * @file time_scales.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Time/time_scales.h"
+
+#include "Internal/error_msg_helpers.h"
+
+#include <stdexcept>
+
+namespace MathUtils {
+
+namespace {
+
+/**
+ * @brief Offset of TAI from a scale with a constant offset.
+ *
+ * @param scale TAI, GPS, or TT.
+ * @return TAI minus `scale` [s].
+ */
+double tai_minus_fixed(const TimeScale scale) noexcept
+{
+    switch (scale)
+    {
+        case TimeScale::GPS:
+            return TAI_MINUS_GPS_S;
+        case TimeScale::TT:
+            return -TT_MINUS_TAI_S;
+        default:
+            return 0.0;
+    }
+}
+
+}  // namespace
+
+Epoch convert_time(const Epoch& epoch,
+    const TimeScale from,
+    const TimeScale to,
+    LeapSecondCursor& cursor)
+{
+    if (from == to)
+    {
+        return epoch;
+    }
+
+    const Epoch tai = (from == TimeScale::UTC) ?
+        epoch.plus_seconds(cursor.tai_minus_utc_at_utc(epoch.mjd())) :
+        epoch.plus_seconds(tai_minus_fixed(from));
+
+    return (to == TimeScale::UTC) ?
+        tai.plus_seconds(-cursor.tai_minus_utc_at_tai(tai.mjd())) :
+        tai.plus_seconds(-tai_minus_fixed(to));
+}
+
+Epoch convert_time(const Epoch& epoch, const TimeScale from, const TimeScale to)
+{
+    LeapSecondCursor cursor;
+    return convert_time(epoch, from, to, cursor);
+}
+
+void convert_time(std::span<const Epoch> epochs,
+    std::span<Epoch> converted,
+    const TimeScale from,
+    const TimeScale to,
+    const LeapSecondTable& table)
+{
+    if (epochs.size() != converted.size())
+    {
+        throw std::length_error(
+            Internal::mismatched_length_error_msg(epochs.size(), converted.size())
+        );
+    }
+
+    // fixed offsets skip the table entirely
+    if ((from != TimeScale::UTC) && (to != TimeScale::UTC))
+    {
+        const double offset_s = tai_minus_fixed(from) - tai_minus_fixed(to);
+
+        for (std::size_t idx = 0; idx < epochs.size(); idx++)
+        {
+            converted[idx] = epochs[idx].plus_seconds(offset_s);
+        }
+
+        return;
+    }
+
+    LeapSecondCursor cursor(table);
+
+    for (std::size_t idx = 0; idx < epochs.size(); idx++)
+    {
+        converted[idx] = convert_time(epochs[idx], from, to, cursor);
+    }
+}
+
+}  // namespace MathUtils
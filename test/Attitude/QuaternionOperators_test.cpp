@@ -5,7 +5,7 @@
  */
 
 #include "Attitude/Quaternion.h"
-
+#include "TestTools/QuaternionNear.h"
 
 #include <cmath>
 #include <gtest/gtest.h>
@@ -30,6 +30,18 @@ TEST(QuaternionOperatorsTest, Multiply)
 }
 
 
+// =================================================================================================
+TEST(QuaternionOperatorsTest, MultiplyIntoAliasedOutput)
+{
+    const Quaternion q_a(1, 2, 3, 4);
+    Quaternion q_b(4, 3, 2, 1);
+
+    const Quaternion expected = q_a * q_b;
+    mul_into(q_a, q_b, q_b);
+
+    EXPECT_TRUE(TestTools::QuaternionNear(q_b, expected));
+}
+
 // =================================================================================================
 int main(int argc, char** argv)
 {
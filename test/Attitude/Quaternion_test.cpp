@@ -9,6 +9,7 @@
 #include "LinAlg/Vector.h"
 #include "TestTools/VectorNear.h"
 
+#include <array>
 #include <cmath>
 #include <gtest/gtest.h>
 #include <initializer_list>
@@ -235,6 +236,36 @@ TEST(QuaternionTest, PrintToStream)
     EXPECT_TRUE(ss.str().find("0.73") != std::string::npos);
 }
 
+// =================================================================================================
+TEST(QuaternionTest, NormalizeFastKeepsUnitMagnitude)
+{
+    Quaternion quat(0.961798, -0.14565, 0.202665, 0.112505);
+    const Quaternion expected(quat);
+
+    quat.normalize_fast();
+
+    for (std::size_t ii = 0; ii < 4; ii++)
+    {
+        EXPECT_NEAR(quat(ii), expected(ii), 5e-6);
+    }
+}
+
+// =================================================================================================
+TEST(QuaternionTest, BatchRenormalizeNearlyUnit)
+{
+    std::array<Quaternion, 2> quats {Quaternion(1, 2, 3, 4), Quaternion(4, 3, 2, 1)};
+    const std::array<Quaternion, 2> expected(quats);
+
+    MathUtils::normalize_fast(quats);
+    MathUtils::renormalize_nearly_unit(quats);
+
+    for (std::size_t ii = 0; ii < 4; ii++)
+    {
+        EXPECT_NEAR(quats.at(0)(ii), expected.at(0)(ii), 1e-10);
+        EXPECT_NEAR(quats.at(1)(ii), expected.at(1)(ii), 1e-10);
+    }
+}
+
 // =================================================================================================
 int main(int argc, char** argv)
 {
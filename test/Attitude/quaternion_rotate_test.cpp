@@ -6,13 +6,17 @@
 
 #include "Attitude/Quaternion.h"
 #include "Attitude/quaternion_rotate.h"
+#include "fixed_point.h"
 #include "LinAlg/Vector.h"
 #include "TestTools/VectorNear.h"
 
+#include <array>
 #include <cmath>
 #include <gtest/gtest.h>
 #include <string>
 
+using MathUtils::Q15;
+using MathUtils::Q31;
 using MathUtils::Quaternion;
 using MathUtils::TestTools::VectorNear;
 using MathUtils::Vector;
@@ -49,6 +53,60 @@ TEST(QuaternionRotateTest, QuaternionRotate2)
     EXPECT_TRUE(VectorNear(v_a, expected));
 }
 
+// =================================================================================================
+TEST(QuaternionRotateTest, FixedPointMatchesDouble)
+{
+    const Quaternion q_a_b({0.961798, -0.14565, 0.202665, 0.112505});
+    const Vector<3> v_b({0.5, -0.25, 0.75});
+    const Vector<3> expected = MathUtils::quaternion_rotate(q_a_b, v_b);
+
+    const std::array<Q31, 4> q31 {Q31(q_a_b(0)), Q31(q_a_b(1)), Q31(q_a_b(2)), Q31(q_a_b(3))};
+    const std::array<Q31, 3> v31 {Q31(v_b(0)), Q31(v_b(1)), Q31(v_b(2))};
+    const std::array<Q31, 3> res31 = MathUtils::quaternion_rotate(q31, v31);
+
+    const std::array<Q15, 4> q15 {Q15(q_a_b(0)), Q15(q_a_b(1)), Q15(q_a_b(2)), Q15(q_a_b(3))};
+    const std::array<Q15, 3> v15 {Q15(v_b(0)), Q15(v_b(1)), Q15(v_b(2))};
+    const std::array<Q15, 3> res15 = MathUtils::quaternion_rotate(q15, v15);
+
+    for (std::size_t ii = 0; ii < 3; ii++)
+    {
+        EXPECT_NEAR(res31.at(ii).to_double(), expected(ii), 1e-8);
+        EXPECT_NEAR(res15.at(ii).to_double(), expected(ii), 5e-4);
+    }
+}
+
+// =================================================================================================
+TEST(QuaternionRotateTest, FixedPointNearUnitVector)
+{
+    // components just under 1/sqrt(3), so |v| is just under one, rotated onto the x axis
+    const double angle = std::acos(1.0 / std::sqrt(3.0));
+    const double axis = std::sin(0.5 * angle) / std::sqrt(2.0);
+    const Quaternion q_a_b({std::cos(0.5 * angle), 0.0, -axis, axis});
+    const Vector<3> v_b({0.577, 0.577, 0.577});
+    const Vector<3> expected = MathUtils::quaternion_rotate(q_a_b, v_b);
+
+    ASSERT_GT(std::abs(expected(0)), 0.999);
+
+    const std::array<Q15, 4> q15 {Q15(q_a_b(0)), Q15(q_a_b(1)), Q15(q_a_b(2)), Q15(q_a_b(3))};
+    const std::array<Q15, 3> v15 {Q15(v_b(0)), Q15(v_b(1)), Q15(v_b(2))};
+    const std::array<Q15, 3> res15 = MathUtils::quaternion_rotate(q15, v15);
+
+    for (std::size_t ii = 0; ii < 3; ii++)
+    {
+        EXPECT_NEAR(res15.at(ii).to_double(), expected(ii), 5e-4);
+    }
+
+    // in-range components with |v| > 1 saturate partway through the sum
+    const double c45 = std::cos(0.5 * std::atan(1.0));
+    const double s45 = std::sin(0.5 * std::atan(1.0));
+    const std::array<Q15, 4> q_z {Q15(c45), Q15(0.0), Q15(0.0), Q15(s45)};
+    const std::array<Q15, 3> v_big {Q15(0.9), Q15(0.9), Q15(0.0)};
+    const std::array<Q15, 3> clipped = MathUtils::quaternion_rotate(q_z, v_big);
+
+    // the exact result is (0.9 * sqrt(2), 0, 0)
+    EXPECT_EQ(clipped.at(0), Q15::max());
+    EXPECT_NEAR(clipped.at(1).to_double(), 0.0, 1e-4);
+}
 
 // =================================================================================================
 int main(int argc, char** argv)
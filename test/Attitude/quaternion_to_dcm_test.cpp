@@ -7,12 +7,16 @@
 #include "Attitude/Quaternion.h"
 #include "LinAlg/Matrix.h"
 #include "Attitude/quaternion_to_dcm.h"
+#include "fixed_point.h"
 #include "TestTools/MatrixNear.h"
 
+#include <array>
 #include <gtest/gtest.h>
 #include <string>
 
 using MathUtils::Matrix;
+using MathUtils::Q15;
+using MathUtils::Q31;
 using MathUtils::Quaternion;
 using MathUtils::TestTools::MatrixNear;
 
@@ -31,6 +35,28 @@ TEST(QuaternionToDCMTest, UnityQuatIsIdentityMatrix)
 
 }
 
+// =================================================================================================
+TEST(QuaternionToDCMTest, FixedPointMatchesDouble)
+{
+    const Quaternion q({0.961798, -0.14565, 0.202665, 0.112505});
+    const Matrix<3,3> expected = MathUtils::quaternion_to_dcm(q);
+
+    const std::array<Q31, 4> q31 {Q31(q(0)), Q31(q(1)), Q31(q(2)), Q31(q(3))};
+    const auto dcm31 = MathUtils::quaternion_to_dcm(q31);
+
+    const std::array<Q15, 4> q15 {Q15(q(0)), Q15(q(1)), Q15(q(2)), Q15(q(3))};
+    const auto dcm15 = MathUtils::quaternion_to_dcm(q15);
+
+    for (std::size_t ii = 0; ii < 3; ii++)
+    {
+        for (std::size_t jj = 0; jj < 3; jj++)
+        {
+            EXPECT_NEAR(dcm31.at(ii).at(jj).to_double(), expected(ii, jj), 1e-8);
+            EXPECT_NEAR(dcm15.at(ii).at(jj).to_double(), expected(ii, jj), 5e-4);
+        }
+    }
+}
+
 // =================================================================================================
 int main(int argc, char** argv)
 {
@@ -0,0 +1,351 @@
+/**
+ * @file KalmanFilterBank_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Filtering/KalmanFilter.h"
+#include "Filtering/KalmanFilterBank.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/Vector.h"
+#include "TestTools/MatrixNear.h"
+#include "TestTools/VectorNear.h"
+
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MathUtils::KalmanCovarianceUpdate;
+using MathUtils::KalmanFilter;
+using MathUtils::KalmanFilterBank;
+using MathUtils::KalmanUpdateStatus;
+using MathUtils::Matrix;
+using MathUtils::TestTools::MatrixNear;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-Filtering-KalmanFilterBank.xml");
+
+/**
+ * @brief 2D constant-velocity tracks with position measurements. State is [x, y, vx, vy].
+ */
+class KalmanFilterBankTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+
+    static constexpr double dt = 0.5;
+
+    const Matrix<4,4> p0 {
+        {4.0, 0.5, 0.2, 0.0},
+        {0.5, 3.0, 0.0, 0.1},
+        {0.2, 0.0, 1.0, 0.3},
+        {0.0, 0.1, 0.3, 2.0}
+    };
+
+    const Matrix<4,4> f {
+        {1.0, 0.0, dt, 0.0},
+        {0.0, 1.0, 0.0, dt},
+        {0.0, 0.0, 1.0, 0.0},
+        {0.0, 0.0, 0.0, 1.0}
+    };
+
+    const Matrix<4,4> q {
+        {0.01, 0.0, 0.02, 0.0},
+        {0.0, 0.01, 0.0, 0.02},
+        {0.02, 0.0, 0.1, 0.0},
+        {0.0, 0.02, 0.0, 0.1}
+    };
+
+    const Matrix<2,4> h {
+        {1.0, 0.0, 0.0, 0.0},
+        {0.0, 1.0, 0.0, 0.0}
+    };
+
+    const Matrix<2,2> r {{0.5, 0.1}, {0.1, 0.25}};
+
+    static Vector<4> initial_state(const std::size_t idx)
+    {
+        const auto val = static_cast<double>(idx);
+        return Vector<4> {val, -val, 0.1 * val, 0.5};
+    }
+
+    static Vector<2> measurement(const std::size_t idx, const int step)
+    {
+        const auto val = static_cast<double>(idx);
+        const auto t = static_cast<double>(step);
+        return Vector<2> {val + (0.06 * val * t) + 0.3, -val + (0.2 * t) - 0.1};
+    }
+};
+
+// =================================================================================================
+TEST_F(KalmanFilterBankTest, MatchesSingleFilters)
+{
+    // 11 tracks span a full and a partial chunk
+    constexpr std::size_t num = 11;
+
+    for (const auto form : {KalmanCovarianceUpdate::Standard, KalmanCovarianceUpdate::Joseph})
+    {
+        KalmanFilterBank<4,2> bank(form);
+        std::vector<KalmanFilter<4,2>> singles;
+
+        for (std::size_t idx = 0; idx < num; idx++)
+        {
+            EXPECT_EQ(bank.add_track(initial_state(idx), p0), idx);
+            singles.emplace_back(initial_state(idx), p0, form);
+        }
+
+        EXPECT_EQ(bank.num_chunks(), 2);
+
+        std::vector<Vector<2>> z(num);
+        std::vector<KalmanUpdateStatus> status(num);
+
+        for (int step = 0; step < 5; step++)
+        {
+            bank.predict(f, q);
+
+            for (std::size_t idx = 0; idx < num; idx++)
+            {
+                singles[idx].predict(f, q);
+                z[idx] = measurement(idx, step);
+            }
+
+            bank.update(z, h, r, status);
+
+            for (std::size_t idx = 0; idx < num; idx++)
+            {
+                EXPECT_EQ(singles[idx].update(z[idx], h, r).status, KalmanUpdateStatus::Accepted);
+                EXPECT_EQ(status[idx], KalmanUpdateStatus::Accepted);
+            }
+        }
+
+        // same operation order per lane, so the results are bit-identical
+        for (std::size_t idx = 0; idx < num; idx++)
+        {
+            EXPECT_TRUE(VectorNear(bank.state(idx), singles[idx].state(), 0.0));
+            EXPECT_TRUE(MatrixNear(bank.covariance(idx), singles[idx].covariance(), 0.0));
+        }
+    }
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterBankTest, DenseMeasurementMatchesSingleFilters)
+{
+    // products with a dense H round, so this checks the summation order and not just the algebra
+    const Matrix<2,4> h_dense {
+        {0.7, -0.3, 0.11, 0.05},
+        {0.2, 0.9, -0.07, 0.13}
+    };
+
+    constexpr std::size_t num = 11;
+
+    for (const auto form : {KalmanCovarianceUpdate::Standard, KalmanCovarianceUpdate::Joseph})
+    {
+        KalmanFilterBank<4,2> bank(form);
+        std::vector<KalmanFilter<4,2>> singles;
+
+        for (std::size_t idx = 0; idx < num; idx++)
+        {
+            static_cast<void>(bank.add_track(initial_state(idx), p0));
+            singles.emplace_back(initial_state(idx), p0, form);
+        }
+
+        std::vector<Vector<2>> z(num);
+        std::vector<KalmanUpdateStatus> status(num);
+
+        for (int step = 0; step < 5; step++)
+        {
+            bank.predict(f, q);
+
+            for (std::size_t idx = 0; idx < num; idx++)
+            {
+                singles[idx].predict(f, q);
+                z[idx] = measurement(idx, step);
+            }
+
+            bank.update(z, h_dense, r, status);
+
+            for (std::size_t idx = 0; idx < num; idx++)
+            {
+                static_cast<void>(singles[idx].update(z[idx], h_dense, r));
+            }
+        }
+
+        for (std::size_t idx = 0; idx < num; idx++)
+        {
+            EXPECT_TRUE(VectorNear(bank.state(idx), singles[idx].state(), 0.0));
+            EXPECT_TRUE(MatrixNear(bank.covariance(idx), singles[idx].covariance(), 0.0));
+        }
+    }
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterBankTest, JosephMatchesSingleFilterIllConditioned)
+{
+    // nearly collinear prior and a very precise measurement, as in the KalmanFilter test
+    const double sig = 1e6;
+    const double rho = 0.999'999;
+    const Matrix<2,2> p_init {{sig * sig, rho * sig}, {rho * sig, 1.0}};
+    const Matrix<2,2> h_mat {{0.8, 0.6}, {0.0, 0.0}};
+    const Matrix<2,2> r_mat {{1e-8, 0.0}, {0.0, 1.0}};
+
+    KalmanFilterBank<2,2> bank(KalmanCovarianceUpdate::Joseph);
+    KalmanFilter<2,2> single(Vector<2>{}, p_init, KalmanCovarianceUpdate::Joseph);
+
+    EXPECT_EQ(bank.add_track(Vector<2>{}, p_init), 0);
+
+    const std::vector<Vector<2>> z(1);
+    std::vector<KalmanUpdateStatus> status(1);
+
+    bank.update(z, h_mat, r_mat, status);
+    EXPECT_EQ(status[0], KalmanUpdateStatus::Accepted);
+    EXPECT_EQ(single.update(z[0], h_mat, r_mat).status, KalmanUpdateStatus::Accepted);
+
+    const Matrix<2,2> p = bank.covariance(0);
+    EXPECT_TRUE(MatrixNear(p, single.covariance(), 0.0));
+    EXPECT_GT(p(0,0), 0.0);
+    EXPECT_GT((p(0,0) * p(1,1)) - (p(0,1) * p(1,0)), 0.0);
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterBankTest, SlotReuse)
+{
+    KalmanFilterBank<4,2> bank;
+
+    for (std::size_t idx = 0; idx < 3; idx++)
+    {
+        static_cast<void>(bank.add_track(initial_state(idx), p0));
+    }
+
+    bank.remove_track(1);
+    EXPECT_FALSE(bank.is_active(1));
+    EXPECT_EQ(bank.num_tracks(), 2);
+    EXPECT_THROW(bank.remove_track(1), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(bank.state(1)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(bank.covariance(7)), std::out_of_range);
+
+    EXPECT_EQ(bank.add_track(initial_state(9), p0), 1);
+    EXPECT_EQ(bank.num_slots(), 3);
+    EXPECT_EQ(bank.num_tracks(), 3);
+    EXPECT_TRUE(VectorNear(bank.state(1), initial_state(9), 0.0));
+    EXPECT_TRUE(MatrixNear(bank.covariance(1), p0, 0.0));
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterBankTest, InactiveSlotsUnchanged)
+{
+    KalmanFilterBank<4,2> bank;
+
+    for (std::size_t idx = 0; idx < 4; idx++)
+    {
+        static_cast<void>(bank.add_track(initial_state(idx), p0));
+    }
+
+    bank.remove_track(2);
+
+    std::vector<Vector<2>> z(4, Vector<2>{1.0, 1.0});
+    std::vector<KalmanUpdateStatus> status(4, KalmanUpdateStatus::NotPositiveDefinite);
+
+    bank.predict(f, q);
+    bank.update(z, h, r, status);
+
+    EXPECT_EQ(status[0], KalmanUpdateStatus::Accepted);
+    EXPECT_EQ(status[2], KalmanUpdateStatus::NotPositiveDefinite);
+
+    // reactivated slot starts from its new initial state, untouched by the steps above
+    EXPECT_EQ(bank.add_track(initial_state(5), p0), 2);
+    EXPECT_TRUE(VectorNear(bank.state(2), initial_state(5), 0.0));
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterBankTest, GatingAndMissingMeasurements)
+{
+    KalmanFilterBank<4,2> bank;
+
+    for (std::size_t idx = 0; idx < 3; idx++)
+    {
+        static_cast<void>(bank.add_track(initial_state(idx), p0));
+    }
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<Vector<2>> z {
+        Vector<2>{0.2, 0.1},
+        Vector<2>{500.0, 0.0},
+        Vector<2>{nan, nan}
+    };
+    std::vector<KalmanUpdateStatus> status(3);
+
+    bank.update(z, h, r, status, 9.21);
+
+    EXPECT_EQ(status[0], KalmanUpdateStatus::Accepted);
+    EXPECT_EQ(status[1], KalmanUpdateStatus::Gated);
+    EXPECT_EQ(status[2], KalmanUpdateStatus::Gated);
+    EXPECT_TRUE(VectorNear(bank.state(1), initial_state(1), 0.0));
+    EXPECT_TRUE(VectorNear(bank.state(2), initial_state(2), 0.0));
+    EXPECT_TRUE(MatrixNear(bank.covariance(2), p0, 0.0));
+
+    const Matrix<2,2> bad_r {{-10.0, 0.0}, {0.0, 0.25}};
+    bank.update(z, h, bad_r, status);
+    EXPECT_EQ(status[0], KalmanUpdateStatus::NotPositiveDefinite);
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterBankTest, ThreadedMatchesChunked)
+{
+    KalmanFilterBank<4,2> whole;
+
+    for (std::size_t idx = 0; idx < 20; idx++)
+    {
+        static_cast<void>(whole.add_track(initial_state(idx), p0));
+    }
+
+    KalmanFilterBank<4,2> chunked(whole);
+
+    std::vector<Vector<2>> z(20);
+    for (std::size_t idx = 0; idx < 20; idx++)
+    {
+        z[idx] = measurement(idx, 1);
+    }
+
+    std::vector<KalmanUpdateStatus> status(20);
+
+    // three chunks on three workers
+    whole.predict(f, q, 3);
+    whole.update(z, h, r, status, MathUtils::KALMAN_NO_GATE, 3);
+
+    for (std::size_t chunk = 0; chunk < chunked.num_chunks(); chunk++)
+    {
+        chunked.predict_chunks(f, q, chunk, chunk + 1);
+        chunked.update_chunks(z, h, r, status, chunk, chunk + 1);
+    }
+
+    for (std::size_t idx = 0; idx < 20; idx++)
+    {
+        EXPECT_TRUE(VectorNear(chunked.state(idx), whole.state(idx), 0.0));
+        EXPECT_TRUE(MatrixNear(chunked.covariance(idx), whole.covariance(idx), 0.0));
+    }
+
+    std::vector<Vector<2>> short_z(3);
+    EXPECT_THROW(whole.update(short_z, h, r, status), std::length_error);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,269 @@
+/**
+ * @file KalmanFilter_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Filtering/KalmanFilter.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/Vector.h"
+#include "TestTools/MatrixNear.h"
+#include "TestTools/VectorNear.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <string>
+
+using MathUtils::dot;
+using MathUtils::KalmanCovarianceUpdate;
+using MathUtils::KalmanFilter;
+using MathUtils::KalmanUpdateStatus;
+using MathUtils::Matrix;
+using MathUtils::TestTools::MatrixNear;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-Filtering-KalmanFilter.xml");
+
+/**
+ * @brief 2D constant-velocity model with position measurements. State is [x, y, vx, vy].
+ */
+class KalmanFilterTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+
+    static constexpr double dt = 0.5;
+
+    const Vector<4> x0 {1.0, -2.0, 0.5, 0.25};
+
+    const Matrix<4,4> p0 {
+        {4.0, 0.5, 0.2, 0.0},
+        {0.5, 3.0, 0.0, 0.1},
+        {0.2, 0.0, 1.0, 0.3},
+        {0.0, 0.1, 0.3, 2.0}
+    };
+
+    const Matrix<4,4> f {
+        {1.0, 0.0, dt, 0.0},
+        {0.0, 1.0, 0.0, dt},
+        {0.0, 0.0, 1.0, 0.0},
+        {0.0, 0.0, 0.0, 1.0}
+    };
+
+    const Matrix<4,4> q {
+        {0.01, 0.0, 0.02, 0.0},
+        {0.0, 0.01, 0.0, 0.02},
+        {0.02, 0.0, 0.1, 0.0},
+        {0.0, 0.02, 0.0, 0.1}
+    };
+
+    const Matrix<2,4> h {
+        {1.0, 0.0, 0.0, 0.0},
+        {0.0, 1.0, 0.0, 0.0}
+    };
+
+    const Matrix<2,2> r {{0.5, 0.0}, {0.0, 0.25}};
+
+    const Vector<2> z {1.8, -2.4};
+};
+
+/**
+ * @brief Textbook update with explicit matrix products and a 2x2 inverse.
+ */
+void reference_update(Vector<4>& x, Matrix<4,4>& p, const Vector<2>& z, const Matrix<2,4>& h,
+    const Matrix<2,2>& r)
+{
+    const Matrix<4,2> pht = p * MathUtils::transpose(h);
+    const Matrix<2,2> s = (h * pht) + r;
+    const double det = (s(0,0) * s(1,1)) - (s(0,1) * s(1,0));
+    const Matrix<2,2> s_inv {{s(1,1) / det, -s(0,1) / det}, {-s(1,0) / det, s(0,0) / det}};
+    const Matrix<4,2> k = pht * s_inv;
+
+    x = x + (k * (z - (h * x)));
+    p = p - (k * MathUtils::transpose(pht));
+}
+
+template<std::size_t N>
+void expect_symmetric(const Matrix<N,N>& mat)
+{
+    for (std::size_t ii = 0; ii < N; ii++)
+    {
+        for (std::size_t jj = 0; jj < ii; jj++)
+        {
+            EXPECT_DOUBLE_EQ(mat(ii, jj), mat(jj, ii));
+        }
+    }
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterTest, Predict)
+{
+    KalmanFilter<4,2> kf(x0, p0);
+    kf.predict(f, q);
+
+    EXPECT_TRUE(VectorNear(kf.state(), f * x0, 1e-15));
+    EXPECT_TRUE(MatrixNear(kf.covariance(), (f * p0 * MathUtils::transpose(f)) + q, 1e-14));
+    expect_symmetric(kf.covariance());
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterTest, UpdateMatchesReference)
+{
+    Vector<4> x_ref(x0);
+    Matrix<4,4> p_ref(p0);
+    reference_update(x_ref, p_ref, z, h, r);
+
+    KalmanFilter<4,2> standard(x0, p0, KalmanCovarianceUpdate::Standard);
+    KalmanFilter<4,2> joseph(x0, p0, KalmanCovarianceUpdate::Joseph);
+
+    EXPECT_EQ(standard.update(z, h, r).status, KalmanUpdateStatus::Accepted);
+    EXPECT_EQ(joseph.update(z, h, r).status, KalmanUpdateStatus::Accepted);
+
+    EXPECT_TRUE(VectorNear(standard.state(), x_ref, 1e-14));
+    EXPECT_TRUE(VectorNear(joseph.state(), x_ref, 1e-14));
+    EXPECT_TRUE(MatrixNear(standard.covariance(), p_ref, 1e-14));
+    EXPECT_TRUE(MatrixNear(joseph.covariance(), p_ref, 1e-14));
+    expect_symmetric(joseph.covariance());
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterTest, NormalizedInnovationSquared)
+{
+    KalmanFilter<4,2> kf(x0, p0);
+    const MathUtils::KalmanUpdateResult res = kf.update(z, h, r);
+
+    // S is diagonal here
+    const double s0 = p0(0,0) + r(0,0);
+    const double s1 = p0(1,1) + r(1,1);
+    const double y0 = z(0) - x0(0);
+    const double y1 = z(1) - x0(1);
+    const double det = (s0 * s1) - (p0(0,1) * p0(1,0));
+    const double nis = ((s1 * y0 * y0) - (2.0 * p0(0,1) * y0 * y1) + (s0 * y1 * y1)) / det;
+
+    EXPECT_NEAR(res.nis, nis, 1e-14);
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterTest, Gating)
+{
+    KalmanFilter<4,2> kf(x0, p0);
+    const Vector<2> outlier {50.0, -40.0};
+
+    const MathUtils::KalmanUpdateResult res = kf.update(outlier, h, r, 9.21);
+    EXPECT_EQ(res.status, KalmanUpdateStatus::Gated);
+    EXPECT_GT(res.nis, 9.21);
+    EXPECT_TRUE(VectorNear(kf.state(), x0, 0.0));
+    EXPECT_TRUE(MatrixNear(kf.covariance(), p0, 0.0));
+
+    EXPECT_EQ(kf.update(z, h, r, 9.21).status, KalmanUpdateStatus::Accepted);
+    EXPECT_EQ(kf.update_scalar(100.0, Vector<4>{1.0, 0.0, 0.0, 0.0}, 0.5, 6.63).status,
+        KalmanUpdateStatus::Gated);
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterTest, NotPositiveDefinite)
+{
+    KalmanFilter<4,2> kf(x0, p0);
+    const Matrix<2,2> bad_r {{-10.0, 0.0}, {0.0, 0.25}};
+
+    EXPECT_EQ(kf.update(z, h, bad_r).status, KalmanUpdateStatus::NotPositiveDefinite);
+    EXPECT_EQ(kf.update_scalar(1.0, Vector<4>{1.0, 0.0, 0.0, 0.0}, -10.0).status,
+        KalmanUpdateStatus::NotPositiveDefinite);
+    EXPECT_TRUE(VectorNear(kf.state(), x0, 0.0));
+    EXPECT_TRUE(MatrixNear(kf.covariance(), p0, 0.0));
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterTest, SequentialMatchesVector)
+{
+    for (const auto form : {KalmanCovarianceUpdate::Standard, KalmanCovarianceUpdate::Joseph})
+    {
+        KalmanFilter<4,2> vec_kf(x0, p0, form);
+        KalmanFilter<4,2> seq_kf(x0, p0, form);
+
+        static_cast<void>(vec_kf.update(z, h, r));
+        const auto results = seq_kf.update_sequential(z, h, Vector<2>{r(0,0), r(1,1)});
+
+        EXPECT_EQ(results[0].status, KalmanUpdateStatus::Accepted);
+        EXPECT_EQ(results[1].status, KalmanUpdateStatus::Accepted);
+        EXPECT_TRUE(VectorNear(seq_kf.state(), vec_kf.state(), 1e-14));
+        EXPECT_TRUE(MatrixNear(seq_kf.covariance(), vec_kf.covariance(), 1e-14));
+        expect_symmetric(seq_kf.covariance());
+    }
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterTest, JosephStaysPositiveSemiDefinite)
+{
+    // nearly collinear prior with a very precise measurement, so P - K * H * P cancels badly
+    const double sig = 1e6;
+    const double rho = 0.999'999;
+    const double r_var = 1e-8;
+    const Matrix<2,2> p_init {{sig * sig, rho * sig}, {rho * sig, 1.0}};
+    const Vector<2> h_row {0.8, 0.6};
+    const Matrix<2,2> h_mat {{0.8, 0.6}, {0.0, 0.0}};
+    const Matrix<2,2> r_mat {{r_var, 0.0}, {0.0, 1.0}};
+
+    // det(P+) = det(P-) * r / s for a scalar measurement
+    const double s = dot(h_row, p_init * h_row) + r_var;
+    const double det_prior = (p_init(0,0) * p_init(1,1)) - (p_init(0,1) * p_init(1,0));
+    const double det_post = det_prior * r_var / s;
+
+    const auto det = [](const Matrix<2,2>& p){return (p(0,0) * p(1,1)) - (p(0,1) * p(1,0));};
+
+    KalmanFilter<2,2> std_scalar(Vector<2>{}, p_init, KalmanCovarianceUpdate::Standard);
+    KalmanFilter<2,2> std_vector(Vector<2>{}, p_init, KalmanCovarianceUpdate::Standard);
+    KalmanFilter<2,2> jos_scalar(Vector<2>{}, p_init, KalmanCovarianceUpdate::Joseph);
+    KalmanFilter<2,2> jos_vector(Vector<2>{}, p_init, KalmanCovarianceUpdate::Joseph);
+
+    static_cast<void>(std_scalar.update_scalar(0.0, h_row, r_var));
+    static_cast<void>(std_vector.update(Vector<2>{}, h_mat, r_mat));
+    static_cast<void>(jos_scalar.update_scalar(0.0, h_row, r_var));
+    static_cast<void>(jos_vector.update(Vector<2>{}, h_mat, r_mat));
+
+    EXPECT_LT(det(std_scalar.covariance()), 0.0);
+    EXPECT_LT(std_vector.covariance()(0,0), 0.0);
+
+    for (const Matrix<2,2>& p : {jos_scalar.covariance(), jos_vector.covariance()})
+    {
+        EXPECT_GT(p(0,0), 0.0);
+        EXPECT_GT(p(1,1), 0.0);
+        EXPECT_NEAR(det(p), det_post, 0.01 * det_post);
+        expect_symmetric(p);
+    }
+}
+
+// =================================================================================================
+TEST_F(KalmanFilterTest, Converges)
+{
+    KalmanFilter<4,2> kf(Vector<4>{}, p0);
+    Vector<4> truth(x0);
+
+    for (int step = 0; step < 50; step++)
+    {
+        truth = f * truth;
+        kf.predict(f, q);
+        static_cast<void>(kf.update(h * truth, h, r));
+    }
+
+    EXPECT_TRUE(VectorNear(kf.state(), truth, 1e-3));
+    expect_symmetric(kf.covariance());
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
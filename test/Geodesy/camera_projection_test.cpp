@@ -0,0 +1,267 @@
+/**
+ * @file camera_projection_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Attitude/Quaternion.h"
+#include "Attitude/quaternion_rotate.h"
+#include "conversions.h"
+#include "Geodesy/camera_projection.h"
+#include "Geodesy/GeoCoord.h"
+#include "Geodesy/lla_to_ecef.h"
+#include "Geodesy/ray_ellipsoid.h"
+#include "LinAlg/Vector.h"
+#include "LinAlg/Vector3Batch.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using MathUtils::Conversions::deg2rad;
+using MathUtils::geolocate_rays;
+using MathUtils::GeoCoord;
+using MathUtils::lla_to_ecef;
+using MathUtils::PinholeCamera;
+using MathUtils::project_points;
+using MathUtils::Quaternion;
+using MathUtils::quaternion_rotate;
+using MathUtils::Vector;
+using MathUtils::Vector3Batch;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-camera_projection.xml");
+
+class CameraProjectionTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        m_camera = PinholeCamera {1000.0, 1000.0, 320.0, 240.0, 640.0, 480.0};
+        m_cam_pos = lla_to_ecef(GeoCoord(0.0, 0.0, 400e3));
+
+        // boresight at nadir (-x), image columns toward north (+z)
+        m_q_ecef_cam = Quaternion(std::sqrt(0.5), 0.0, std::sqrt(0.5), 0.0);
+    }
+
+    void TearDown() override
+    {
+    }
+
+    PinholeCamera m_camera {};
+    Vector<3> m_cam_pos;
+    Quaternion m_q_ecef_cam;
+};
+
+// =================================================================================================
+TEST_F(CameraProjectionTest, RoundTripThroughGeolocation)
+{
+    const Vector<3> boresight = quaternion_rotate(m_q_ecef_cam, Vector<3>{0.0, 0.0, 1.0});
+    ASSERT_NEAR(boresight(0), -1.0, 1e-12);
+
+    const std::array<double, 4> u_in {10.0, 320.0, 500.0, 630.0};
+    const std::array<double, 4> v_in {20.0, 240.0, 400.0, 5.0};
+
+    std::vector<Vector<3>> rays;
+
+    for (std::size_t idx = 0; idx < u_in.size(); idx++)
+    {
+        rays.push_back(Vector<3>{
+            (u_in[idx] - m_camera.cx) / m_camera.fx, (v_in[idx] - m_camera.cy) / m_camera.fy, 1.0
+        });
+    }
+
+    std::vector<GeoCoord> ground(rays.size());
+    geolocate_rays(m_cam_pos, m_q_ecef_cam, Vector3Batch(rays), ground);
+
+    std::vector<Vector<3>> points;
+
+    for (const GeoCoord& lla : ground)
+    {
+        ASSERT_FALSE(std::isnan(lla.latitude()));
+        points.push_back(lla_to_ecef(lla));
+    }
+
+    std::array<double, 4> u {};
+    std::array<double, 4> v {};
+    std::array<std::uint8_t, 4> visible {};
+
+    const std::size_t num_visible = project_points(m_camera, m_cam_pos, m_q_ecef_cam,
+        Vector3Batch(points), u, v, visible);
+
+    EXPECT_EQ(num_visible, 4U);
+
+    for (std::size_t idx = 0; idx < u_in.size(); idx++)
+    {
+        EXPECT_NEAR(u[idx], u_in[idx], 1e-6);
+        EXPECT_NEAR(v[idx], v_in[idx], 1e-6);
+        EXPECT_EQ(visible[idx], 1);
+    }
+}
+
+// =================================================================================================
+TEST_F(CameraProjectionTest, Culling)
+{
+    const Quaternion identity(1.0, 0.0, 0.0, 0.0);
+    const Vector<3> origin {0.0, 0.0, 0.0};
+
+    const std::vector<Vector<3>> points {
+        Vector<3>{0.0, 0.0, 10.0},  // principal point
+        Vector<3>{0.0, 0.0, -10.0},  // behind
+        Vector<3>{5.0, 0.0, 10.0},  // right of the image
+        Vector<3>{0.0, 0.0, 0.0}  // at the camera
+    };
+
+    std::array<double, 4> u {};
+    std::array<double, 4> v {};
+    std::array<std::uint8_t, 4> visible {};
+
+    const std::size_t num_visible = project_points(m_camera, origin, identity,
+        Vector3Batch(points), u, v, visible);
+
+    EXPECT_EQ(num_visible, 1U);
+
+    EXPECT_NEAR(u[0], m_camera.cx, 1e-12);
+    EXPECT_NEAR(v[0], m_camera.cy, 1e-12);
+    EXPECT_EQ(visible[0], 1);
+
+    EXPECT_TRUE(std::isnan(u[1]));
+    EXPECT_EQ(visible[1], 0);
+
+    EXPECT_NEAR(u[2], 820.0, 1e-9);
+    EXPECT_EQ(visible[2], 0);
+
+    EXPECT_TRUE(std::isnan(v[3]));
+    EXPECT_EQ(visible[3], 0);
+}
+
+// =================================================================================================
+TEST_F(CameraProjectionTest, Distortion)
+{
+    PinholeCamera camera = m_camera;
+    camera.k1 = 0.1;
+    camera.k2 = 0.01;
+    camera.p1 = 0.001;
+    camera.p2 = -0.002;
+
+    const Quaternion identity(1.0, 0.0, 0.0, 0.0);
+    const Vector<3> origin {0.0, 0.0, 0.0};
+    const std::vector<Vector<3>> points {Vector<3>{1.0, -0.5, 5.0}};
+
+    std::array<double, 1> u {};
+    std::array<double, 1> v {};
+    std::array<std::uint8_t, 1> visible {};
+
+    static_cast<void>(project_points(camera, origin, identity, Vector3Batch(points), u, v,
+        visible));
+
+    const double xn = 0.2;
+    const double yn = -0.1;
+    const double r2 = (xn * xn) + (yn * yn);
+    const double radial = 1.0 + (0.1 * r2) + (0.01 * r2 * r2);
+    const double xd = (xn * radial) + (2.0 * 0.001 * xn * yn) + (-0.002 * (r2 + (2.0 * xn * xn)));
+    const double yd = (yn * radial) + (0.001 * (r2 + (2.0 * yn * yn))) + (2.0 * -0.002 * xn * yn);
+
+    EXPECT_NEAR(u[0], (1000.0 * xd) + 320.0, 1e-9);
+    EXPECT_NEAR(v[0], (1000.0 * yd) + 240.0, 1e-9);
+}
+
+// =================================================================================================
+TEST_F(CameraProjectionTest, BarrelDistortionFoldIsCulled)
+{
+    // about +/-33 deg across the image; the radial polynomial folds back at r^2 = 1 / (3 * 0.3)
+    PinholeCamera camera {1000.0, 1000.0, 640.0, 480.0, 1280.0, 960.0};
+    camera.k1 = -0.3;
+
+    const Quaternion identity(1.0, 0.0, 0.0, 0.0);
+    const Vector<3> origin {0.0, 0.0, 0.0};
+
+    const std::vector<Vector<3>> points {
+        Vector<3>{0.5, 0.0, 1.0},  // inside the field of view
+        Vector<3>{2.0, 0.0, 1.0},  // 63 deg off boresight, folds back to u = 240
+        Vector<3>{0.0, -1.2, 1.0}  // just past the fold
+    };
+
+    std::array<double, 3> u {};
+    std::array<double, 3> v {};
+    std::array<std::uint8_t, 3> visible {};
+
+    const std::size_t num_visible = project_points(camera, origin, identity, Vector3Batch(points),
+        u, v, visible);
+
+    EXPECT_EQ(num_visible, 1U);
+
+    EXPECT_NEAR(u[0], 640.0 + (1000.0 * 0.5 * (1.0 - (0.3 * 0.25))), 1e-9);
+    EXPECT_EQ(visible[0], 1);
+
+    // the distorted pixel is inside the image, but the point is not
+    EXPECT_NEAR(u[1], 240.0, 1e-9);
+    EXPECT_NEAR(v[1], 480.0, 1e-9);
+    EXPECT_EQ(visible[1], 0);
+
+    EXPECT_EQ(visible[2], 0);
+}
+
+// =================================================================================================
+TEST_F(CameraProjectionTest, ThreadedMatchesSingle)
+{
+    std::vector<Vector<3>> points;
+
+    for (std::size_t idx = 0; idx < 37; idx++)
+    {
+        const double t = static_cast<double>(idx);
+        points.push_back(m_cam_pos + Vector<3>{
+            -4e5 + (1e4 * t), 2e4 * std::sin(t), -1.5e5 + (8e3 * t)
+        });
+    }
+
+    const Vector3Batch batch(points);
+    std::vector<double> u(points.size());
+    std::vector<double> v(points.size());
+    std::vector<std::uint8_t> visible(points.size());
+
+    const std::size_t whole = project_points(m_camera, m_cam_pos, m_q_ecef_cam, batch, u, v,
+        visible, 1);
+
+    std::vector<double> u_shard(points.size());
+    std::vector<double> v_shard(points.size());
+    std::vector<std::uint8_t> vis_shard(points.size());
+
+    const std::size_t sharded = project_points(m_camera, m_cam_pos, m_q_ecef_cam, batch, u_shard,
+        v_shard, vis_shard, 4);
+
+    EXPECT_GT(whole, 0U);
+    EXPECT_LT(whole, points.size());
+    EXPECT_EQ(sharded, whole);
+
+    for (std::size_t idx = 0; idx < points.size(); idx++)
+    {
+        EXPECT_EQ(vis_shard[idx], visible[idx]);
+
+        if (!std::isnan(u[idx]))
+        {
+            EXPECT_DOUBLE_EQ(u_shard[idx], u[idx]);
+            EXPECT_DOUBLE_EQ(v_shard[idx], v[idx]);
+        }
+    }
+
+    std::vector<double> too_few(points.size() - 1);
+    EXPECT_THROW(static_cast<void>(project_points(m_camera, m_cam_pos, m_q_ecef_cam, batch,
+        too_few, v, visible)), std::length_error);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -10,7 +10,10 @@
 #include "LinAlg/Vector.h"
 #include "TestTools/GeoCoordNear.h"
 
+#include <array>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
 
 using MathUtils::Conversions::deg2rad;
 using MathUtils::ecef_to_lla;
@@ -73,6 +76,35 @@ TEST(EcefToLlaTest, MathWorksExample2)
     EXPECT_TRUE(GeoCoordNear(result, expected, 1e-3));
 }
 
+// =================================================================================================
+TEST(EcefToLlaTest, BatchMatchesScalar)
+{
+    const std::array<Vector<3>, 3> pos_m {
+        Vector<3>{6'378'137.0+10e3, -6'378'137.0-11e3, 6'378'137.0+12e3},
+        Vector<3>{4510731.0, 4510731.0, 0.0},
+        Vector<3>{0.0, 4507609.0, -4498719.0}
+    };
+
+    std::array<GeoCoord, 3> result;
+    ecef_to_lla(pos_m, result);
+
+    for (std::size_t ii = 0; ii < pos_m.size(); ii++)
+    {
+        EXPECT_TRUE(GeoCoordNear(result.at(ii), ecef_to_lla(pos_m.at(ii)), 0.0));
+    }
+}
+
+// =================================================================================================
+TEST(EcefToLlaTest, BatchThrowsMismatchedLength)
+{
+    const std::vector<Vector<3>> pos_m(3);
+    std::vector<GeoCoord> result(2);
+
+    EXPECT_THROW({
+        ecef_to_lla(pos_m, result);
+    }, std::length_error);
+}
+
 // =================================================================================================
 int main(int argc, char** argv)
 {
@@ -0,0 +1,273 @@
+/**
+ * @file gnss_position_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "conversions.h"
+#include "Geodesy/GeoCoord.h"
+#include "Geodesy/gnss_position.h"
+#include "Geodesy/lla_to_ecef.h"
+#include "LinAlg/cholesky.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/Vector.h"
+#include "TestTools/GeoCoordNear.h"
+#include "TestTools/VectorNear.h"
+
+#include <array>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using MathUtils::cholesky_decompose;
+using MathUtils::cholesky_solve;
+using MathUtils::Conversions::deg2rad;
+using MathUtils::GeoCoord;
+using MathUtils::GnssEpoch;
+using MathUtils::GnssSolution;
+using MathUtils::lla_to_ecef;
+using MathUtils::Matrix;
+using MathUtils::solve_gnss_position;
+using MathUtils::TestTools::GeoCoordNear;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-gnss_position.xml");
+
+constexpr std::size_t NUM_SATS = 8;
+constexpr double SAT_RANGE_M = 21'000e3;
+
+const std::array<double, NUM_SATS> AZIMUTH_DEG {10.0, 60.0, 115.0, 170.0, 205.0, 250.0, 300.0, 340.0};
+const std::array<double, NUM_SATS> ELEVATION_DEG {75.0, 20.0, 45.0, 15.0, 60.0, 30.0, 10.0, 40.0};
+
+/**
+ * @brief Unit vector from the receiver toward a satellite in ECEF.
+ */
+Vector<3> line_of_sight(const GeoCoord& rx, const double azimuth_rad, const double elevation_rad)
+{
+    const double slat = std::sin(rx.latitude());
+    const double clat = std::cos(rx.latitude());
+    const double slon = std::sin(rx.longitude());
+    const double clon = std::cos(rx.longitude());
+
+    const double e = std::cos(elevation_rad) * std::sin(azimuth_rad);
+    const double n = std::cos(elevation_rad) * std::cos(azimuth_rad);
+    const double u = std::sin(elevation_rad);
+
+    return Vector<3> {
+        (-slon * e) + (-slat * clon * n) + (clat * clon * u),
+        (clon * e) + (-slat * slon * n) + (clat * slon * u),
+        (clat * n) + (slat * u)
+    };
+}
+
+/**
+ * @brief Satellites spread over the sky of `rx` and their pseudoranges with `bias_m`.
+ */
+void make_observations(const GeoCoord& rx, const double bias_m, std::vector<Vector<3>>& sats,
+    std::vector<double>& ranges)
+{
+    const Vector<3> rx_ecef = lla_to_ecef(rx);
+
+    sats.clear();
+    ranges.clear();
+
+    for (std::size_t idx = 0; idx < NUM_SATS; idx++)
+    {
+        const Vector<3> los = line_of_sight(
+            rx, deg2rad(AZIMUTH_DEG[idx]), deg2rad(ELEVATION_DEG[idx])
+        );
+        sats.push_back(rx_ecef + (SAT_RANGE_M * los));
+        ranges.push_back(SAT_RANGE_M + bias_m);
+    }
+}
+
+// =================================================================================================
+TEST(GnssPositionTest, RecoversPositionAndClockBias)
+{
+    const GeoCoord rx(deg2rad(40.0), deg2rad(-105.0), 1600.0);
+    const double bias_m = 12'345.0;
+
+    std::vector<Vector<3>> sats;
+    std::vector<double> ranges;
+    make_observations(rx, bias_m, sats, ranges);
+
+    const GnssSolution sol = solve_gnss_position(sats, ranges);
+
+    EXPECT_TRUE(sol.converged);
+    EXPECT_LE(sol.iterations, 10U);
+    EXPECT_TRUE(VectorNear(sol.position_ecef_m, lla_to_ecef(rx), 1e-6));
+    EXPECT_TRUE(GeoCoordNear(sol.position_lla, rx, 1e-6));
+    EXPECT_NEAR(sol.clock_bias_m, bias_m, 1e-6);
+}
+
+// =================================================================================================
+TEST(GnssPositionTest, WarmStartConvergesQuickly)
+{
+    const GeoCoord rx(deg2rad(-33.9), deg2rad(151.2), 50.0);
+
+    std::vector<Vector<3>> sats;
+    std::vector<double> ranges;
+    make_observations(rx, -300.0, sats, ranges);
+
+    const Vector<3> guess = lla_to_ecef(rx) + Vector<3>{100.0, -50.0, 20.0};
+    const GnssSolution sol = solve_gnss_position(sats, ranges, guess);
+
+    EXPECT_TRUE(sol.converged);
+    EXPECT_LE(sol.iterations, 3U);
+    EXPECT_TRUE(VectorNear(sol.position_ecef_m, lla_to_ecef(rx), 1e-6));
+}
+
+// =================================================================================================
+TEST(GnssPositionTest, DilutionOfPrecision)
+{
+    const GeoCoord rx(deg2rad(40.0), deg2rad(-105.0), 1600.0);
+
+    std::vector<Vector<3>> sats;
+    std::vector<double> ranges;
+    make_observations(rx, 0.0, sats, ranges);
+
+    const GnssSolution sol = solve_gnss_position(sats, ranges);
+
+    // independent check: build the geometry matrix directly in east-north-up
+    Matrix<4,4> normal;
+
+    for (std::size_t idx = 0; idx < NUM_SATS; idx++)
+    {
+        const double az = deg2rad(AZIMUTH_DEG[idx]);
+        const double el = deg2rad(ELEVATION_DEG[idx]);
+        const std::array<double, 4> h {
+            -std::cos(el) * std::sin(az), -std::cos(el) * std::cos(az), -std::sin(el), 1.0
+        };
+
+        for (std::size_t ii = 0; ii < 4; ii++)
+        {
+            for (std::size_t jj = 0; jj < 4; jj++)
+            {
+                normal(ii, jj) += h[ii] * h[jj];
+            }
+        }
+    }
+
+    Matrix<4,4> l;
+    ASSERT_TRUE(cholesky_decompose(normal, l));
+
+    std::array<double, 4> q_diag {};
+
+    for (std::size_t ii = 0; ii < 4; ii++)
+    {
+        Vector<4> unit;
+        unit(ii) = 1.0;
+        q_diag[ii] = cholesky_solve(l, unit)(ii);
+    }
+
+    EXPECT_NEAR(sol.dop.hdop, std::sqrt(q_diag[0] + q_diag[1]), 1e-9);
+    EXPECT_NEAR(sol.dop.vdop, std::sqrt(q_diag[2]), 1e-9);
+    EXPECT_NEAR(sol.dop.tdop, std::sqrt(q_diag[3]), 1e-9);
+    EXPECT_NEAR(sol.dop.pdop, std::sqrt(q_diag[0] + q_diag[1] + q_diag[2]), 1e-9);
+    EXPECT_NEAR(sol.dop.gdop, std::sqrt(q_diag[0] + q_diag[1] + q_diag[2] + q_diag[3]), 1e-9);
+}
+
+// =================================================================================================
+TEST(GnssPositionTest, SingularGeometryDoesNotConverge)
+{
+    const Vector<3> sat {20'000e3, 10'000e3, 5'000e3};
+    const std::vector<Vector<3>> sats {sat, sat, sat, sat};
+    const std::vector<double> ranges {2.0e7, 2.0e7, 2.0e7, 2.0e7};
+
+    const GnssSolution sol = solve_gnss_position(sats, ranges);
+
+    EXPECT_FALSE(sol.converged);
+    EXPECT_TRUE(std::isnan(sol.dop.gdop));
+}
+
+// =================================================================================================
+TEST(GnssPositionTest, GuessOnSatelliteDoesNotConverge)
+{
+    std::vector<Vector<3>> sats;
+    std::vector<double> ranges;
+    make_observations(GeoCoord(deg2rad(35.0), deg2rad(-120.0), 100.0), 0.0, sats, ranges);
+
+    const GnssSolution sol = solve_gnss_position(sats, ranges, sats[2]);
+
+    EXPECT_FALSE(sol.converged);
+    EXPECT_EQ(sol.iterations, 1U);
+    EXPECT_TRUE(VectorNear(sol.position_ecef_m, sats[2], 0.0));
+    EXPECT_TRUE(std::isnan(sol.dop.gdop));
+}
+
+// =================================================================================================
+TEST(GnssPositionTest, InvalidObservations)
+{
+    const std::vector<Vector<3>> sats {
+        Vector<3>{2.0e7, 0.0, 0.0}, Vector<3>{0.0, 2.0e7, 0.0}, Vector<3>{0.0, 0.0, 2.0e7}
+    };
+    const std::vector<double> three_ranges {2.0e7, 2.0e7, 2.0e7};
+    const std::vector<double> two_ranges {2.0e7, 2.0e7};
+
+    EXPECT_THROW(static_cast<void>(solve_gnss_position(sats, two_ranges)), std::length_error);
+    EXPECT_THROW(static_cast<void>(solve_gnss_position(sats, three_ranges)), std::length_error);
+}
+
+// =================================================================================================
+TEST(GnssPositionTest, BatchMatchesSingle)
+{
+    constexpr std::size_t num_epochs = 5;
+
+    std::array<std::vector<Vector<3>>, num_epochs> sats;
+    std::array<std::vector<double>, num_epochs> ranges;
+    std::array<GnssEpoch, num_epochs> epochs;
+    std::array<GeoCoord, num_epochs> truth;
+
+    for (std::size_t idx = 0; idx < num_epochs; idx++)
+    {
+        const double step = static_cast<double>(idx);
+        truth[idx] = GeoCoord(deg2rad(45.0 + (1e-4 * step)), deg2rad(7.0), 300.0 + step);
+        make_observations(truth[idx], 10.0 * step, sats[idx], ranges[idx]);
+        epochs[idx] = GnssEpoch {sats[idx], ranges[idx]};
+    }
+
+    std::array<GnssSolution, num_epochs> solutions {};
+    solve_gnss_position(epochs, solutions, MathUtils::GnssSolverOptions{}, 1);
+
+    for (std::size_t idx = 0; idx < num_epochs; idx++)
+    {
+        EXPECT_TRUE(solutions[idx].converged);
+        EXPECT_TRUE(VectorNear(solutions[idx].position_ecef_m, lla_to_ecef(truth[idx]), 1e-6));
+        EXPECT_NEAR(solutions[idx].clock_bias_m, 10.0 * static_cast<double>(idx), 1e-6);
+    }
+
+    // later epochs are seeded with the previous fix
+    EXPECT_LT(solutions[num_epochs - 1].iterations, solutions[0].iterations);
+
+    // chunks [0, 2) and [2, 5) each restart from the earth's center
+    std::array<GnssSolution, num_epochs> threaded {};
+    solve_gnss_position(epochs, threaded, MathUtils::GnssSolverOptions{}, 2);
+
+    for (std::size_t idx = 0; idx < num_epochs; idx++)
+    {
+        EXPECT_TRUE(threaded[idx].converged);
+        EXPECT_TRUE(VectorNear(threaded[idx].position_ecef_m, solutions[idx].position_ecef_m, 1e-6));
+    }
+
+    EXPECT_EQ(threaded[2].iterations, solutions[0].iterations);
+    EXPECT_LT(threaded[4].iterations, threaded[2].iterations);
+
+    std::array<GnssSolution, num_epochs - 1> too_few {};
+    EXPECT_THROW(solve_gnss_position(epochs, too_few), std::length_error);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
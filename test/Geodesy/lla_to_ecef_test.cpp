@@ -11,10 +11,13 @@
 #include "wrap_pi.h"
 
 #include <gtest/gtest.h>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 using MathUtils::wrap_pi;
 using MathUtils::lla_to_ecef;
+using MathUtils::lla_to_ecef_grid;
 using MathUtils::Conversions::deg2rad;
 using MathUtils::GeoCoord;
 using MathUtils::Vector;
@@ -44,6 +47,84 @@ TEST(LlaToEcefTest, ValladoExample3_2)
     EXPECT_TRUE(VectorNear(vallado, pos_ecef_m, 1e-5));
 }
 
+// =================================================================================================
+TEST(LlaToEcefTest, GridMatchesPointwise)
+{
+    const std::vector<double> lat_rad {deg2rad(-89.5), deg2rad(-30.0), 0.0, deg2rad(45.25),
+        deg2rad(89.9)};
+    const std::vector<double> lon_rad {deg2rad(-179.0), deg2rad(-60.0), 0.0, deg2rad(12.5),
+        deg2rad(90.0), deg2rad(179.5)};
+
+    const std::size_t rows = lat_rad.size();
+    const std::size_t cols = lon_rad.size();
+
+    std::vector<double> alt_m(rows * cols);
+
+    for (std::size_t idx = 0; idx < alt_m.size(); idx++)
+    {
+        alt_m[idx] = -400.0 + (123.0 * static_cast<double>(idx));
+    }
+
+    std::vector<double> x_m(rows * cols);
+    std::vector<double> y_m(rows * cols);
+    std::vector<double> z_m(rows * cols);
+
+    lla_to_ecef_grid(lat_rad, lon_rad, alt_m, x_m, y_m, z_m);
+
+    std::vector<double> x0_m(rows * cols);
+    std::vector<double> y0_m(rows * cols);
+    std::vector<double> z0_m(rows * cols);
+
+    lla_to_ecef_grid(lat_rad, lon_rad, {}, x0_m, y0_m, z0_m);
+
+    for (std::size_t ii = 0; ii < rows; ii++)
+    {
+        for (std::size_t jj = 0; jj < cols; jj++)
+        {
+            const std::size_t idx = (ii * cols) + jj;
+            const Vector<3> grid {x_m[idx], y_m[idx], z_m[idx]};
+            const Vector<3> surface {x0_m[idx], y0_m[idx], z0_m[idx]};
+
+            EXPECT_TRUE(VectorNear(grid, lla_to_ecef(GeoCoord(lat_rad[ii], lon_rad[jj],
+                alt_m[idx])), 1e-8));
+            EXPECT_TRUE(VectorNear(surface, lla_to_ecef(GeoCoord(lat_rad[ii], lon_rad[jj], 0.0)),
+                1e-8));
+        }
+    }
+}
+
+// =================================================================================================
+TEST(LlaToEcefTest, GridThreadedMatchesSingle)
+{
+    const std::vector<double> lat_rad {deg2rad(10.0), deg2rad(11.0), deg2rad(12.0)};
+    const std::vector<double> lon_rad {deg2rad(20.0), deg2rad(21.0)};
+    const std::vector<double> alt_m {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+    std::vector<double> x_m(6);
+    std::vector<double> y_m(6);
+    std::vector<double> z_m(6);
+
+    lla_to_ecef_grid(lat_rad, lon_rad, alt_m, x_m, y_m, z_m, 1);
+
+    // one row per worker
+    std::vector<double> xs_m(6);
+    std::vector<double> ys_m(6);
+    std::vector<double> zs_m(6);
+
+    lla_to_ecef_grid(lat_rad, lon_rad, alt_m, xs_m, ys_m, zs_m, 3);
+
+    for (std::size_t idx = 0; idx < xs_m.size(); idx++)
+    {
+        EXPECT_DOUBLE_EQ(xs_m[idx], x_m[idx]);
+        EXPECT_DOUBLE_EQ(ys_m[idx], y_m[idx]);
+        EXPECT_DOUBLE_EQ(zs_m[idx], z_m[idx]);
+    }
+
+    std::vector<double> too_few(5);
+    EXPECT_THROW(lla_to_ecef_grid(lat_rad, lon_rad, alt_m, x_m, too_few, z_m), std::length_error);
+    EXPECT_THROW(lla_to_ecef_grid(lat_rad, lon_rad, too_few, x_m, y_m, z_m), std::length_error);
+}
+
 // =================================================================================================
 int main(int argc, char** argv)
 {
@@ -0,0 +1,193 @@
+/**
+ * @file ray_ellipsoid_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Attitude/Quaternion.h"
+#include "Attitude/quaternion_rotate.h"
+#include "constants.h"
+#include "conversions.h"
+#include "Geodesy/ecef_to_lla.h"
+#include "Geodesy/GeoCoord.h"
+#include "Geodesy/lla_to_ecef.h"
+#include "Geodesy/ray_ellipsoid.h"
+#include "LinAlg/Vector.h"
+#include "LinAlg/Vector3Batch.h"
+#include "TestTools/GeoCoordNear.h"
+
+#include <array>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using MathUtils::Constants::WGS84_A_M;
+using MathUtils::Constants::WGS84_B_M;
+using MathUtils::Conversions::deg2rad;
+using MathUtils::ecef_to_lla;
+using MathUtils::geolocate_rays;
+using MathUtils::GeoCoord;
+using MathUtils::lla_to_ecef;
+using MathUtils::Quaternion;
+using MathUtils::quaternion_rotate;
+using MathUtils::ray_ellipsoid_range;
+using MathUtils::TestTools::GeoCoordNear;
+using MathUtils::Vector;
+using MathUtils::Vector3Batch;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-ray_ellipsoid.xml");
+
+// =================================================================================================
+TEST(RayEllipsoidTest, Nadir)
+{
+    const Vector<3> equator {WGS84_A_M + 1e6, 0.0, 0.0};
+    const Vector<3> pole {0.0, 0.0, -(WGS84_B_M + 1e6)};
+
+    EXPECT_NEAR(ray_ellipsoid_range(equator, Vector<3>{-1.0, 0.0, 0.0}), 1e6, 1e-6);
+    EXPECT_NEAR(ray_ellipsoid_range(equator, Vector<3>{-1.0, 0.0, 0.0}, 500.0), 1e6 - 500.0, 1e-6);
+    EXPECT_NEAR(ray_ellipsoid_range(pole, Vector<3>{0.0, 0.0, 1.0}), 1e6, 1e-6);
+
+    // range is in multiples of the direction length
+    EXPECT_NEAR(ray_ellipsoid_range(equator, Vector<3>{-2.0, 0.0, 0.0}), 5e5, 1e-6);
+}
+
+// =================================================================================================
+TEST(RayEllipsoidTest, Misses)
+{
+    const Vector<3> origin {WGS84_A_M + 1e6, 0.0, 0.0};
+
+    EXPECT_TRUE(std::isnan(ray_ellipsoid_range(origin, Vector<3>{0.0, 1.0, 0.0})));
+    EXPECT_TRUE(std::isnan(ray_ellipsoid_range(origin, Vector<3>{1.0, 0.0, 0.0})));
+
+    // just inside and just outside the horizon, as angles off nadir in the equatorial plane
+    const double horizon = std::asin(WGS84_A_M / (WGS84_A_M + 1e6));
+    const double inside = horizon - 1e-4;
+    const double outside = horizon + 1e-4;
+
+    EXPECT_FALSE(std::isnan(ray_ellipsoid_range(origin,
+        Vector<3>{-std::cos(inside), std::sin(inside), 0.0})));
+    EXPECT_TRUE(std::isnan(ray_ellipsoid_range(origin,
+        Vector<3>{-std::cos(outside), std::sin(outside), 0.0})));
+}
+
+// =================================================================================================
+TEST(RayEllipsoidTest, BatchMatchesScalar)
+{
+    const Vector<3> origin = lla_to_ecef(GeoCoord(deg2rad(35.0), deg2rad(-120.0), 700e3));
+
+    const std::vector<Vector<3>> dirs {
+        -1.0 * origin,
+        Vector<3>{0.1, 0.2, -0.9},
+        Vector<3>{0.3, -0.1, 0.2},
+        Vector<3>{-0.2, 0.8, -0.5}
+    };
+    const Vector3Batch batch(dirs);
+
+    std::array<double, 4> range {};
+    ray_ellipsoid_range(origin, batch, range, 100.0);
+
+    for (std::size_t idx = 0; idx < dirs.size(); idx++)
+    {
+        const double expected = ray_ellipsoid_range(origin, dirs[idx], 100.0);
+
+        if (std::isnan(expected))
+        {
+            EXPECT_TRUE(std::isnan(range[idx]));
+        }
+        else
+        {
+            EXPECT_DOUBLE_EQ(range[idx], expected);
+        }
+    }
+
+    std::array<double, 3> too_few {};
+    EXPECT_THROW(ray_ellipsoid_range(origin, batch, too_few), std::length_error);
+}
+
+// =================================================================================================
+TEST(RayEllipsoidTest, GeolocateNadir)
+{
+    const GeoCoord sub_point(deg2rad(30.0), deg2rad(45.0), 0.0);
+    const GeoCoord cam(deg2rad(30.0), deg2rad(45.0), 500e3);
+    const Vector<3> cam_ecef = lla_to_ecef(cam);
+
+    // geodetic down at the sub-point passes through the camera
+    const double slat = std::sin(sub_point.latitude());
+    const double clat = std::cos(sub_point.latitude());
+    const double slon = std::sin(sub_point.longitude());
+    const double clon = std::cos(sub_point.longitude());
+    const Vector<3> down {-clat * clon, -clat * slon, -slat};
+
+    const std::vector<Vector<3>> rays {down, Vector<3>{0.0, 0.0, 1.0}};
+    std::array<GeoCoord, 2> ground {};
+
+    geolocate_rays(cam_ecef, Quaternion(1.0, 0.0, 0.0, 0.0), Vector3Batch(rays), ground, 250.0);
+
+    EXPECT_NEAR(ground[0].latitude(), sub_point.latitude(), 1e-9);
+    EXPECT_NEAR(ground[0].longitude(), sub_point.longitude(), 1e-9);
+
+    // the offset surface is within centimeters of constant height near the sub-point
+    EXPECT_NEAR(ground[0].altitude(), 250.0, 0.05);
+
+    EXPECT_TRUE(std::isnan(ground[1].latitude()));
+    EXPECT_TRUE(std::isnan(ground[1].altitude()));
+}
+
+// =================================================================================================
+TEST(RayEllipsoidTest, GeolocateRotated)
+{
+    const Vector<3> cam_ecef = lla_to_ecef(GeoCoord(deg2rad(-10.0), deg2rad(100.0), 600e3));
+    Quaternion q_ecef_cam(0.6, -0.3, 0.5, 0.2);
+    q_ecef_cam.normalize();
+
+    std::vector<Vector<3>> rays;
+
+    for (std::size_t idx = 0; idx < 16; idx++)
+    {
+        const double u = (static_cast<double>(idx % 4) - 1.5) * 0.2;
+        const double v = (static_cast<double>(idx / 4) - 1.5) * 0.2;
+        rays.push_back(Vector<3>{u, v, 1.0});
+    }
+
+    std::vector<GeoCoord> ground(rays.size());
+    geolocate_rays(cam_ecef, q_ecef_cam, Vector3Batch(rays), ground);
+
+    std::size_t hits = 0;
+
+    for (std::size_t idx = 0; idx < rays.size(); idx++)
+    {
+        const Vector<3> dir = quaternion_rotate(q_ecef_cam, rays[idx]);
+        const double t = ray_ellipsoid_range(cam_ecef, dir);
+
+        if (std::isnan(t))
+        {
+            EXPECT_TRUE(std::isnan(ground[idx].latitude()));
+            continue;
+        }
+
+        const GeoCoord expected = ecef_to_lla(cam_ecef + (t * dir));
+        EXPECT_TRUE(GeoCoordNear(ground[idx], expected, 1e-6));
+        hits++;
+    }
+
+    EXPECT_GT(hits, 0U);
+
+    std::vector<GeoCoord> too_few(rays.size() - 1);
+    EXPECT_THROW(geolocate_rays(cam_ecef, q_ecef_cam, Vector3Batch(rays), too_few),
+        std::length_error);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,81 @@
+/**
+ * @file DynamicMatrix_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/DynamicMatrix.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MathUtils::DynamicMatrix;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-DynamicMatrix.xml");
+
+// =================================================================================================
+TEST(DynamicMatrix, Construct)
+{
+    const DynamicMatrix mat(3, 5);
+
+    EXPECT_EQ(mat.rows(), 3);
+    EXPECT_EQ(mat.cols(), 5);
+
+    for (std::size_t ii = 0; ii < 3; ii++)
+    {
+        for (std::size_t jj = 0; jj < 5; jj++)
+        {
+            EXPECT_DOUBLE_EQ(mat(ii, jj), 0.0);
+        }
+    }
+}
+
+// =================================================================================================
+TEST(DynamicMatrix, ElementAccess)
+{
+    DynamicMatrix mat(2, 3);
+    mat(1, 2) = 4.5;
+
+    EXPECT_DOUBLE_EQ(mat(1, 2), 4.5);
+    EXPECT_DOUBLE_EQ(mat.data()[5], 4.5);
+    EXPECT_THROW(static_cast<void>(mat(2, 0)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(mat(0, 3)), std::out_of_range);
+}
+
+// =================================================================================================
+TEST(DynamicMatrix, Multiply)
+{
+    DynamicMatrix mat(2, 3);
+    mat(0, 0) = 1.0;
+    mat(0, 1) = 2.0;
+    mat(0, 2) = 3.0;
+    mat(1, 0) = -1.0;
+    mat(1, 2) = 0.5;
+
+    const std::vector<double> x {1.0, -2.0, 4.0};
+    std::vector<double> y(2);
+    mat.multiply(x, y);
+
+    EXPECT_DOUBLE_EQ(y[0], 9.0);
+    EXPECT_DOUBLE_EQ(y[1], 1.0);
+
+    std::vector<double> bad(3);
+    EXPECT_THROW(mat.multiply(y, bad), std::length_error);
+    EXPECT_THROW(mat.multiply(x, bad), std::length_error);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
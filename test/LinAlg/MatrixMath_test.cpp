@@ -283,6 +283,124 @@ TEST_F(MatrixMathTest, Subtract3x2)
     EXPECT_TRUE(MatrixNear(expected, result));
 }
 
+// =================================================================================================
+TEST_F(MatrixMathTest, ChainedTemporaries)
+{
+    const Matrix<3,3> result = (mat1 + mat2) - mat2 + mat1;
+
+    EXPECT_TRUE(MatrixNear(result, mat1 * 2));
+    EXPECT_TRUE(MatrixNear(2.0 * (mat1 + mat1), mat1 * 4));
+    EXPECT_TRUE(MatrixNear((mat1 - mat2) * 1, mat1_minus_mat2));
+}
+
+// =================================================================================================
+TEST_F(MatrixMathTest, InPlaceFunctions)
+{
+    Matrix<3,3> result;
+
+    MathUtils::add_into(mat1, mat2, result);
+    EXPECT_TRUE(MatrixNear(result, mat1_plus_mat2));
+
+    MathUtils::sub_into(mat1, mat2, result);
+    EXPECT_TRUE(MatrixNear(result, mat1_minus_mat2));
+
+    MathUtils::mul_into(mat1, mat2, result);
+    EXPECT_TRUE(MatrixNear(result, mat1_times_mat2));
+
+    const Matrix<3,2> mat3 {{1, 2}, {3, 4}, {5, 6}};
+    const Vector<2> vec {1, -1};
+    Vector<3> vec_result;
+
+    MathUtils::mul_into(mat3, vec, vec_result);
+    EXPECT_TRUE(VectorNear(vec_result, Vector<3>{-1, -1, -1}));
+}
+
+// =================================================================================================
+TEST_F(MatrixMathTest, Transpose)
+{
+    const Matrix<3,2> mat {{1, 2}, {3, 4}, {5, 6}};
+    const Matrix<2,3> expected {{1, 3, 5}, {2, 4, 6}};
+
+    EXPECT_TRUE(MatrixNear(MathUtils::transpose(mat), expected));
+}
+
+// =================================================================================================
+TEST_F(MatrixMathTest, TransposeInPlace)
+{
+    MathUtils::transpose_in_place(mat1);
+
+    EXPECT_TRUE(MatrixNear(mat1, Matrix<3,3>{{1, 4, 7}, {2, 5, 8}, {3, 6, 9}}));
+}
+
+// =================================================================================================
+TEST_F(MatrixMathTest, TransposeLargeSpansTiles)
+{
+    Matrix<19,21> mat;
+    for (std::size_t ii = 0; ii < mat.rows(); ii++)
+    {
+        for (std::size_t jj = 0; jj < mat.cols(); jj++)
+        {
+            mat(ii, jj) = static_cast<double>((ii * 100) + jj);
+        }
+    }
+
+    const Matrix<21,19> res = MathUtils::transpose(mat);
+
+    Matrix<19,19> square;
+    for (std::size_t ii = 0; ii < square.rows(); ii++)
+    {
+        for (std::size_t jj = 0; jj < square.cols(); jj++)
+        {
+            square(ii, jj) = mat(ii, jj);
+        }
+    }
+
+    MathUtils::transpose_in_place(square);
+
+    for (std::size_t ii = 0; ii < mat.rows(); ii++)
+    {
+        for (std::size_t jj = 0; jj < mat.cols(); jj++)
+        {
+            EXPECT_DOUBLE_EQ(res(jj, ii), mat(ii, jj));
+
+            if (jj < square.cols())
+            {
+                EXPECT_DOUBLE_EQ(square(jj, ii), mat(ii, jj));
+            }
+        }
+    }
+}
+
+// =================================================================================================
+TEST_F(MatrixMathTest, TransposeOnWorkerThreads)
+{
+    Matrix<45,37> mat;
+    for (std::size_t ii = 0; ii < mat.rows(); ii++)
+    {
+        for (std::size_t jj = 0; jj < mat.cols(); jj++)
+        {
+            mat(ii, jj) = static_cast<double>((ii * 100) + jj);
+        }
+    }
+
+    EXPECT_TRUE(MatrixNear(MathUtils::transpose(mat, 4), MathUtils::transpose(mat, 1)));
+
+    Matrix<45,45> square;
+    for (std::size_t ii = 0; ii < square.rows(); ii++)
+    {
+        for (std::size_t jj = 0; jj < square.cols(); jj++)
+        {
+            square(ii, jj) = static_cast<double>((ii * 100) + jj);
+        }
+    }
+
+    Matrix<45,45> threaded(square);
+    MathUtils::transpose_in_place(threaded, 4);
+    MathUtils::transpose_in_place(square, 1);
+
+    EXPECT_TRUE(MatrixNear(threaded, square));
+}
+
 // =================================================================================================
 int main(int argc, char** argv)
 {
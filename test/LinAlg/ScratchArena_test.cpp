@@ -0,0 +1,147 @@
+/**
+ * @file ScratchArena_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/Matrix.h"
+#include "LinAlg/ScratchArena.h"
+#include "TestTools/MatrixNear.h"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <new>
+#include <string>
+#include <type_traits>
+
+using MathUtils::Matrix;
+using MathUtils::ScratchArena;
+using MathUtils::ScratchScope;
+using MathUtils::ScratchValue;
+using MathUtils::TestTools::MatrixNear;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-ScratchArena.xml");
+
+// =================================================================================================
+TEST(ScratchArenaTest, AllocationsAreAligned)
+{
+    ScratchArena arena(1024);
+
+    void* const a = arena.allocate(3, 1);
+    void* const b = arena.allocate(8, 64);
+
+    EXPECT_NE(a, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 64, 0);
+}
+
+// =================================================================================================
+TEST(ScratchArenaTest, NotMovable)
+{
+    // scopes hold the arena by reference, so a moved-from arena would be rewound by mistake
+    static_assert(!std::is_move_constructible_v<ScratchArena>);
+    static_assert(!std::is_move_assignable_v<ScratchArena>);
+}
+
+// =================================================================================================
+TEST(ScratchArenaTest, ThrowsWhenFull)
+{
+    ScratchArena arena(64);
+
+    EXPECT_THROW({
+        [[maybe_unused]] void* mem = arena.allocate(65, 1);
+    }, std::bad_alloc);
+}
+
+// =================================================================================================
+TEST(ScratchArenaTest, ScopeRewindsAndTracksPeak)
+{
+    ScratchArena arena(64 * 1024);
+
+    {
+        ScratchScope scope(arena);
+        auto& mat = scope.create<Matrix<40,40>>(Matrix<40,40>::identity());
+
+        EXPECT_DOUBLE_EQ(mat(39, 39), 1.0);
+        EXPECT_GE(arena.used(), sizeof(Matrix<40,40>));
+    }
+
+    EXPECT_EQ(arena.used(), 0);
+    EXPECT_GE(arena.peak(), sizeof(Matrix<40,40>));
+
+    arena.reset_peak();
+    EXPECT_EQ(arena.peak(), 0);
+}
+
+// =================================================================================================
+TEST(ScratchArenaTest, ScratchValueUsesThreshold)
+{
+    static_assert(!ScratchValue<Matrix<3,3>>::in_arena);
+    static_assert(ScratchValue<Matrix<30,30>>::in_arena);
+
+    ScratchArena& arena = ScratchArena::thread_local_instance();
+    const std::size_t start = arena.used();
+
+    {
+        ScratchScope scope;
+        ScratchValue<Matrix<3,3>> small(scope, Matrix<3,3>::identity());
+        EXPECT_EQ(arena.used(), start);
+
+        ScratchValue<Matrix<30,30>> large(scope, Matrix<30,30>::identity());
+        *large += Matrix<30,30>::identity();
+
+        EXPECT_GT(arena.used(), start);
+        EXPECT_TRUE(MatrixNear(*small, Matrix<3,3>::identity()));
+        EXPECT_DOUBLE_EQ(large->at(29, 29), 2.0);
+    }
+
+    EXPECT_EQ(arena.used(), start);
+}
+
+// =================================================================================================
+TEST(ScratchArenaTest, AliasedProductStagesInArena)
+{
+    Matrix<30,30> a = Matrix<30,30>::identity() * 2.0;
+    Matrix<30,30> b;
+
+    for (std::size_t ii = 0; ii < 30; ii++)
+    {
+        for (std::size_t jj = 0; jj < 30; jj++)
+        {
+            b(ii, jj) = static_cast<double>(ii) - static_cast<double>(jj);
+        }
+    }
+
+    const Matrix<30,30> expected = a * b;
+
+    ScratchArena& arena = ScratchArena::thread_local_instance();
+    const std::size_t start = arena.used();
+    arena.reset_peak();
+
+    MathUtils::mul_into(a, b, a);
+
+    EXPECT_TRUE(MatrixNear(a, expected));
+    EXPECT_EQ(arena.used(), start);
+    EXPECT_GE(arena.peak(), start + sizeof(Matrix<30,30>));
+
+    // small products stage on the stack
+    Matrix<3,3> small = Matrix<3,3>::identity();
+    arena.reset_peak();
+    MathUtils::mul_into(small, small, small);
+
+    EXPECT_TRUE(MatrixNear(small, Matrix<3,3>::identity()));
+    EXPECT_EQ(arena.peak(), start);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,111 @@
+/**
+ * @file SparseMatrix_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/SparseMatrix.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MathUtils::SparseEntry;
+using MathUtils::SparseMatrix;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-SparseMatrix.xml");
+
+class SparseMatrixTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+
+    // [[4, 0, -1, 0], [0, 0, 0, 0], [2, 3, 0, 0]], unsorted with a duplicate at (0,0)
+    const std::vector<SparseEntry> entries {
+        {2, 1, 3.0},
+        {0, 2, -1.0},
+        {0, 0, 1.5},
+        {2, 0, 2.0},
+        {0, 0, 2.5}
+    };
+};
+
+// =================================================================================================
+TEST_F(SparseMatrixTest, Build)
+{
+    const SparseMatrix mat(3, 4, entries);
+
+    EXPECT_EQ(mat.rows(), 3);
+    EXPECT_EQ(mat.cols(), 4);
+    EXPECT_EQ(mat.num_nonzero(), 4);
+
+    const std::vector<std::size_t> offsets {0, 2, 2, 4};
+    const std::vector<std::size_t> cols {0, 2, 0, 1};
+    EXPECT_TRUE(std::equal(offsets.begin(), offsets.end(), mat.row_offsets().begin()));
+    EXPECT_TRUE(std::equal(cols.begin(), cols.end(), mat.col_indices().begin()));
+
+    EXPECT_DOUBLE_EQ(mat(0, 0), 4.0);
+    EXPECT_DOUBLE_EQ(mat(0, 2), -1.0);
+    EXPECT_DOUBLE_EQ(mat(2, 1), 3.0);
+    EXPECT_DOUBLE_EQ(mat(1, 1), 0.0);
+    EXPECT_DOUBLE_EQ(mat(2, 3), 0.0);
+}
+
+// =================================================================================================
+TEST_F(SparseMatrixTest, InvalidIndex)
+{
+    const std::vector<SparseEntry> bad {{3, 0, 1.0}};
+    EXPECT_THROW(SparseMatrix(3, 4, bad), std::out_of_range);
+
+    const SparseMatrix mat(3, 4, entries);
+    EXPECT_THROW(static_cast<void>(mat(0, 4)), std::out_of_range);
+}
+
+// =================================================================================================
+TEST_F(SparseMatrixTest, Multiply)
+{
+    const SparseMatrix mat(3, 4, entries);
+    const std::vector<double> x {1.0, 2.0, 3.0, 4.0};
+    std::vector<double> y(3, -9.0);
+
+    mat.multiply(x, y);
+
+    EXPECT_DOUBLE_EQ(y[0], 1.0);
+    EXPECT_DOUBLE_EQ(y[1], 0.0);
+    EXPECT_DOUBLE_EQ(y[2], 8.0);
+
+    std::vector<double> bad(4);
+    EXPECT_THROW(mat.multiply(x, bad), std::length_error);
+    EXPECT_THROW(mat.multiply(y, y), std::length_error);
+}
+
+// =================================================================================================
+TEST_F(SparseMatrixTest, Diagonal)
+{
+    const SparseMatrix mat(3, 4, entries);
+    const std::vector<double> diag = mat.diagonal();
+
+    ASSERT_EQ(diag.size(), 3);
+    EXPECT_DOUBLE_EQ(diag[0], 4.0);
+    EXPECT_DOUBLE_EQ(diag[1], 0.0);
+    EXPECT_DOUBLE_EQ(diag[2], 0.0);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,179 @@
+/**
+ * @file Vector3Batch_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "constants.h"
+#include "LinAlg/Vector.h"
+#include "LinAlg/Vector3Batch.h"
+#include "TestTools/VectorNear.h"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MathUtils::cross;
+using MathUtils::dot;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::Vector;
+using MathUtils::Vector3Batch;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-Vector3Batch.xml");
+
+class Vector3BatchTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+
+    const std::array<Vector<3>, 3> aos_a {
+        Vector<3>{1, 2, 3},
+        Vector<3>{1, 0, 0},
+        Vector<3>{-2.0, 0.5, 4.0}
+    };
+
+    const std::array<Vector<3>, 3> aos_b {
+        Vector<3>{4, 5, 6},
+        Vector<3>{0, 1, 0},
+        Vector<3>{3.0, -1.0, 0.25}
+    };
+
+    const Vector3Batch a {aos_a};
+    const Vector3Batch b {aos_b};
+};
+
+// =================================================================================================
+TEST_F(Vector3BatchTest, RoundTripsVectors)
+{
+    ASSERT_EQ(a.size(), 3);
+
+    for (std::size_t ii = 0; ii < a.size(); ii++)
+    {
+        EXPECT_TRUE(VectorNear(a.get(ii), aos_a.at(ii)));
+    }
+
+    EXPECT_THROW({
+        [[maybe_unused]] Vector<3> vec = a.get(3);
+    }, std::out_of_range);
+}
+
+// =================================================================================================
+TEST_F(Vector3BatchTest, DotMatchesScalar)
+{
+    std::vector<double> res(3);
+    MathUtils::batch_dot(a, b, res);
+
+    for (std::size_t ii = 0; ii < res.size(); ii++)
+    {
+        EXPECT_DOUBLE_EQ(res.at(ii), dot(aos_a.at(ii), aos_b.at(ii)));
+    }
+
+    MathUtils::batch_dot(aos_a.at(0), b, res);
+
+    for (std::size_t ii = 0; ii < res.size(); ii++)
+    {
+        EXPECT_DOUBLE_EQ(res.at(ii), dot(aos_a.at(0), aos_b.at(ii)));
+    }
+}
+
+// =================================================================================================
+TEST_F(Vector3BatchTest, CrossMatchesScalar)
+{
+    Vector3Batch res;
+    MathUtils::batch_cross(a, b, res);
+
+    ASSERT_EQ(res.size(), 3);
+    for (std::size_t ii = 0; ii < res.size(); ii++)
+    {
+        EXPECT_TRUE(VectorNear(res.get(ii), cross(aos_a.at(ii), aos_b.at(ii))));
+    }
+
+    // broadcast into aliased output
+    res = b;
+    MathUtils::batch_cross(aos_a.at(2), res, res);
+
+    for (std::size_t ii = 0; ii < res.size(); ii++)
+    {
+        EXPECT_TRUE(VectorNear(res.get(ii), cross(aos_a.at(2), aos_b.at(ii))));
+    }
+}
+
+// =================================================================================================
+TEST_F(Vector3BatchTest, CrossNormalized)
+{
+    Vector3Batch res;
+    MathUtils::batch_cross_normalized(a, b, res);
+
+    for (std::size_t ii = 0; ii < res.size(); ii++)
+    {
+        Vector<3> expected = cross(aos_a.at(ii), aos_b.at(ii));
+        expected.normalize();
+
+        EXPECT_TRUE(VectorNear(res.get(ii), expected));
+    }
+}
+
+// =================================================================================================
+TEST_F(Vector3BatchTest, TripleProduct)
+{
+    std::vector<double> res(3);
+    MathUtils::batch_triple_product(a, b, a, res);
+
+    for (const double val : res)
+    {
+        EXPECT_NEAR(val, 0.0, 1e-12);
+    }
+
+    const Vector3Batch c {std::array<Vector<3>, 3>{Vector<3>{0, 0, 1}, Vector<3>{0, 0, 1},
+        Vector<3>{0, 0, 1}}};
+    MathUtils::batch_triple_product(b, c, a, res);
+
+    EXPECT_DOUBLE_EQ(res.at(1), 1.0);  // y . (z x x)
+}
+
+// =================================================================================================
+TEST_F(Vector3BatchTest, AngleBetween)
+{
+    std::vector<double> res(3);
+    MathUtils::batch_angle_between(a, a, res);
+
+    for (const double val : res)
+    {
+        EXPECT_NEAR(val, 0.0, 1e-7);
+    }
+
+    MathUtils::batch_angle_between(Vector<3>{0, 0, 0}, b, res);
+    EXPECT_DOUBLE_EQ(res.at(0), MathUtils::Constants::PI_DIV2);
+
+    MathUtils::batch_angle_between(a, b, res);
+    EXPECT_DOUBLE_EQ(res.at(1), MathUtils::Constants::PI_DIV2);
+}
+
+// =================================================================================================
+TEST_F(Vector3BatchTest, ThrowsMismatchedLength)
+{
+    std::vector<double> res(2);
+
+    EXPECT_THROW({
+        MathUtils::batch_dot(a, b, res);
+    }, std::length_error);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
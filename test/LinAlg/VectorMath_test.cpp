@@ -7,9 +7,11 @@
 #include "LinAlg/Vector.h"
 #include "TestTools/VectorNear.h"
 
+#include <array>
 #include <cmath>
 #include <gtest/gtest.h>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <utility>
 
@@ -184,6 +186,77 @@ TEST_F(VectorMathTest, Multiplication)
     EXPECT_DOUBLE_EQ(res(2), vec1_times_vec2(2));
 }
 
+// =================================================================================================
+TEST_F(VectorMathTest, ChainedTemporaries)
+{
+    const Vector<3> res = (vec1 + vec2) - vec1 + 2.0;
+    const Vector<3> expected {6, 7, 8};
+
+    EXPECT_TRUE(VectorNear(res, expected));
+    EXPECT_TRUE(VectorNear(scalar * (vec1 * vec2), Vector<3>{16, 40, 72}));
+    EXPECT_TRUE(VectorNear((vec1 - 1) * scalar, Vector<3>{0, 4, 8}));
+}
+
+// =================================================================================================
+TEST_F(VectorMathTest, InPlaceFunctions)
+{
+    Vector<3> res;
+
+    MathUtils::add_into(vec1, vec2, res);
+    EXPECT_TRUE(VectorNear(res, vec1_plus_vec2));
+
+    MathUtils::sub_into(vec1, vec2, res);
+    EXPECT_TRUE(VectorNear(res, vec1_minus_vec2));
+
+    MathUtils::mul_into(vec1, vec2, vec1);
+    EXPECT_TRUE(VectorNear(vec1, vec1_times_vec2));
+}
+
+// =================================================================================================
+TEST_F(VectorMathTest, NormalizeFast)
+{
+    vec2.normalize_fast();
+
+    EXPECT_TRUE(VectorNear(vec2, vec2_normalized, 5e-6));
+}
+
+// =================================================================================================
+TEST_F(VectorMathTest, NormalizeFastSmallVector)
+{
+    Vector<3> vec {1e-9, 0.0, 0.0};
+    vec.normalize_fast();
+
+    EXPECT_NEAR(vec(0), 1.0, 5e-6);
+    EXPECT_DOUBLE_EQ(vec(1), 0.0);
+    EXPECT_DOUBLE_EQ(vec(2), 0.0);
+}
+
+// =================================================================================================
+TEST_F(VectorMathTest, RenormalizeNearlyUnit)
+{
+    Vector<4> vec {0.5, 0.5, 0.5, 0.5};
+    vec *= 1.0 + 1e-4;
+
+    const double err = (vec.magnitude() * vec.magnitude()) - 1.0;  // |v|^2 = 1 + err
+    vec.renormalize_nearly_unit();
+
+    EXPECT_NEAR(vec.magnitude(), 1.0, (3.0 / 8.0) * err * err * 1.001);
+}
+
+// =================================================================================================
+TEST_F(VectorMathTest, BatchNormalize)
+{
+    std::array<Vector<3>, 2> vecs {vec1, vec2};
+
+    MathUtils::normalize_fast(std::span<Vector<3>>(vecs));
+    EXPECT_TRUE(VectorNear(vecs.at(0), vec1_normalized, 5e-6));
+    EXPECT_TRUE(VectorNear(vecs.at(1), vec2_normalized, 5e-6));
+
+    MathUtils::renormalize_nearly_unit(std::span<Vector<3>>(vecs));
+    EXPECT_NEAR(vecs.at(0).magnitude(), 1.0, 1e-10);
+    EXPECT_NEAR(vecs.at(1).magnitude(), 1.0, 1e-10);
+}
+
 // =================================================================================================
 int main(int argc, char** argv)
 {
@@ -0,0 +1,112 @@
+/**
+ * @file cholesky_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/cholesky.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/Vector.h"
+#include "TestTools/MatrixNear.h"
+#include "TestTools/VectorNear.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+
+using MathUtils::Matrix;
+using MathUtils::TestTools::MatrixNear;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-cholesky.xml");
+
+class CholeskyTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+
+    const Matrix<3,3> spd {
+        {4.0, 2.0, 0.4},
+        {2.0, 5.0, 1.0},
+        {0.4, 1.0, 3.0}
+    };
+};
+
+// =================================================================================================
+TEST_F(CholeskyTest, Decompose)
+{
+    Matrix<3,3> l;
+    ASSERT_TRUE(MathUtils::cholesky_decompose(spd, l));
+
+    EXPECT_DOUBLE_EQ(l(0,0), 2.0);
+    EXPECT_DOUBLE_EQ(l(0,1), 0.0);
+    EXPECT_DOUBLE_EQ(l(0,2), 0.0);
+    EXPECT_DOUBLE_EQ(l(1,2), 0.0);
+    EXPECT_TRUE(MatrixNear(l * MathUtils::transpose(l), spd, 1e-14));
+}
+
+// =================================================================================================
+TEST_F(CholeskyTest, DecomposeInPlace)
+{
+    Matrix<3,3> l;
+    ASSERT_TRUE(MathUtils::cholesky_decompose(spd, l));
+
+    Matrix<3,3> a(spd);
+    ASSERT_TRUE(MathUtils::cholesky_decompose(a, a));
+    EXPECT_TRUE(MatrixNear(a, l, 0.0));
+}
+
+// =================================================================================================
+TEST_F(CholeskyTest, NotPositiveDefinite)
+{
+    Matrix<3,3> l;
+
+    const Matrix<2,2> indefinite {{1.0, 2.0}, {2.0, 1.0}};
+    Matrix<2,2> l2;
+    EXPECT_FALSE(MathUtils::cholesky_decompose(indefinite, l2));
+
+    Matrix<3,3> singular(spd);
+    singular(2,2) = 0.0;
+    singular(2,0) = 0.0;
+    singular(2,1) = 0.0;
+    EXPECT_FALSE(MathUtils::cholesky_decompose(singular, l));
+
+    Matrix<3,3> nan_mat(spd);
+    nan_mat(1,1) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(MathUtils::cholesky_decompose(nan_mat, l));
+}
+
+// =================================================================================================
+TEST_F(CholeskyTest, Solve)
+{
+    Matrix<3,3> l;
+    ASSERT_TRUE(MathUtils::cholesky_decompose(spd, l));
+
+    const Vector<3> x_true {1.0, -2.0, 0.5};
+    const Vector<3> b = spd * x_true;
+
+    EXPECT_TRUE(VectorNear(MathUtils::cholesky_solve(l, b), x_true, 1e-14));
+    EXPECT_TRUE(VectorNear(l * MathUtils::forward_substitute(l, b), b, 1e-14));
+    EXPECT_TRUE(VectorNear(
+        MathUtils::transpose(l) * MathUtils::back_substitute_transposed(l, b), b, 1e-14
+    ));
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,113 @@
+/**
+ * @file elementwise_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/elementwise.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/Vector.h"
+#include "TestTools/MatrixNear.h"
+#include "TestTools/VectorNear.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+
+using MathUtils::Matrix;
+using MathUtils::TestTools::MatrixNear;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-elementwise.xml");
+
+class ElementwiseTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+
+    const Vector<4> vec1 {-1.0, 4.0, -9.0, 2.0};
+    const Vector<4> vec2 {3.0, -2.0, 1.0, 2.0};
+    const Matrix<2,2> mat1 {{-1.0, 4.0}, {-9.0, 2.0}};
+};
+
+// =================================================================================================
+TEST_F(ElementwiseTest, Abs)
+{
+    EXPECT_TRUE(VectorNear(MathUtils::elem_abs(vec1), Vector<4>{1, 4, 9, 2}));
+    EXPECT_TRUE(MatrixNear(MathUtils::elem_abs(mat1), Matrix<2,2>{{1, 4}, {9, 2}}));
+}
+
+// =================================================================================================
+TEST_F(ElementwiseTest, Sqrt)
+{
+    const Vector<4> res = MathUtils::elem_sqrt(MathUtils::elem_abs(vec1));
+
+    EXPECT_TRUE(VectorNear(res, Vector<4>{1.0, 2.0, 3.0, std::sqrt(2.0)}));
+}
+
+// =================================================================================================
+TEST_F(ElementwiseTest, MinMax)
+{
+    EXPECT_TRUE(VectorNear(MathUtils::elem_min(vec1, vec2), Vector<4>{-1, -2, -9, 2}));
+    EXPECT_TRUE(VectorNear(MathUtils::elem_max(vec1, vec2), Vector<4>{3, 4, 1, 2}));
+}
+
+// =================================================================================================
+TEST_F(ElementwiseTest, Clamp)
+{
+    EXPECT_TRUE(VectorNear(MathUtils::elem_clamp(vec1, -2.0, 3.0), Vector<4>{-1, 3, -2, 2}));
+    EXPECT_TRUE(MatrixNear(MathUtils::elem_clamp(mat1, 0.0, 1.0), Matrix<2,2>{{0, 1}, {0, 1}}));
+}
+
+// =================================================================================================
+TEST_F(ElementwiseTest, Lerp)
+{
+    EXPECT_TRUE(VectorNear(MathUtils::elem_lerp(vec1, vec2, 0.0), vec1));
+    EXPECT_TRUE(VectorNear(MathUtils::elem_lerp(vec1, vec2, 1.0), vec2));
+    EXPECT_TRUE(VectorNear(MathUtils::elem_lerp(vec1, vec2, 0.5), Vector<4>{1, 1, -4, 2}));
+}
+
+// =================================================================================================
+TEST_F(ElementwiseTest, FusedMultiplyAdd)
+{
+    EXPECT_TRUE(VectorNear(MathUtils::elem_fma(vec1, vec2, vec2), Vector<4>{0, -10, -8, 6}));
+}
+
+// =================================================================================================
+TEST_F(ElementwiseTest, Norms)
+{
+    EXPECT_DOUBLE_EQ(MathUtils::norm_l1(vec1), 16.0);
+    EXPECT_DOUBLE_EQ(MathUtils::norm_inf(vec1), 9.0);
+    EXPECT_DOUBLE_EQ(MathUtils::norm_frobenius(mat1), std::sqrt(102.0));
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(std::isnan(MathUtils::norm_inf(Vector<3>{1.0, nan, 5.0})));
+    EXPECT_TRUE(std::isnan(MathUtils::norm_inf(Vector<3>{5.0, nan, 1.0})));
+}
+
+// =================================================================================================
+TEST_F(ElementwiseTest, Argmax)
+{
+    EXPECT_EQ(MathUtils::argmax(vec1), 1);
+    EXPECT_EQ(MathUtils::argmax(vec2), 0);
+    EXPECT_EQ(MathUtils::argmax(Vector<3>{1, 5, 5}), 1);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,314 @@
+/**
+ * @file iterative_solvers_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/DynamicMatrix.h"
+#include "LinAlg/iterative_solvers.h"
+#include "LinAlg/SparseMatrix.h"
+#include "LinAlg/summation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MathUtils::ConjugateGradientWorkspace;
+using MathUtils::DynamicMatrix;
+using MathUtils::GmresWorkspace;
+using MathUtils::IdentityPreconditioner;
+using MathUtils::IterativeSolverOptions;
+using MathUtils::IterativeSolverResult;
+using MathUtils::IterativeSolverStatus;
+using MathUtils::JacobiPreconditioner;
+using MathUtils::SparseEntry;
+using MathUtils::SparseMatrix;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-iterative_solvers.xml");
+
+/**
+ * @brief Tridiagonal matrix with `lower`, `diag(i)`, `upper` on each row.
+ */
+SparseMatrix tridiagonal(const std::size_t len, const double lower, const double upper,
+    const std::vector<double>& diag)
+{
+    std::vector<SparseEntry> entries;
+
+    for (std::size_t ii = 0; ii < len; ii++)
+    {
+        entries.push_back({ii, ii, diag[ii]});
+
+        if (ii > 0)
+        {
+            entries.push_back({ii, ii - 1, lower});
+        }
+
+        if (ii + 1 < len)
+        {
+            entries.push_back({ii, ii + 1, upper});
+        }
+    }
+
+    return SparseMatrix(len, len, entries);
+}
+
+/**
+ * @brief Largest |x[i] - expected[i]|.
+ */
+double max_error(const std::vector<double>& x, const std::vector<double>& expected)
+{
+    double res = 0.0;
+
+    for (std::size_t idx = 0; idx < x.size(); idx++)
+    {
+        res = std::max(res, std::abs(x[idx] - expected[idx]));
+    }
+
+    return res;
+}
+
+class IterativeSolversTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        for (std::size_t idx = 0; idx < len; idx++)
+        {
+            x_true[idx] = std::sin(0.05 * static_cast<double>(idx)) + 1.0;
+        }
+    }
+
+    void TearDown() override
+    {}
+
+    static constexpr std::size_t len = 200;
+    std::vector<double> x_true = std::vector<double>(len);
+    std::vector<double> b = std::vector<double>(len);
+    std::vector<double> x = std::vector<double>(len, 0.0);
+};
+
+// =================================================================================================
+TEST_F(IterativeSolversTest, ConjugateGradient)
+{
+    // SPD with a varying diagonal so Jacobi helps
+    std::vector<double> diag(len);
+    for (std::size_t idx = 0; idx < len; idx++)
+    {
+        diag[idx] = 2.5 + static_cast<double>(idx % 7) * 10.0;
+    }
+
+    const SparseMatrix mat = tridiagonal(len, -1.0, -1.0, diag);
+    mat.multiply(x_true, b);
+
+    ConjugateGradientWorkspace ws;
+    const IterativeSolverResult plain = MathUtils::conjugate_gradient(mat, b, x,
+        IdentityPreconditioner(), ws);
+
+    EXPECT_EQ(plain.status, IterativeSolverStatus::Converged);
+    EXPECT_LE(plain.relative_residual, 1e-10);
+    EXPECT_LT(max_error(x, x_true), 1e-8);
+
+    std::fill(x.begin(), x.end(), 0.0);
+    const JacobiPreconditioner jacobi(mat.diagonal());
+    const IterativeSolverResult precond = MathUtils::conjugate_gradient(mat, b, x, jacobi, ws);
+
+    EXPECT_EQ(precond.status, IterativeSolverStatus::Converged);
+    EXPECT_LT(precond.iterations, plain.iterations);
+    EXPECT_LT(max_error(x, x_true), 1e-8);
+
+    // already solved
+    const IterativeSolverResult again = MathUtils::conjugate_gradient(mat, b, x, jacobi, ws);
+    EXPECT_EQ(again.status, IterativeSolverStatus::Converged);
+    EXPECT_EQ(again.iterations, 0);
+}
+
+// =================================================================================================
+TEST_F(IterativeSolversTest, GmresNonsymmetric)
+{
+    // convection-diffusion stencil
+    const SparseMatrix mat = tridiagonal(len, -1.6, -0.4, std::vector<double>(len, 2.5));
+    mat.multiply(x_true, b);
+
+    GmresWorkspace ws;
+    IterativeSolverOptions options;
+    options.restart = 20;
+
+    const IterativeSolverResult res = MathUtils::gmres(mat, b, x, IdentityPreconditioner(), ws,
+        options);
+
+    EXPECT_EQ(res.status, IterativeSolverStatus::Converged);
+    EXPECT_LE(res.relative_residual, 1e-10);
+    EXPECT_LT(max_error(x, x_true), 1e-8);
+
+    std::fill(x.begin(), x.end(), 0.0);
+    const IterativeSolverResult precond = MathUtils::gmres(mat, b, x,
+        JacobiPreconditioner(mat.diagonal()), ws, options);
+
+    EXPECT_EQ(precond.status, IterativeSolverStatus::Converged);
+    EXPECT_LT(max_error(x, x_true), 1e-8);
+}
+
+// =================================================================================================
+TEST_F(IterativeSolversTest, GmresDense)
+{
+    constexpr std::size_t num = 12;
+    DynamicMatrix mat(num, num);
+
+    for (std::size_t ii = 0; ii < num; ii++)
+    {
+        for (std::size_t jj = 0; jj < num; jj++)
+        {
+            mat(ii, jj) = 1.0 / static_cast<double>(ii + (2 * jj) + 1);
+        }
+
+        mat(ii, ii) += 3.0;
+    }
+
+    const std::vector<double> x_ref(x_true.begin(), x_true.begin() + num);
+    std::vector<double> rhs(num);
+    std::vector<double> sol(num, 0.0);
+    mat.multiply(x_ref, rhs);
+
+    // restart smaller than the system forces several cycles
+    GmresWorkspace ws;
+    IterativeSolverOptions options;
+    options.restart = 4;
+    options.tolerance = 1e-12;
+
+    const IterativeSolverResult res = MathUtils::gmres(mat, rhs, sol, IdentityPreconditioner(), ws,
+        options);
+
+    EXPECT_EQ(res.status, IterativeSolverStatus::Converged);
+    EXPECT_LT(max_error(sol, x_ref), 1e-10);
+}
+
+// =================================================================================================
+TEST_F(IterativeSolversTest, NotConverged)
+{
+    const SparseMatrix mat = tridiagonal(len, -1.0, -1.0, std::vector<double>(len, 2.0));
+    mat.multiply(x_true, b);
+
+    IterativeSolverOptions options;
+    options.max_iterations = 5;
+
+    ConjugateGradientWorkspace cg_ws;
+    const IterativeSolverResult cg = MathUtils::conjugate_gradient(mat, b, x,
+        IdentityPreconditioner(), cg_ws, options);
+    EXPECT_EQ(cg.status, IterativeSolverStatus::MaxIterations);
+    EXPECT_EQ(cg.iterations, 5);
+
+    std::fill(x.begin(), x.end(), 0.0);
+    GmresWorkspace gmres_ws;
+    const IterativeSolverResult gm = MathUtils::gmres(mat, b, x, IdentityPreconditioner(),
+        gmres_ws, options);
+    EXPECT_EQ(gm.status, IterativeSolverStatus::MaxIterations);
+    EXPECT_EQ(gm.iterations, 5);
+}
+
+// =================================================================================================
+TEST_F(IterativeSolversTest, ConjugateGradientBreakdown)
+{
+    ConjugateGradientWorkspace ws;
+
+    // negative definite, so the first direction already has p^T * A * p < 0
+    const SparseMatrix indefinite = tridiagonal(len, 0.0, 0.0, std::vector<double>(len, -1.0));
+    const IterativeSolverResult neg = MathUtils::conjugate_gradient(indefinite, x_true, x,
+        IdentityPreconditioner(), ws);
+
+    EXPECT_EQ(neg.status, IterativeSolverStatus::Breakdown);
+    EXPECT_EQ(neg.iterations, 1);
+    EXPECT_FALSE(std::isnan(neg.relative_residual));
+    EXPECT_DOUBLE_EQ(max_error(x, std::vector<double>(len, 0.0)), 0.0);
+
+    // singular: the right-hand side lies in the null space, so p^T * A * p = 0
+    const SparseMatrix singular(len, len, std::vector<SparseEntry>{});
+    const IterativeSolverResult zero = MathUtils::conjugate_gradient(singular, x_true, x,
+        IdentityPreconditioner(), ws);
+
+    EXPECT_EQ(zero.status, IterativeSolverStatus::Breakdown);
+
+    for (const double val : x)
+    {
+        EXPECT_TRUE(std::isfinite(val));
+    }
+}
+
+// =================================================================================================
+TEST_F(IterativeSolversTest, ZeroRightHandSide)
+{
+    const SparseMatrix mat = tridiagonal(len, -1.0, -1.0, std::vector<double>(len, 2.0));
+    const std::vector<double> zeros(len, 0.0);
+
+    GmresWorkspace ws;
+    const IterativeSolverResult res = MathUtils::gmres(mat, zeros, x, IdentityPreconditioner(), ws);
+
+    EXPECT_EQ(res.status, IterativeSolverStatus::Converged);
+    EXPECT_DOUBLE_EQ(max_error(x, zeros), 0.0);
+}
+
+// =================================================================================================
+TEST_F(IterativeSolversTest, InvalidSizes)
+{
+    const SparseMatrix rect(3, 4, std::vector<SparseEntry>{});
+    std::vector<double> short_x(3);
+    ConjugateGradientWorkspace ws;
+
+    EXPECT_THROW(MathUtils::conjugate_gradient(rect, short_x, short_x, IdentityPreconditioner(), ws),
+        std::length_error);
+
+    const SparseMatrix mat = tridiagonal(len, -1.0, -1.0, std::vector<double>(len, 2.0));
+    EXPECT_THROW(MathUtils::conjugate_gradient(mat, b, short_x, IdentityPreconditioner(), ws),
+        std::length_error);
+}
+
+// =================================================================================================
+TEST_F(IterativeSolversTest, LongVectorKernelsUseFixedChunks)
+{
+    const std::size_t long_len = MathUtils::Internal::SPAN_PARALLEL_MIN_LEN + 12345;
+    std::vector<double> a(long_len);
+    std::vector<double> c(long_len);
+
+    for (std::size_t idx = 0; idx < long_len; idx++)
+    {
+        a[idx] = std::sin(static_cast<double>(idx));
+        c[idx] = 1.0 / static_cast<double>(idx + 1);
+    }
+
+    // chunk sums combined pairwise in chunk order
+    const std::size_t chunk_len = MathUtils::Internal::SPAN_CHUNK_LEN;
+    std::vector<double> partials;
+
+    for (std::size_t first = 0; first < long_len; first += chunk_len)
+    {
+        const std::size_t last = std::min(first + chunk_len, long_len);
+        partials.push_back(MathUtils::pairwise_sum(first, last,
+            [&a, &c](const std::size_t idx){return a[idx] * c[idx];}));
+    }
+
+    EXPECT_EQ(MathUtils::Internal::span_dot(a, c), MathUtils::pairwise_sum(partials));
+
+    std::vector<double> y(c);
+    MathUtils::Internal::span_axpy(2.0, a, y);
+
+    for (std::size_t idx = 0; idx < long_len; idx += 997)
+    {
+        EXPECT_EQ(y[idx], c[idx] + (2.0 * a[idx]));
+    }
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
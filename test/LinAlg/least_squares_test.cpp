@@ -0,0 +1,230 @@
+/**
+ * @file least_squares_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/least_squares.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/Vector.h"
+#include "TestTools/VectorNear.h"
+
+#include <array>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MathUtils::LeastSquaresMethod;
+using MathUtils::LeastSquaresOptions;
+using MathUtils::LeastSquaresResult;
+using MathUtils::LeastSquaresStep;
+using MathUtils::LeastSquaresWorkspace;
+using MathUtils::Matrix;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-least_squares.xml");
+
+/**
+ * @brief Rosenbrock function as residuals, r = [10 * (y - x^2), 1 - x]. Minimum at (1, 1).
+ */
+void rosenbrock(const Vector<2>& x, Vector<2>& r, Matrix<2,2>& j)
+{
+    r(0) = 10.0 * (x(1) - (x(0) * x(0)));
+    r(1) = 1.0 - x(0);
+
+    j(0,0) = -20.0 * x(0);
+    j(0,1) = 10.0;
+    j(1,0) = -1.0;
+    j(1,1) = 0.0;
+}
+
+/**
+ * @brief Rosenbrock residuals with a third unknown they do not depend on, so J has a zero column.
+ */
+void rosenbrock_unobservable(const Vector<3>& x, Vector<3>& r, Matrix<3,3>& j)
+{
+    r(0) = 10.0 * (x(1) - (x(0) * x(0)));
+    r(1) = 1.0 - x(0);
+    r(2) = 0.0;
+
+    j.fill(0.0);
+    j(0,0) = -20.0 * x(0);
+    j(0,1) = 10.0;
+    j(1,0) = -1.0;
+}
+
+/**
+ * @brief Fit y = a * exp(b * t) to noiseless samples.
+ */
+class ExponentialFit {
+public:
+    static constexpr std::size_t num = 8;
+
+    ExponentialFit(const double a, const double b)
+    {
+        for (std::size_t idx = 0; idx < num; idx++)
+        {
+            m_t[idx] = 0.25 * static_cast<double>(idx);
+            m_y[idx] = a * std::exp(b * m_t[idx]);
+        }
+    }
+
+    void operator()(const Vector<2>& x, Vector<num>& r, Matrix<num,2>& j) const
+    {
+        for (std::size_t idx = 0; idx < num; idx++)
+        {
+            const double e = std::exp(x(1) * m_t[idx]);
+            r(idx) = (x(0) * e) - m_y[idx];
+            j(idx, 0) = e;
+            j(idx, 1) = x(0) * m_t[idx] * e;
+        }
+    }
+
+private:
+    std::array<double, num> m_t {};
+    std::array<double, num> m_y {};
+};
+
+// =================================================================================================
+TEST(LeastSquares, Rosenbrock)
+{
+    const Vector<2> x0 {-1.2, 1.0};
+    const Vector<2> expected {1.0, 1.0};
+
+    for (const auto step : {LeastSquaresStep::Cholesky, LeastSquaresStep::QR})
+    {
+        LeastSquaresOptions options;
+        options.step = step;
+        options.max_iterations = 200;
+
+        const LeastSquaresResult<2> res = MathUtils::least_squares<2,2>(rosenbrock, x0, options);
+
+        EXPECT_TRUE(res.converged);
+        EXPECT_TRUE(VectorNear(res.x, expected, 1e-8));
+        EXPECT_NEAR(res.cost, 0.0, 1e-16);
+    }
+}
+
+// =================================================================================================
+TEST(LeastSquares, GaussNewtonCurveFit)
+{
+    const ExponentialFit fit(2.0, -0.7);
+    const Vector<2> expected {2.0, -0.7};
+
+    LeastSquaresWorkspace<2, ExponentialFit::num> ws;
+
+    for (const auto step : {LeastSquaresStep::Cholesky, LeastSquaresStep::QR})
+    {
+        LeastSquaresOptions options;
+        options.method = LeastSquaresMethod::GaussNewton;
+        options.step = step;
+
+        const LeastSquaresResult<2> res = MathUtils::least_squares<2, ExponentialFit::num>(fit,
+            Vector<2>{1.5, -0.5}, ws, options);
+
+        EXPECT_TRUE(res.converged);
+        EXPECT_LT(res.iterations, 15);
+        EXPECT_TRUE(VectorNear(res.x, expected, 1e-10));
+    }
+}
+
+// =================================================================================================
+TEST(LeastSquares, LevenbergMarquardtFarStart)
+{
+    const ExponentialFit fit(2.0, -0.7);
+
+    const LeastSquaresResult<2> res = MathUtils::least_squares<2, ExponentialFit::num>(fit,
+        Vector<2>{10.0, 1.0});
+
+    EXPECT_TRUE(res.converged);
+    EXPECT_TRUE(VectorNear(res.x, Vector<2>{2.0, -0.7}, 1e-8));
+}
+
+// =================================================================================================
+TEST(LeastSquares, LevenbergMarquardtZeroJacobianColumn)
+{
+    const Vector<3> x0 {-1.2, 1.0, 0.5};
+
+    for (const auto step : {LeastSquaresStep::Cholesky, LeastSquaresStep::QR})
+    {
+        LeastSquaresOptions options;
+        options.step = step;
+        options.max_iterations = 200;
+
+        const LeastSquaresResult<3> res = MathUtils::least_squares<3,3>(rosenbrock_unobservable,
+            x0, options);
+
+        // the unobservable unknown gets zero gradient, so it stays put
+        EXPECT_TRUE(res.converged);
+        EXPECT_TRUE(VectorNear(res.x, Vector<3>{1.0, 1.0, 0.5}, 1e-8));
+    }
+}
+
+// =================================================================================================
+TEST(LeastSquares, MaxIterations)
+{
+    LeastSquaresOptions options;
+    options.max_iterations = 2;
+
+    const LeastSquaresResult<2> res = MathUtils::least_squares<2,2>(rosenbrock,
+        Vector<2>{-1.2, 1.0}, options);
+
+    EXPECT_FALSE(res.converged);
+    EXPECT_EQ(res.iterations, 2);
+}
+
+// =================================================================================================
+TEST(LeastSquares, Batch)
+{
+    const std::vector<ExponentialFit> fits {
+        ExponentialFit(2.0, -0.7),
+        ExponentialFit(0.5, 0.3),
+        ExponentialFit(-1.0, -0.1)
+    };
+    const std::vector<Vector<2>> x0(3, Vector<2>{1.0, 0.0});
+    std::vector<LeastSquaresResult<2>> results(3);
+
+    const auto problem = [&fits](const std::size_t idx, const Vector<2>& x,
+        Vector<ExponentialFit::num>& r, Matrix<ExponentialFit::num, 2>& j){fits[idx](x, r, j);};
+
+    MathUtils::least_squares_batch<2, ExponentialFit::num>(problem,
+        std::span<const Vector<2>>(x0), std::span<LeastSquaresResult<2>>(results));
+
+    EXPECT_TRUE(VectorNear(results[0].x, Vector<2>{2.0, -0.7}, 1e-8));
+    EXPECT_TRUE(VectorNear(results[1].x, Vector<2>{0.5, 0.3}, 1e-8));
+    EXPECT_TRUE(VectorNear(results[2].x, Vector<2>{-1.0, -0.1}, 1e-8));
+
+    // one problem per worker gives the same answers
+    std::vector<LeastSquaresResult<2>> threaded(3);
+    MathUtils::least_squares_batch<2, ExponentialFit::num>(problem,
+        std::span<const Vector<2>>(x0), std::span<LeastSquaresResult<2>>(threaded), {}, 3);
+
+    for (std::size_t idx = 0; idx < 3; idx++)
+    {
+        EXPECT_TRUE(VectorNear(threaded[idx].x, results[idx].x, 0.0));
+        EXPECT_EQ(threaded[idx].iterations, results[idx].iterations);
+    }
+
+    std::vector<LeastSquaresResult<2>> short_results(2);
+    EXPECT_THROW((MathUtils::least_squares_batch<2, ExponentialFit::num>(problem,
+        std::span<const Vector<2>>(x0), std::span<LeastSquaresResult<2>>(short_results))),
+        std::length_error);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,169 @@
+/**
+ * @file matrix_health_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/cholesky.h"
+#include "LinAlg/elementwise.h"
+#include "LinAlg/Matrix.h"
+#include "LinAlg/matrix_health.h"
+#include "LinAlg/Vector.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+
+using MathUtils::Matrix;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-matrix_health.xml");
+
+class MatrixHealthTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+
+    const Matrix<3,3> spd {
+        {4.0, 2.0, 0.4},
+        {2.0, 5.0, 1.0},
+        {0.4, 1.0, 3.0}
+    };
+
+    const Matrix<2,3> rect {{1.0, -2.0, 3.0}, {-4.0, 5.0, -6.0}};
+};
+
+/**
+ * @brief Exact ||A^-1||_1 by solving for every column of the inverse.
+ */
+template<std::size_t N>
+double exact_inverse_norm_1(const Matrix<N,N>& l)
+{
+    Matrix<N,N> inv;
+
+    for (std::size_t jj = 0; jj < N; jj++)
+    {
+        Vector<N> e_j;
+        e_j(jj) = 1.0;
+        const Vector<N> col = MathUtils::cholesky_solve(l, e_j);
+
+        for (std::size_t ii = 0; ii < N; ii++)
+        {
+            inv(ii, jj) = col(ii);
+        }
+    }
+
+    return MathUtils::norm_1(inv);
+}
+
+// =================================================================================================
+TEST_F(MatrixHealthTest, InducedNorms)
+{
+    EXPECT_DOUBLE_EQ(MathUtils::norm_1(rect), 9.0);
+    EXPECT_DOUBLE_EQ(MathUtils::norm_inf(rect), 15.0);
+    EXPECT_DOUBLE_EQ(MathUtils::norm_1(spd), 8.0);
+    EXPECT_DOUBLE_EQ(MathUtils::norm_inf(spd), 8.0);
+
+    // a NaN sum must survive the finite sums compared after it
+    Matrix<2,3> nan_rect(rect);
+    nan_rect(1,0) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(std::isnan(MathUtils::norm_1(nan_rect)));
+    EXPECT_TRUE(std::isnan(MathUtils::norm_inf(nan_rect)));
+
+    Matrix<2,3> nan_first(rect);
+    nan_first(0,0) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(std::isnan(MathUtils::norm_1(nan_first)));
+    EXPECT_TRUE(std::isnan(MathUtils::norm_inf(nan_first)));
+}
+
+// =================================================================================================
+TEST_F(MatrixHealthTest, Healthy)
+{
+    const MathUtils::MatrixHealth health = MathUtils::check_health(spd);
+
+    EXPECT_TRUE(health.all_finite);
+    EXPECT_TRUE(health.positive_diagonal);
+    EXPECT_DOUBLE_EQ(health.max_asymmetry, 0.0);
+    EXPECT_DOUBLE_EQ(health.norm_frobenius, MathUtils::norm_frobenius(spd));
+    EXPECT_DOUBLE_EQ(health.norm_1, MathUtils::norm_1(spd));
+    EXPECT_DOUBLE_EQ(health.norm_inf, MathUtils::norm_inf(spd));
+}
+
+// =================================================================================================
+TEST_F(MatrixHealthTest, Unhealthy)
+{
+    Matrix<3,3> asym(spd);
+    asym(0,2) = 0.7;
+    asym(1,1) = -1.0;
+
+    const MathUtils::MatrixHealth health = MathUtils::check_health(asym);
+    EXPECT_TRUE(health.all_finite);
+    EXPECT_FALSE(health.positive_diagonal);
+    EXPECT_NEAR(health.max_asymmetry, 0.3, 1e-15);
+
+    Matrix<3,3> nan_mat(spd);
+    nan_mat(2,1) = std::numeric_limits<double>::quiet_NaN();
+    const MathUtils::MatrixHealth nan_health = MathUtils::check_health(nan_mat);
+    EXPECT_FALSE(nan_health.all_finite);
+    EXPECT_TRUE(std::isnan(nan_health.max_asymmetry));
+    EXPECT_TRUE(std::isnan(nan_health.norm_1));
+    EXPECT_TRUE(std::isnan(nan_health.norm_inf));
+
+    Matrix<3,3> inf_mat(spd);
+    inf_mat(0,1) = -std::numeric_limits<double>::infinity();
+    EXPECT_FALSE(MathUtils::check_health(inf_mat).all_finite);
+}
+
+// =================================================================================================
+TEST_F(MatrixHealthTest, InverseNormEstimate)
+{
+    Matrix<3,3> l;
+    ASSERT_TRUE(MathUtils::cholesky_decompose(spd, l));
+
+    const double exact = exact_inverse_norm_1(l);
+    const double est = MathUtils::cholesky_inverse_norm_1_estimate(l);
+
+    EXPECT_LE(est, exact * (1.0 + 1e-12));
+    EXPECT_GE(est, exact / 3.0);
+    EXPECT_NEAR(est, exact, 1e-12);
+}
+
+// =================================================================================================
+TEST_F(MatrixHealthTest, ConditionEstimate)
+{
+    const Matrix<3,3> diag {
+        {4.0, 0.0, 0.0},
+        {0.0, 0.01, 0.0},
+        {0.0, 0.0, 1.0}
+    };
+
+    Matrix<3,3> l;
+    ASSERT_TRUE(MathUtils::cholesky_decompose(diag, l));
+    EXPECT_NEAR(MathUtils::cholesky_condition_estimate(l, MathUtils::norm_1(diag)), 400.0, 1e-9);
+
+    // nearly singular covariance
+    const Matrix<2,2> ill {{1.0, 1.0 - 1e-8}, {1.0 - 1e-8, 1.0}};
+    Matrix<2,2> l2;
+    ASSERT_TRUE(MathUtils::cholesky_decompose(ill, l2));
+
+    const double cond = MathUtils::cholesky_condition_estimate(l2, MathUtils::norm_1(ill));
+    EXPECT_NEAR(cond / 2e8, 1.0, 1e-6);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
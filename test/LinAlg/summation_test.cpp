@@ -0,0 +1,108 @@
+/**
+ * @file summation_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/Matrix.h"
+#include "LinAlg/summation.h"
+#include "LinAlg/Vector.h"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string>
+
+using MathUtils::compensated_sum;
+using MathUtils::dot;
+using MathUtils::Matrix;
+using MathUtils::pairwise_sum;
+using MathUtils::SummationMode;
+using MathUtils::trace;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-summation.xml");
+
+// =================================================================================================
+TEST(SummationTest, PairwiseSumMatchesLoopForSmallRanges)
+{
+    const std::array<double, 7> vals {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7};
+
+    double expected = 0.0;
+    for (const double val : vals)
+    {
+        expected += val;
+    }
+
+    EXPECT_EQ(pairwise_sum(vals), expected);
+}
+
+// =================================================================================================
+TEST(SummationTest, PairwiseSumOfIntegers)
+{
+    std::array<double, 1001> vals {};
+    for (std::size_t ii = 0; ii < vals.size(); ii++)
+    {
+        vals.at(ii) = static_cast<double>(ii);
+    }
+
+    EXPECT_DOUBLE_EQ(pairwise_sum(vals), 500500.0);
+}
+
+// =================================================================================================
+TEST(SummationTest, CompensatedSumRecoversLostBits)
+{
+    const std::array<double, 3> vals {1e16, 1.0, -1e16};
+
+    EXPECT_DOUBLE_EQ(compensated_sum(vals), 1.0);
+    EXPECT_DOUBLE_EQ(pairwise_sum(vals), 0.0);
+}
+
+// =================================================================================================
+TEST(SummationTest, VectorReductionsUseFixedTree)
+{
+    Vector<100> vec;
+    for (std::size_t ii = 0; ii < vec.size(); ii++)
+    {
+        vec(ii) = 1.0 / static_cast<double>(ii + 1);
+    }
+
+    const auto vals = std::span<const double>(vec.data(), vec.size());
+
+    EXPECT_EQ(vec.get_sum(), pairwise_sum(vals));
+    EXPECT_EQ(vec.get_sum(SummationMode::Compensated), compensated_sum(vals));
+    EXPECT_EQ(
+        dot(vec, vec),
+        pairwise_sum(0, vec.size(), [&vec](const std::size_t idx){return vec(idx) * vec(idx);})
+    );
+}
+
+// =================================================================================================
+TEST(SummationTest, CompensatedDotProduct)
+{
+    const Vector<4> v1 {1e16, 1.0, -1e16, 1.0};
+    const Vector<4> v2 {1.0, 1.0, 1.0, 1.0};
+
+    EXPECT_DOUBLE_EQ(dot(v1, v2, SummationMode::Compensated), 2.0);
+}
+
+// =================================================================================================
+TEST(SummationTest, CompensatedTrace)
+{
+    const Matrix<3,3> mat {{1e16, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, -1e16}};
+
+    EXPECT_DOUBLE_EQ(trace(mat, SummationMode::Compensated), 1.0);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,252 @@
+/**
+ * @file triangular_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "LinAlg/Matrix.h"
+#include "LinAlg/triangular.h"
+#include "LinAlg/Vector.h"
+#include "TestTools/MatrixNear.h"
+#include "TestTools/VectorNear.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+using MathUtils::LowerTriangular;
+using MathUtils::Matrix;
+using MathUtils::TestTools::MatrixNear;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::UpperTriangular;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LinAlg-triangular.xml");
+
+class TriangularTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+
+    const Matrix<4,4> full {
+        {2.0, 1.0, -3.0, 0.5},
+        {4.0, -1.5, 2.0, 1.0},
+        {-1.0, 0.25, 3.0, -2.0},
+        {0.5, 6.0, -0.75, 1.25}
+    };
+
+    const Matrix<4,4> lower_full {
+        {2.0, 0.0, 0.0, 0.0},
+        {4.0, -1.5, 0.0, 0.0},
+        {-1.0, 0.25, 3.0, 0.0},
+        {0.5, 6.0, -0.75, 1.25}
+    };
+
+    const Matrix<4,4> upper_full {
+        {2.0, 1.0, -3.0, 0.5},
+        {0.0, -1.5, 2.0, 1.0},
+        {0.0, 0.0, 3.0, -2.0},
+        {0.0, 0.0, 0.0, 1.25}
+    };
+
+    const Matrix<5,3> tall {
+        {1.0, 2.0, -1.0},
+        {0.5, -3.0, 4.0},
+        {-2.0, 1.0, 0.5},
+        {3.0, 0.25, -1.5},
+        {-1.0, -2.0, 2.0}
+    };
+
+    const Vector<4> vec {1.0, -2.0, 0.5, 3.0};
+};
+
+/**
+ * @brief Check that the strict lower triangle is zero and the diagonal is non-negative.
+ */
+template<std::size_t R, std::size_t C>
+void expect_upper_triangular(const Matrix<R,C>& mat)
+{
+    for (std::size_t ii = 0; ii < R; ii++)
+    {
+        for (std::size_t jj = 0; (jj < ii) && (jj < C); jj++)
+        {
+            EXPECT_DOUBLE_EQ(mat(ii, jj), 0.0);
+        }
+
+        if (ii < C)
+        {
+            EXPECT_GE(mat(ii, ii), 0.0);
+        }
+    }
+}
+
+// =================================================================================================
+TEST_F(TriangularTest, Packing)
+{
+    const LowerTriangular<4> lower(full);
+    const UpperTriangular<4> upper(full);
+
+    EXPECT_EQ(LowerTriangular<4>::num_stored, 10);
+    EXPECT_TRUE(MatrixNear(lower.to_matrix(), lower_full, 0.0));
+    EXPECT_TRUE(MatrixNear(upper.to_matrix(), upper_full, 0.0));
+
+    // rows are packed back-to-back
+    EXPECT_DOUBLE_EQ(lower.data()[3], -1.0);
+    EXPECT_DOUBLE_EQ(upper.data()[4], -1.5);
+    EXPECT_DOUBLE_EQ(upper.data()[9], 1.25);
+
+    for (std::size_t ii = 0; ii < 4; ii++)
+    {
+        for (std::size_t jj = 0; jj < 4; jj++)
+        {
+            EXPECT_DOUBLE_EQ(lower(ii, jj), lower_full(ii, jj));
+            EXPECT_DOUBLE_EQ(upper(ii, jj), upper_full(ii, jj));
+        }
+    }
+}
+
+// =================================================================================================
+TEST_F(TriangularTest, ElementAccess)
+{
+    LowerTriangular<4> lower;
+    lower.at(2, 1) = 7.0;
+
+    EXPECT_DOUBLE_EQ(lower(2, 1), 7.0);
+    EXPECT_DOUBLE_EQ(lower(1, 2), 0.0);
+    EXPECT_THROW(static_cast<void>(lower.at(1, 2)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(lower.at(4, 0)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(lower(0, 4)), std::out_of_range);
+
+    const UpperTriangular<4> upper;
+    EXPECT_THROW(static_cast<void>(upper.at(3, 0)), std::out_of_range);
+}
+
+// =================================================================================================
+TEST_F(TriangularTest, Transpose)
+{
+    const UpperTriangular<4> upper = MathUtils::transpose(LowerTriangular<4>(full));
+    EXPECT_TRUE(MatrixNear(upper.to_matrix(), MathUtils::transpose(lower_full), 0.0));
+
+    const LowerTriangular<4> lower = MathUtils::transpose(UpperTriangular<4>(full));
+    EXPECT_TRUE(MatrixNear(lower.to_matrix(), MathUtils::transpose(upper_full), 0.0));
+}
+
+// =================================================================================================
+TEST_F(TriangularTest, Multiply)
+{
+    const LowerTriangular<4> lower(full);
+    const UpperTriangular<4> upper(full);
+
+    EXPECT_TRUE(VectorNear(lower * vec, lower_full * vec, 1e-14));
+    EXPECT_TRUE(VectorNear(upper * vec, upper_full * vec, 1e-14));
+    EXPECT_TRUE(MatrixNear(lower * full, lower_full * full, 1e-13));
+    EXPECT_TRUE(MatrixNear(upper * full, upper_full * full, 1e-13));
+}
+
+// =================================================================================================
+TEST_F(TriangularTest, Solve)
+{
+    const LowerTriangular<4> lower(full);
+    const UpperTriangular<4> upper(full);
+
+    EXPECT_TRUE(VectorNear(lower_full * MathUtils::solve(lower, vec), vec, 1e-13));
+    EXPECT_TRUE(VectorNear(upper_full * MathUtils::solve(upper, vec), vec, 1e-13));
+    EXPECT_TRUE(VectorNear(
+        MathUtils::transpose(lower_full) * MathUtils::solve_transposed(lower, vec), vec, 1e-13
+    ));
+    EXPECT_TRUE(VectorNear(
+        MathUtils::transpose(upper_full) * MathUtils::solve_transposed(upper, vec), vec, 1e-13
+    ));
+}
+
+// =================================================================================================
+TEST_F(TriangularTest, QrTriangularizeTall)
+{
+    Matrix<5,3> r(tall);
+    MathUtils::qr_triangularize(r);
+
+    expect_upper_triangular(r);
+
+    const Matrix<3,3> ata = MathUtils::transpose(tall) * tall;
+    EXPECT_TRUE(MatrixNear(MathUtils::transpose(r) * r, ata, 1e-12));
+
+    const UpperTriangular<3> r_factor = MathUtils::qr_r_factor(tall);
+    EXPECT_TRUE(MatrixNear(MathUtils::transpose(r_factor.to_matrix()) * r_factor.to_matrix(), ata,
+        1e-12));
+}
+
+// =================================================================================================
+TEST_F(TriangularTest, QrTriangularizeSquare)
+{
+    Matrix<4,4> r(full);
+    MathUtils::qr_triangularize(r);
+
+    expect_upper_triangular(r);
+    EXPECT_TRUE(MatrixNear(MathUtils::transpose(r) * r, MathUtils::transpose(full) * full, 1e-12));
+}
+
+// =================================================================================================
+TEST_F(TriangularTest, QrUpdateRow)
+{
+    UpperTriangular<3> r = MathUtils::qr_r_factor(tall);
+    const Matrix<3,3> info = MathUtils::transpose(r.to_matrix()) * r.to_matrix();
+
+    const Vector<3> row {0.5, -1.0, 2.0};
+    MathUtils::qr_update(r, row);
+
+    Matrix<3,3> expected(info);
+    for (std::size_t ii = 0; ii < 3; ii++)
+    {
+        for (std::size_t jj = 0; jj < 3; jj++)
+        {
+            expected(ii, jj) += row(ii) * row(jj);
+        }
+    }
+
+    const Matrix<3,3> r_full = r.to_matrix();
+    expect_upper_triangular(r_full);
+    EXPECT_TRUE(MatrixNear(MathUtils::transpose(r_full) * r_full, expected, 1e-12));
+}
+
+// =================================================================================================
+TEST_F(TriangularTest, QrUpdateRows)
+{
+    // SRIF measurement update: stacking [R; H] and triangularizing must match row-by-row updates
+    const Matrix<2,3> h {{1.0, 0.0, -1.0}, {0.25, 2.0, 0.5}};
+    UpperTriangular<3> r = MathUtils::qr_r_factor(tall);
+
+    Matrix<5,3> stacked;
+    const Matrix<3,3> r_full = r.to_matrix();
+    for (std::size_t jj = 0; jj < 3; jj++)
+    {
+        for (std::size_t ii = 0; ii < 3; ii++)
+        {
+            stacked(ii, jj) = r_full(ii, jj);
+        }
+
+        for (std::size_t ii = 0; ii < 2; ii++)
+        {
+            stacked(3 + ii, jj) = h(ii, jj);
+        }
+    }
+
+    MathUtils::qr_update(r, h);
+    EXPECT_TRUE(MatrixNear(r.to_matrix(), MathUtils::qr_r_factor(stacked).to_matrix(), 1e-12));
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
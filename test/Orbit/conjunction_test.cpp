@@ -0,0 +1,212 @@
+/**
+ * @file conjunction_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "conversions.h"
+#include "LinAlg/Vector.h"
+#include "Orbit/conjunction.h"
+#include "Orbit/orbital_elements.h"
+#include "Orbit/propagate.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using MathUtils::Conjunction;
+using MathUtils::ConjunctionOptions;
+using MathUtils::Conversions::deg2rad;
+using MathUtils::elements_to_state;
+using MathUtils::OrbitalElements;
+using MathUtils::OrbitModel;
+using MathUtils::OrbitState;
+using MathUtils::propagate_elements;
+using MathUtils::screen_conjunctions;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-conjunction.xml");
+
+class ConjunctionTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        // crossing low orbits in a narrow altitude band, plus one far above that never screens
+        for (std::size_t idx = 0; idx < 24; idx++)
+        {
+            const auto k = static_cast<double>(idx);
+            m_catalog.push_back(OrbitalElements{
+                7'000e3 + (2e3 * static_cast<double>(idx % 3)), 0.001 * static_cast<double>(idx % 4),
+                deg2rad(std::fmod(23.0 * k, 180.0)), deg2rad(std::fmod(37.0 * k, 360.0)),
+                deg2rad(std::fmod(71.0 * k, 360.0)), deg2rad(std::fmod(53.0 * k, 360.0))
+            });
+        }
+
+        m_catalog.push_back(OrbitalElements{26'560e3, 0.01, deg2rad(55.0), 0.0, 0.0, 0.0});
+
+        m_options.threshold_m = 300e3;
+        m_options.step_s = 20.0;
+    }
+
+    void TearDown() override
+    {
+    }
+
+    [[nodiscard]] double distance(const std::size_t ii, const std::size_t jj, const double t_s) const
+    {
+        const OrbitState s1 = elements_to_state(propagate_elements(m_catalog[ii], t_s));
+        const OrbitState s2 = elements_to_state(propagate_elements(m_catalog[jj], t_s));
+        return (s2.position_m - s1.position_m).magnitude();
+    }
+
+    std::vector<OrbitalElements> m_catalog;
+    ConjunctionOptions m_options {};
+};
+
+// =================================================================================================
+TEST_F(ConjunctionTest, MatchesBruteForce)
+{
+    const double duration_s = 3'000.0;
+    const std::vector<Conjunction> found = screen_conjunctions(m_catalog, 0.0, duration_s,
+        m_options);
+
+    ASSERT_GT(found.size(), 0U);
+
+    for (std::size_t idx = 0; idx < found.size(); idx++)
+    {
+        const Conjunction& conj = found[idx];
+
+        EXPECT_LT(conj.primary, conj.secondary);
+        EXPECT_LT(conj.miss_distance_m, m_options.threshold_m);
+        EXPECT_NEAR(conj.miss_distance_m, distance(conj.primary, conj.secondary, conj.tca_s), 1e-6);
+        EXPECT_LT(conj.secondary, m_catalog.size() - 1);
+
+        // a true local minimum
+        EXPECT_GT(distance(conj.primary, conj.secondary, conj.tca_s - 0.1), conj.miss_distance_m);
+        EXPECT_GT(distance(conj.primary, conj.secondary, conj.tca_s + 0.1), conj.miss_distance_m);
+
+        if (idx > 0)
+        {
+            EXPECT_LE(found[idx - 1].tca_s, conj.tca_s);
+        }
+    }
+
+    // every sampled local minimum below the threshold was found
+    const double dt_s = 1.0;
+    const auto num_samples = static_cast<std::size_t>(duration_s / dt_s);
+    std::size_t brute_count = 0;
+
+    for (std::size_t ii = 0; ii < m_catalog.size(); ii++)
+    {
+        for (std::size_t jj = ii + 1; jj < m_catalog.size(); jj++)
+        {
+            for (std::size_t kk = 1; kk < num_samples; kk++)
+            {
+                const double t_s = static_cast<double>(kk) * dt_s;
+                const double dist = distance(ii, jj, t_s);
+
+                if ((dist >= m_options.threshold_m) || (dist > distance(ii, jj, t_s - dt_s)) ||
+                    (dist > distance(ii, jj, t_s + dt_s)))
+                {
+                    continue;
+                }
+
+                brute_count++;
+
+                bool matched = false;
+
+                for (const Conjunction& conj : found)
+                {
+                    matched = matched || ((conj.primary == ii) && (conj.secondary == jj) &&
+                        (std::abs(conj.tca_s - t_s) <= dt_s));
+                }
+
+                EXPECT_TRUE(matched) << ii << ", " << jj << " at " << t_s;
+            }
+        }
+    }
+
+    EXPECT_EQ(brute_count, found.size());
+}
+
+// =================================================================================================
+TEST_F(ConjunctionTest, SplitWindows)
+{
+    const std::vector<Conjunction> whole = screen_conjunctions(m_catalog, 0.0, 3'000.0, m_options);
+    const std::vector<Conjunction> first = screen_conjunctions(m_catalog, 0.0, 1'500.0, m_options);
+    const std::vector<Conjunction> second = screen_conjunctions(m_catalog, 1'500.0, 1'500.0,
+        m_options);
+
+    ASSERT_EQ(first.size() + second.size(), whole.size());
+
+    for (std::size_t idx = 0; idx < whole.size(); idx++)
+    {
+        const Conjunction& part = (idx < first.size()) ? first[idx] : second[idx - first.size()];
+
+        EXPECT_EQ(part.primary, whole[idx].primary);
+        EXPECT_EQ(part.secondary, whole[idx].secondary);
+        EXPECT_DOUBLE_EQ(part.tca_s, whole[idx].tca_s);
+        EXPECT_DOUBLE_EQ(part.miss_distance_m, whole[idx].miss_distance_m);
+    }
+}
+
+// =================================================================================================
+TEST_F(ConjunctionTest, ThreadedMatchesSingle)
+{
+    const std::vector<Conjunction> single = screen_conjunctions(m_catalog, 0.0, 3'000.0, m_options,
+        1);
+    const std::vector<Conjunction> threaded = screen_conjunctions(m_catalog, 0.0, 3'000.0,
+        m_options, 4);
+
+    ASSERT_FALSE(single.empty());
+    ASSERT_EQ(threaded.size(), single.size());
+
+    for (std::size_t idx = 0; idx < single.size(); idx++)
+    {
+        EXPECT_EQ(threaded[idx].primary, single[idx].primary);
+        EXPECT_EQ(threaded[idx].secondary, single[idx].secondary);
+        EXPECT_EQ(threaded[idx].tca_s, single[idx].tca_s);
+        EXPECT_EQ(threaded[idx].miss_distance_m, single[idx].miss_distance_m);
+    }
+}
+
+// =================================================================================================
+TEST_F(ConjunctionTest, KnownCrossing)
+{
+    // equatorial and polar circular orbits through the same node, 500 m apart in radius
+    const double a = 7'000e3;
+    const std::vector<OrbitalElements> catalog {
+        OrbitalElements{a, 0.0, 0.0, 0.0, 0.0, 0.0},
+        OrbitalElements{a + 500.0, 0.0, deg2rad(90.0), 0.0, 0.0, 0.0}
+    };
+
+    ConjunctionOptions options {};
+    options.threshold_m = 1e3;
+    options.model = OrbitModel::TwoBody;
+
+    const std::vector<Conjunction> found = screen_conjunctions(catalog, -30.0, 60.0, options);
+
+    ASSERT_EQ(found.size(), 1U);
+    EXPECT_NEAR(found[0].tca_s, 0.0, 1e-3);
+    EXPECT_NEAR(found[0].miss_distance_m, 500.0, 1e-3);
+    EXPECT_NEAR(found[0].relative_speed_mps, std::sqrt(2.0) * std::sqrt(3.986'004'418e14 / a), 2.0);
+
+    options.step_s = 0.0;
+    EXPECT_THROW(static_cast<void>(screen_conjunctions(catalog, 0.0, 60.0, options)),
+        std::invalid_argument);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
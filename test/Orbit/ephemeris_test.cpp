@@ -0,0 +1,167 @@
+/**
+ * @file ephemeris_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "constants.h"
+#include "conversions.h"
+#include "LinAlg/Vector.h"
+#include "Orbit/ephemeris.h"
+#include "TestTools/VectorNear.h"
+#include "Time/Epoch.h"
+#include "Time/time_scales.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MathUtils::Constants::ASTRONOMICAL_UNIT_M;
+using MathUtils::convert_time;
+using MathUtils::Conversions::rad2deg;
+using MathUtils::EphemerisBody;
+using MathUtils::EphemerisCache;
+using MathUtils::ephemeris_ecef;
+using MathUtils::ephemeris_eci;
+using MathUtils::Epoch;
+using MathUtils::greenwich_mean_sidereal_time;
+using MathUtils::moon_position_ecef;
+using MathUtils::moon_position_eci;
+using MathUtils::sun_position_ecef;
+using MathUtils::sun_position_eci;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::TimeScale;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-ephemeris.xml");
+
+// =================================================================================================
+TEST(EphemerisTest, ValladoSun)
+{
+    // Vallado, 4th ed., example 5-1
+    const Vector<3> sun = sun_position_eci(Epoch::from_calendar(2006, 4, 2));
+    const Vector<3> expected {0.977'194'5, 0.192'442'4, 0.083'430'8};
+
+    EXPECT_TRUE(VectorNear((1.0 / ASTRONOMICAL_UNIT_M) * sun, expected, 1e-5));
+}
+
+// =================================================================================================
+TEST(EphemerisTest, ValladoMoon)
+{
+    // Vallado, 4th ed., example 5-3
+    const Vector<3> moon = moon_position_eci(Epoch::from_calendar(1994, 4, 28));
+    const Vector<3> expected {-134'240.626e3, -311'571.590e3, -126'693.785e3};
+
+    EXPECT_TRUE(VectorNear(moon, expected, 50e3));
+}
+
+// =================================================================================================
+TEST(EphemerisTest, SiderealTime)
+{
+    // Vallado, 4th ed., example 3-5
+    const double gmst = greenwich_mean_sidereal_time(Epoch::from_calendar(1992, 8, 20, 12, 14));
+    EXPECT_NEAR(rad2deg(gmst), 152.578'787'886, 1e-4);
+
+    // one sidereal day later the angle repeats
+    const Epoch start = Epoch::from_calendar(2030, 3, 1, 5, 0, 0.0);
+    const double later = greenwich_mean_sidereal_time(start.plus_seconds(86'164.090'5));
+    EXPECT_NEAR(later, greenwich_mean_sidereal_time(start), 1e-6);
+}
+
+// =================================================================================================
+TEST(EphemerisTest, Ecef)
+{
+    const Epoch utc = Epoch::from_calendar(2024, 3, 20, 12, 0, 0.0);
+    const Vector<3> sun = sun_position_ecef(utc);
+
+    // near the March equinox at noon UTC the Sun is over the equator close to the prime meridian
+    const double lat = std::atan2(sun(2), std::hypot(sun(0), sun(1)));
+    const double lon = std::atan2(sun(1), sun(0));
+    EXPECT_NEAR(rad2deg(lat), 0.0, 0.3);
+    EXPECT_NEAR(rad2deg(lon), 0.0, 2.5);
+
+    // rotation keeps the range
+    const Epoch tt = convert_time(utc, TimeScale::UTC, TimeScale::TT);
+    EXPECT_NEAR(sun.magnitude(), sun_position_eci(tt).magnitude(), 1e-3);
+    EXPECT_NEAR(moon_position_ecef(utc).magnitude(), moon_position_eci(tt).magnitude(), 1e-6);
+}
+
+// =================================================================================================
+TEST(EphemerisTest, Batch)
+{
+    std::vector<Epoch> utc;
+
+    for (std::size_t idx = 0; idx < 48; idx++)
+    {
+        utc.push_back(Epoch::from_calendar(2016, 12, 31, 0, 0, 0.0).plus_seconds(
+            1'800.0 * static_cast<double>(idx)));
+    }
+
+    std::vector<Vector<3>> sun(utc.size());
+    std::vector<Vector<3>> moon(utc.size());
+    ephemeris_ecef(EphemerisBody::Sun, utc, sun);
+    ephemeris_ecef(EphemerisBody::Moon, utc, moon);
+
+    std::vector<Epoch> tt(utc.size());
+    convert_time(utc, tt, TimeScale::UTC, TimeScale::TT);
+
+    std::vector<Vector<3>> sun_eci(utc.size());
+    ephemeris_eci(EphemerisBody::Sun, tt, sun_eci);
+
+    for (std::size_t idx = 0; idx < utc.size(); idx++)
+    {
+        EXPECT_TRUE(VectorNear(sun[idx], sun_position_ecef(utc[idx]), 1e-3));
+        EXPECT_TRUE(VectorNear(moon[idx], moon_position_ecef(utc[idx]), 1e-6));
+        EXPECT_TRUE(VectorNear(sun_eci[idx], sun_position_eci(tt[idx]), 1e-3));
+    }
+
+    std::vector<Vector<3>> too_few(utc.size() - 1);
+    EXPECT_THROW(ephemeris_ecef(EphemerisBody::Sun, utc, too_few), std::length_error);
+    EXPECT_THROW(ephemeris_eci(EphemerisBody::Moon, tt, too_few), std::length_error);
+}
+
+// =================================================================================================
+TEST(EphemerisTest, Cache)
+{
+    const Epoch t0 = Epoch::from_calendar(2026, 10, 18, 6, 0, 0.0);
+    EphemerisCache cache;
+
+    const Vector<3> sun = cache.sun_eci(t0);
+    EXPECT_TRUE(VectorNear(sun, sun_position_eci(t0), 1e-3));
+
+    // repeated and interleaved queries at the same epoch reuse results
+    static_cast<void>(cache.moon_eci(t0));
+    static_cast<void>(cache.sun_eci(t0));
+    static_cast<void>(cache.moon_eci(t0));
+    EXPECT_EQ(cache.num_evaluations(), 2U);
+
+    static_cast<void>(cache.sun_eci(t0.plus_seconds(1e-3)));
+    EXPECT_EQ(cache.num_evaluations(), 3U);
+
+    static_cast<void>(cache.sun_ecef(t0));
+    static_cast<void>(cache.sun_ecef(t0));
+    EXPECT_EQ(cache.num_evaluations(), 4U);
+    EXPECT_TRUE(VectorNear(cache.moon_ecef(t0), moon_position_ecef(t0), 1e-6));
+
+    // a tolerance absorbs sub-step jitter
+    EphemerisCache loose(0.01);
+    static_cast<void>(loose.sun_eci(t0));
+    static_cast<void>(loose.sun_eci(t0.plus_seconds(1e-3)));
+    EXPECT_EQ(loose.num_evaluations(), 1U);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,159 @@
+/**
+ * @file orbital_elements_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "constants.h"
+#include "conversions.h"
+#include "LinAlg/Vector.h"
+#include "Orbit/orbital_elements.h"
+#include "TestTools/VectorNear.h"
+#include "wrap_pi.h"
+
+#include <array>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using MathUtils::Constants::PI;
+using MathUtils::Conversions::deg2rad;
+using MathUtils::elements_to_state;
+using MathUtils::OrbitalElements;
+using MathUtils::OrbitState;
+using MathUtils::solve_kepler;
+using MathUtils::state_to_elements;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::Vector;
+using MathUtils::wrap_pi;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-orbital_elements.xml");
+
+// =================================================================================================
+TEST(OrbitalElementsTest, KeplerFixedIterations)
+{
+    double worst = 0.0;
+
+    for (std::size_t ie = 0; ie <= 99; ie++)
+    {
+        const double ecc = 0.01 * static_cast<double>(ie);
+
+        for (int im = -500; im <= 500; im++)
+        {
+            const double mean_anom = PI * static_cast<double>(im) / 500.0;
+            const double ecc_anom = solve_kepler(mean_anom, ecc);
+            worst = std::fmax(worst,
+                std::abs(wrap_pi(ecc_anom - (ecc * std::sin(ecc_anom)) - mean_anom)));
+        }
+    }
+
+    EXPECT_LT(worst, 1e-13);
+
+    // mean anomaly outside [-pi, pi] solves the wrapped equation
+    const double ecc_anom = solve_kepler(7.0, 0.3);
+    EXPECT_NEAR(ecc_anom - (0.3 * std::sin(ecc_anom)), wrap_pi(7.0), 1e-14);
+}
+
+// =================================================================================================
+TEST(OrbitalElementsTest, KeplerBatchMatchesScalar)
+{
+    const std::array<double, 5> mean_anom {-3.0, -0.2, 0.0, 1.0, 9.0};
+    const std::array<double, 5> ecc {0.9, 0.0, 0.5, 0.01, 0.7};
+    std::array<double, 5> ecc_anom {};
+
+    solve_kepler(mean_anom, ecc, ecc_anom);
+
+    for (std::size_t idx = 0; idx < ecc_anom.size(); idx++)
+    {
+        EXPECT_DOUBLE_EQ(ecc_anom[idx], solve_kepler(mean_anom[idx], ecc[idx]));
+    }
+
+    std::array<double, 4> too_few {};
+    EXPECT_THROW(solve_kepler(mean_anom, ecc, too_few), std::length_error);
+}
+
+// =================================================================================================
+TEST(OrbitalElementsTest, ValladoExample2_5)
+{
+    // Vallado, 4th ed., example 2-5, converted to meters; tolerances follow the printed digits
+    const OrbitState state {
+        Vector<3>{6524.834e3, 6862.875e3, 6448.296e3},
+        Vector<3>{4.901'327e3, 5.533'756e3, -1.976'341e3}
+    };
+
+    const OrbitalElements elements = state_to_elements(state, 398'600.4418e9);
+
+    EXPECT_NEAR(elements.semi_major_axis_m, 36'127.343e3, 10.0);
+    EXPECT_NEAR(elements.eccentricity, 0.832'853, 1e-6);
+    EXPECT_NEAR(elements.inclination_rad, deg2rad(87.870), 2e-5);
+    EXPECT_NEAR(elements.raan_rad, deg2rad(227.89), 2e-4);
+    EXPECT_NEAR(elements.arg_perigee_rad, deg2rad(53.38), 2e-4);
+}
+
+// =================================================================================================
+TEST(OrbitalElementsTest, RoundTrip)
+{
+    const std::vector<OrbitalElements> cases {
+        OrbitalElements{7'000e3, 0.001, deg2rad(51.6), deg2rad(30.0), deg2rad(90.0), deg2rad(10.0)},
+        OrbitalElements{26'560e3, 0.02, deg2rad(55.0), deg2rad(300.0), deg2rad(200.0), deg2rad(350.0)},
+        OrbitalElements{24'400e3, 0.73, deg2rad(63.4), deg2rad(120.0), deg2rad(270.0), deg2rad(180.0)},
+        OrbitalElements{42'164e3, 0.3, deg2rad(170.0), deg2rad(5.0), deg2rad(45.0), deg2rad(1.0)}
+    };
+
+    for (const OrbitalElements& in : cases)
+    {
+        const OrbitState state = elements_to_state(in);
+        const OrbitalElements out = state_to_elements(state);
+
+        EXPECT_NEAR(out.semi_major_axis_m, in.semi_major_axis_m, 1e-6 * in.semi_major_axis_m);
+        EXPECT_NEAR(out.eccentricity, in.eccentricity, 1e-10);
+        EXPECT_NEAR(out.inclination_rad, in.inclination_rad, 1e-10);
+        EXPECT_NEAR(out.raan_rad, in.raan_rad, 1e-10);
+        EXPECT_NEAR(out.arg_perigee_rad, in.arg_perigee_rad, 1e-7);
+        EXPECT_NEAR(wrap_pi(out.mean_anomaly_rad - in.mean_anomaly_rad), 0.0, 1e-7);
+
+        // back to the same state
+        const OrbitState again = elements_to_state(out);
+        EXPECT_TRUE(VectorNear(again.position_m, state.position_m, 1e-5));
+        EXPECT_TRUE(VectorNear(again.velocity_mps, state.velocity_mps, 1e-8));
+    }
+}
+
+// =================================================================================================
+TEST(OrbitalElementsTest, CircularEquatorial)
+{
+    const double a = 42'164e3;
+    const double speed = std::sqrt(MathUtils::Constants::WGS84_GM_M3PS2 / a);
+    const double lon = deg2rad(75.0);
+
+    const OrbitState state {
+        Vector<3>{a * std::cos(lon), a * std::sin(lon), 0.0},
+        Vector<3>{-speed * std::sin(lon), speed * std::cos(lon), 0.0}
+    };
+
+    const OrbitalElements elements = state_to_elements(state);
+
+    EXPECT_NEAR(elements.eccentricity, 0.0, 1e-12);
+    EXPECT_NEAR(elements.inclination_rad, 0.0, 1e-12);
+    EXPECT_NEAR(elements.raan_rad, 0.0, 1e-12);
+    EXPECT_NEAR(elements.arg_perigee_rad, 0.0, 1e-12);
+    EXPECT_NEAR(elements.mean_anomaly_rad, lon, 1e-12);
+
+    const OrbitState escape {state.position_m, 1.5 * state.velocity_mps};
+    EXPECT_THROW(static_cast<void>(state_to_elements(escape)), std::invalid_argument);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
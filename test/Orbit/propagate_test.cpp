@@ -0,0 +1,149 @@
+/**
+ * @file propagate_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "constants.h"
+#include "conversions.h"
+#include "LinAlg/Vector.h"
+#include "Orbit/orbital_elements.h"
+#include "Orbit/propagate.h"
+#include "TestTools/VectorNear.h"
+
+#include <array>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using MathUtils::Constants::WGS84_GM_M3PS2;
+using MathUtils::Conversions::deg2rad;
+using MathUtils::cross;
+using MathUtils::dot;
+using MathUtils::elements_to_state;
+using MathUtils::OrbitalElements;
+using MathUtils::OrbitModel;
+using MathUtils::OrbitState;
+using MathUtils::propagate_constellation;
+using MathUtils::propagate_elements;
+using MathUtils::propagate_kepler;
+using MathUtils::TestTools::VectorNear;
+using MathUtils::Vector;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-propagate.xml");
+
+// =================================================================================================
+TEST(PropagateTest, UniversalMatchesElements)
+{
+    const OrbitalElements elements {
+        24'400e3, 0.73, deg2rad(63.4), deg2rad(120.0), deg2rad(270.0), deg2rad(20.0)
+    };
+    const OrbitState state0 = elements_to_state(elements);
+
+    for (const double dt_s : {0.0, 60.0, 3'600.0, 25'000.0, -7'200.0, 250'000.0})
+    {
+        const OrbitState universal = propagate_kepler(state0, dt_s);
+        const OrbitState expected = elements_to_state(
+            propagate_elements(elements, dt_s, OrbitModel::TwoBody));
+
+        EXPECT_TRUE(VectorNear(universal.position_m, expected.position_m, 1e-3)) << dt_s;
+        EXPECT_TRUE(VectorNear(universal.velocity_mps, expected.velocity_mps, 1e-6)) << dt_s;
+    }
+}
+
+// =================================================================================================
+TEST(PropagateTest, UniversalHyperbolic)
+{
+    const OrbitState state0 {Vector<3>{7'000e3, 0.0, 0.0}, Vector<3>{0.0, 12e3, 1e3}};
+
+    const double energy0 = (0.5 * dot(state0.velocity_mps, state0.velocity_mps)) -
+        (WGS84_GM_M3PS2 / state0.position_m.magnitude());
+    const Vector<3> h0 = cross(state0.position_m, state0.velocity_mps);
+
+    const OrbitState state1 = propagate_kepler(state0, 5'000.0);
+
+    const double energy1 = (0.5 * dot(state1.velocity_mps, state1.velocity_mps)) -
+        (WGS84_GM_M3PS2 / state1.position_m.magnitude());
+    const Vector<3> h1 = cross(state1.position_m, state1.velocity_mps);
+
+    EXPECT_GT(state1.position_m.magnitude(), 35'000e3);
+    EXPECT_NEAR(energy1, energy0, 1e-9 * std::abs(energy0));
+    EXPECT_TRUE(VectorNear(h1, h0, 1e-6 * h0.magnitude()));
+
+    // and back again
+    const OrbitState back = propagate_kepler(state1, -5'000.0);
+    EXPECT_TRUE(VectorNear(back.position_m, state0.position_m, 1e-3));
+    EXPECT_TRUE(VectorNear(back.velocity_mps, state0.velocity_mps, 1e-6));
+}
+
+// =================================================================================================
+TEST(PropagateTest, J2SunSynchronous)
+{
+    // 700 km sun-synchronous orbit precesses the node about 0.9856 deg/day
+    const OrbitalElements elements {
+        MathUtils::Constants::WGS84_A_M + 700e3, 0.001, deg2rad(98.19), 0.0, deg2rad(90.0), 0.0
+    };
+
+    const OrbitalElements day = propagate_elements(elements, 86'400.0);
+    EXPECT_NEAR(day.raan_rad, deg2rad(0.9856), deg2rad(0.01));
+
+    const OrbitalElements two_body = propagate_elements(elements, 86'400.0, OrbitModel::TwoBody);
+    EXPECT_DOUBLE_EQ(two_body.raan_rad, 0.0);
+    EXPECT_DOUBLE_EQ(two_body.arg_perigee_rad, elements.arg_perigee_rad);
+    EXPECT_DOUBLE_EQ(two_body.semi_major_axis_m, elements.semi_major_axis_m);
+}
+
+// =================================================================================================
+TEST(PropagateTest, Constellation)
+{
+    std::vector<OrbitalElements> elements;
+
+    for (std::size_t plane = 0; plane < 6; plane++)
+    {
+        for (std::size_t slot = 0; slot < 11; slot++)
+        {
+            elements.push_back(OrbitalElements{
+                7'158e3, 0.0002, deg2rad(86.4), deg2rad(30.0 * static_cast<double>(plane)), 0.0,
+                deg2rad(32.7 * static_cast<double>(slot))
+            });
+        }
+    }
+
+    std::vector<OrbitState> states(elements.size());
+    propagate_constellation(elements, 1'234.5, states);
+
+    for (std::size_t idx = 0; idx < elements.size(); idx++)
+    {
+        const OrbitState expected = elements_to_state(propagate_elements(elements[idx], 1'234.5));
+        EXPECT_TRUE(VectorNear(states[idx].position_m, expected.position_m, 1e-9));
+        EXPECT_TRUE(VectorNear(states[idx].velocity_mps, expected.velocity_mps, 1e-12));
+    }
+
+    std::vector<OrbitState> threaded(elements.size());
+    propagate_constellation(elements, 1'234.5, threaded, OrbitModel::J2Secular,
+        MathUtils::Constants::WGS84_GM_M3PS2, 3);
+
+    for (std::size_t idx = 0; idx < elements.size(); idx++)
+    {
+        EXPECT_TRUE(VectorNear(threaded[idx].position_m, states[idx].position_m, 0.0));
+        EXPECT_TRUE(VectorNear(threaded[idx].velocity_mps, states[idx].velocity_mps, 0.0));
+    }
+
+    std::vector<OrbitState> too_few(elements.size() - 1);
+    EXPECT_THROW(propagate_constellation(elements, 0.0, too_few), std::length_error);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
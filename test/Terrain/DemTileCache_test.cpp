@@ -0,0 +1,217 @@
+/**
+ * @file DemTileCache_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "conversions.h"
+#include "Geodesy/GeoCoord.h"
+#include "Terrain/DemTile.h"
+#include "Terrain/DemTileCache.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using MathUtils::Conversions::deg2rad;
+using MathUtils::DemTileCache;
+using MathUtils::DemTileKey;
+using MathUtils::GeoCoord;
+using MathUtils::hgt_file_name;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-Terrain-DemTileCache.xml");
+
+constexpr std::size_t SAMPLES = 5;
+
+/**
+ * @brief Height plane used for every tile, exact under bilinear interpolation.
+ */
+double plane_height(const double lat_deg, const double lon_deg)
+{
+    return (100.0 * lat_deg) + (40.0 * lon_deg);
+}
+
+class DemTileCacheTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        m_dir = std::filesystem::temp_directory_path() / "mathutils_DemTileCache_test";
+        std::filesystem::create_directories(m_dir);
+
+        for (const DemTileKey key : {DemTileKey {40, -105}, DemTileKey {40, -104},
+            DemTileKey {41, -105}})
+        {
+            write_tile(key);
+        }
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_dir);
+    }
+
+    /**
+     * @brief Write a tile sampled from plane_height().
+     */
+    void write_tile(const DemTileKey& key) const
+    {
+        std::ofstream out(m_dir / hgt_file_name(key), std::ios::binary);
+        const double spacing = 1.0 / static_cast<double>(SAMPLES - 1);
+
+        for (std::size_t row = 0; row < SAMPLES; row++)
+        {
+            for (std::size_t col = 0; col < SAMPLES; col++)
+            {
+                const double lat = static_cast<double>(key.south_deg + 1) -
+                    (static_cast<double>(row) * spacing);
+                const double lon = static_cast<double>(key.west_deg) +
+                    (static_cast<double>(col) * spacing);
+                const auto raw = static_cast<std::uint16_t>(
+                    static_cast<std::int16_t>(std::lround(plane_height(lat, lon)))
+                );
+
+                out.put(static_cast<char>(raw >> 8));
+                out.put(static_cast<char>(raw & 0xFF));
+            }
+        }
+    }
+
+    std::filesystem::path m_dir;
+};
+
+// =================================================================================================
+TEST_F(DemTileCacheTest, Height)
+{
+    const DemTileCache cache(m_dir, 4);
+
+    EXPECT_NEAR(cache.height(GeoCoord(deg2rad(40.3), deg2rad(-104.6), 0.0)),
+        plane_height(40.3, -104.6), 1e-6);
+    EXPECT_NEAR(cache.height(GeoCoord(deg2rad(41.9), deg2rad(-104.1), 0.0)),
+        plane_height(41.9, -104.1), 1e-6);
+
+    // no file for this tile
+    EXPECT_TRUE(std::isnan(cache.height(GeoCoord(deg2rad(0.5), deg2rad(0.5), 0.0))));
+    EXPECT_EQ(cache.num_cached(), 3U);
+}
+
+// =================================================================================================
+TEST_F(DemTileCacheTest, EvictsLeastRecentlyUsed)
+{
+    const DemTileCache cache(m_dir, 2);
+
+    const auto first = cache.tile(DemTileKey {40, -105});
+    static_cast<void>(cache.tile(DemTileKey {40, -104}));
+    static_cast<void>(cache.tile(DemTileKey {40, -105}));
+    static_cast<void>(cache.tile(DemTileKey {41, -105}));
+
+    EXPECT_EQ(cache.num_cached(), 2U);
+
+    // {40, -105} was touched most recently before the insert, so it is still cached
+    EXPECT_EQ(cache.tile(DemTileKey {40, -105}), first);
+
+    // evicted tiles stay valid for readers holding them
+    EXPECT_EQ(first->key().west_deg, -105);
+
+    EXPECT_THROW(DemTileCache(m_dir, 0), std::invalid_argument);
+}
+
+// =================================================================================================
+TEST_F(DemTileCacheTest, BatchMatchesSingle)
+{
+    const DemTileCache cache(m_dir, 1);
+
+    const std::array<GeoCoord, 6> pos {
+        GeoCoord(deg2rad(40.1), deg2rad(-104.5), 0.0),
+        GeoCoord(deg2rad(41.2), deg2rad(-104.9), 0.0),
+        GeoCoord(deg2rad(40.7), deg2rad(-103.2), 0.0),
+        GeoCoord(deg2rad(40.2), deg2rad(-104.1), 0.0),
+        GeoCoord(deg2rad(10.0), deg2rad(10.0), 0.0),
+        GeoCoord(deg2rad(41.6), deg2rad(-104.3), 0.0)
+    };
+
+    std::array<double, pos.size()> heights {};
+    cache.heights(pos, heights);
+
+    for (std::size_t idx = 0; idx < pos.size(); idx++)
+    {
+        const double expected = cache.height(pos[idx]);
+
+        if (std::isnan(expected))
+        {
+            EXPECT_TRUE(std::isnan(heights[idx]));
+        }
+        else
+        {
+            EXPECT_NEAR(heights[idx], expected, 1e-12);
+        }
+    }
+
+    EXPECT_NEAR(heights[2], plane_height(40.7, -103.2), 1e-6);
+    EXPECT_TRUE(std::isnan(heights[4]));
+
+    std::array<double, pos.size() - 1> too_few {};
+    EXPECT_THROW(cache.heights(pos, too_few), std::length_error);
+}
+
+// =================================================================================================
+TEST_F(DemTileCacheTest, ConcurrentReaders)
+{
+    const DemTileCache cache(m_dir, 2);
+
+    constexpr std::size_t num_threads = 4;
+    constexpr std::size_t num_queries = 500;
+    std::array<std::size_t, num_threads> errors {};
+    std::vector<std::thread> threads;
+
+    for (std::size_t tt = 0; tt < num_threads; tt++)
+    {
+        threads.emplace_back([&cache, &errors, tt]() {
+            for (std::size_t qq = 0; qq < num_queries; qq++)
+            {
+                const double frac = (static_cast<double>(qq % 97) + 0.5) / 98.0;
+                const double lat = 40.0 + frac + static_cast<double>((qq + tt) % 2);
+                const double lon = -105.0 + frac + static_cast<double>((qq / 2 + tt) % 2);
+                const double height = cache.height(GeoCoord(deg2rad(lat), deg2rad(lon), 0.0));
+
+                // tile {41, -104} has no file
+                const bool missing = (lat >= 41.0) && (lon >= -104.0);
+                const bool ok = missing ? std::isnan(height) :
+                    (std::abs(height - plane_height(lat, lon)) < 1e-6);
+
+                errors[tt] += ok ? 0 : 1;
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const std::size_t count : errors)
+    {
+        EXPECT_EQ(count, 0U);
+    }
+
+    EXPECT_LE(cache.num_cached(), 2U);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
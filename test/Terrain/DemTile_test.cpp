@@ -0,0 +1,145 @@
+/**
+ * @file DemTile_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "conversions.h"
+#include "Geodesy/GeoCoord.h"
+#include "Terrain/DemTile.h"
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MathUtils::Conversions::deg2rad;
+using MathUtils::dem_tile_key;
+using MathUtils::DemTile;
+using MathUtils::DemTileKey;
+using MathUtils::GeoCoord;
+using MathUtils::hgt_file_name;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-Terrain-DemTile.xml");
+
+/**
+ * @brief Write big-endian int16 samples to a file.
+ */
+void write_hgt(const std::filesystem::path& path, const std::vector<std::int16_t>& samples)
+{
+    std::ofstream out(path, std::ios::binary);
+
+    for (const std::int16_t value : samples)
+    {
+        const auto raw = static_cast<std::uint16_t>(value);
+        out.put(static_cast<char>(raw >> 8));
+        out.put(static_cast<char>(raw & 0xFF));
+    }
+}
+
+// =================================================================================================
+TEST(DemTileTest, TileKey)
+{
+    const DemTileKey key1 = dem_tile_key(GeoCoord(deg2rad(40.5), deg2rad(-104.2), 0.0));
+    EXPECT_EQ(key1.south_deg, 40);
+    EXPECT_EQ(key1.west_deg, -105);
+
+    const DemTileKey key2 = dem_tile_key(GeoCoord(deg2rad(-0.5), deg2rad(180.0), 0.0));
+    EXPECT_EQ(key2.south_deg, -1);
+    EXPECT_EQ(key2.west_deg, -180);
+
+    const DemTileKey key3 = dem_tile_key(GeoCoord(deg2rad(90.0), deg2rad(0.0), 0.0));
+    EXPECT_EQ(key3.south_deg, 89);
+    EXPECT_EQ(key3.west_deg, 0);
+
+    EXPECT_NE(key1.index(), key2.index());
+}
+
+// =================================================================================================
+TEST(DemTileTest, FileName)
+{
+    EXPECT_EQ(hgt_file_name(DemTileKey {40, -105}), "N40W105.hgt");
+    EXPECT_EQ(hgt_file_name(DemTileKey {-1, 7}), "S01E007.hgt");
+}
+
+// =================================================================================================
+TEST(DemTileTest, BilinearHeight)
+{
+    // 3x3 tile: north row 10 20 30, middle 40 50 60, south 70 80 90
+    const DemTile tile(DemTileKey {10, 20}, 3, {10.0F, 20.0F, 30.0F, 40.0F, 50.0F, 60.0F, 70.0F,
+        80.0F, 90.0F});
+
+    EXPECT_NEAR(tile.height(deg2rad(11.0), deg2rad(20.0)), 10.0, 1e-9);
+    EXPECT_NEAR(tile.height(deg2rad(10.0), deg2rad(21.0)), 90.0, 1e-9);
+    EXPECT_NEAR(tile.height(deg2rad(10.5), deg2rad(20.5)), 50.0, 1e-9);
+    EXPECT_NEAR(tile.height(deg2rad(10.75), deg2rad(20.25)), 30.0, 1e-9);
+    EXPECT_TRUE(std::isnan(tile.height(deg2rad(12.0), deg2rad(20.5))));
+
+    EXPECT_FLOAT_EQ(tile.sample(1, 2), 60.0F);
+    EXPECT_THROW(static_cast<void>(tile.sample(3, 0)), std::out_of_range);
+}
+
+// =================================================================================================
+TEST(DemTileTest, InvalidSize)
+{
+    EXPECT_THROW(DemTile(DemTileKey {0, 0}, 3, std::vector<float>(8)), std::length_error);
+    EXPECT_THROW(DemTile(DemTileKey {0, 0}, 1, std::vector<float>(1)), std::invalid_argument);
+
+    const DemTile empty;
+    EXPECT_TRUE(std::isnan(empty.height(deg2rad(0.5), deg2rad(0.5))));
+}
+
+// =================================================================================================
+TEST(DemTileTest, LoadHgt)
+{
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "mathutils_DemTile_test.hgt";
+    write_hgt(path, {100, -200, 300, -32768});
+
+    const DemTile tile = DemTile::load_hgt(path, DemTileKey {1, 2});
+
+    EXPECT_EQ(tile.samples(), 2U);
+    EXPECT_EQ(tile.key().south_deg, 1);
+    EXPECT_FLOAT_EQ(tile.sample(0, 0), 100.0F);
+    EXPECT_FLOAT_EQ(tile.sample(0, 1), -200.0F);
+    EXPECT_FLOAT_EQ(tile.sample(1, 0), 300.0F);
+    EXPECT_TRUE(std::isnan(tile.sample(1, 1)));
+
+    write_hgt(path, {1, 2, 3});
+    EXPECT_THROW(static_cast<void>(DemTile::load_hgt(path, DemTileKey {1, 2})),
+        std::runtime_error);
+
+    write_hgt(path, {});
+
+    try
+    {
+        static_cast<void>(DemTile::load_hgt(path, DemTileKey {1, 2}));
+        ADD_FAILURE() << "Empty tile loaded.";
+    }
+    catch (const std::runtime_error& err)
+    {
+        EXPECT_NE(std::string(err.what()).find("is empty"), std::string::npos);
+    }
+
+    std::filesystem::remove(path);
+    EXPECT_THROW(static_cast<void>(DemTile::load_hgt(path, DemTileKey {1, 2})),
+        std::runtime_error);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,257 @@
+/**
+ * @file line_of_sight_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "conversions.h"
+#include "Geodesy/GeoCoord.h"
+#include "Geodesy/lla_to_ecef.h"
+#include "Terrain/DemTile.h"
+#include "Terrain/DemTileCache.h"
+#include "Terrain/line_of_sight.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using MathUtils::Conversions::deg2rad;
+using MathUtils::DemTileCache;
+using MathUtils::DemTileKey;
+using MathUtils::GeoCoord;
+using MathUtils::hgt_file_name;
+using MathUtils::line_of_sight;
+using MathUtils::lla_to_ecef;
+using MathUtils::LineOfSightOptions;
+using MathUtils::LineOfSightResult;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-Terrain-line_of_sight.xml");
+
+constexpr std::size_t SAMPLES = 121;
+constexpr std::size_t RIDGE_COL = 60;
+constexpr double FLAT_HEIGHT_M = 100.0;
+constexpr double RIDGE_HEIGHT_M = 2000.0;
+
+class LineOfSightTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        m_dir = std::filesystem::temp_directory_path() / "mathutils_line_of_sight_test";
+        std::filesystem::create_directories(m_dir);
+
+        // flat tile with a north-south ridge along -104.5 deg
+        std::ofstream out(m_dir / hgt_file_name(DemTileKey {40, -105}), std::ios::binary);
+
+        for (std::size_t row = 0; row < SAMPLES; row++)
+        {
+            for (std::size_t col = 0; col < SAMPLES; col++)
+            {
+                const double height = (col == RIDGE_COL) ? RIDGE_HEIGHT_M : FLAT_HEIGHT_M;
+                const auto raw = static_cast<std::uint16_t>(static_cast<std::int16_t>(height));
+
+                out.put(static_cast<char>(raw >> 8));
+                out.put(static_cast<char>(raw & 0xFF));
+            }
+        }
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_dir);
+    }
+
+    std::filesystem::path m_dir;
+};
+
+// =================================================================================================
+TEST_F(LineOfSightTest, Pyramid)
+{
+    const DemTileCache cache(m_dir, 4);
+    const auto tile = cache.tile(DemTileKey {40, -105});
+    ASSERT_NE(tile, nullptr);
+
+    // 120 cells: 15 level 0 blocks, then 8, 4, 2, 1
+    ASSERT_EQ(tile->pyramid_levels(), 5U);
+    EXPECT_EQ(tile->num_blocks(0), 15U);
+    EXPECT_EQ(tile->num_blocks(4), 1U);
+
+    // ridge column 60 is inside level 0 block column 7, which spans samples 56 to 64
+    EXPECT_FLOAT_EQ(tile->block_max(0, 3, 7), static_cast<float>(RIDGE_HEIGHT_M));
+    EXPECT_FLOAT_EQ(tile->block_max(0, 3, 6), static_cast<float>(FLAT_HEIGHT_M));
+    EXPECT_FLOAT_EQ(tile->block_min(4, 0, 0), static_cast<float>(FLAT_HEIGHT_M));
+    EXPECT_FLOAT_EQ(tile->block_max(4, 0, 0), static_cast<float>(RIDGE_HEIGHT_M));
+
+    EXPECT_THROW(static_cast<void>(tile->block_max(5, 0, 0)), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(tile->block_max(0, 15, 0)), std::out_of_range);
+}
+
+// =================================================================================================
+TEST_F(LineOfSightTest, RidgeBlocksLowRay)
+{
+    const DemTileCache cache(m_dir, 4);
+
+    const GeoCoord observer(deg2rad(40.5), deg2rad(-104.8), 300.0);
+    const GeoCoord target(deg2rad(40.5), deg2rad(-104.2), 300.0);
+
+    const LineOfSightResult result = line_of_sight(cache, observer, target);
+
+    EXPECT_FALSE(result.visible);
+
+    // blocked within a couple of samples of the ridge
+    const GeoCoord ridge(deg2rad(40.5), deg2rad(-104.5), 300.0);
+    const double ridge_range_m = (lla_to_ecef(ridge) - lla_to_ecef(observer)).magnitude();
+    EXPECT_NEAR(result.blocked_range_m, ridge_range_m, 1000.0);
+}
+
+// =================================================================================================
+TEST_F(LineOfSightTest, HighRaySkipsOpenSky)
+{
+    const DemTileCache cache(m_dir, 4);
+    const LineOfSightOptions options;
+
+    const GeoCoord observer(deg2rad(40.5), deg2rad(-104.8), 3000.0);
+    const GeoCoord target(deg2rad(40.5), deg2rad(-104.2), 3000.0);
+
+    const LineOfSightResult result = line_of_sight(cache, observer, target, options);
+
+    EXPECT_TRUE(result.visible);
+    EXPECT_TRUE(std::isnan(result.blocked_range_m));
+
+    // far fewer steps than a fixed-step march
+    const double length_m = (lla_to_ecef(target) - lla_to_ecef(observer)).magnitude();
+    EXPECT_LT(static_cast<double>(result.steps), 0.1 * length_m / options.min_step_m);
+
+    // requiring more clearance than the ray has over the ridge blocks it
+    LineOfSightOptions strict;
+    strict.clearance_m = 1500.0;
+    EXPECT_FALSE(line_of_sight(cache, observer, target, strict).visible);
+}
+
+// =================================================================================================
+TEST_F(LineOfSightTest, MissingTiles)
+{
+    const DemTileCache cache(m_dir, 4);
+
+    const GeoCoord observer(deg2rad(0.2), deg2rad(0.2), 50.0);
+    const GeoCoord target(deg2rad(0.25), deg2rad(0.3), 50.0);
+
+    EXPECT_TRUE(line_of_sight(cache, observer, target).visible);
+
+    LineOfSightOptions options;
+    options.missing_tile_height_m = 100.0;
+    EXPECT_FALSE(line_of_sight(cache, observer, target, options).visible);
+}
+
+// =================================================================================================
+TEST_F(LineOfSightTest, InvalidMinStep)
+{
+    const DemTileCache cache(m_dir, 4);
+
+    // above the flat surface but below the ridge block maximum, where a zero step would stall
+    const GeoCoord observer(deg2rad(40.5), deg2rad(-104.8), 150.0);
+    const GeoCoord target(deg2rad(40.5), deg2rad(-104.2), 150.0);
+
+    for (const double min_step_m : {0.0, -1.0, std::numeric_limits<double>::quiet_NaN()})
+    {
+        LineOfSightOptions options;
+        options.min_step_m = min_step_m;
+
+        EXPECT_THROW(static_cast<void>(line_of_sight(cache, observer, target, options)),
+            std::invalid_argument);
+
+        const std::array<GeoCoord, 1> observers {observer};
+        const std::array<GeoCoord, 1> targets {target};
+        std::array<LineOfSightResult, 1> results {};
+        EXPECT_THROW(line_of_sight(cache, observers, targets, results, options),
+            std::invalid_argument);
+    }
+}
+
+// =================================================================================================
+TEST_F(LineOfSightTest, Batch)
+{
+    const DemTileCache cache(m_dir, 4);
+
+    const std::array<GeoCoord, 3> observers {
+        GeoCoord(deg2rad(40.5), deg2rad(-104.8), 300.0),
+        GeoCoord(deg2rad(40.5), deg2rad(-104.8), 3000.0),
+        GeoCoord(deg2rad(40.2), deg2rad(-104.9), 300.0)
+    };
+    const std::array<GeoCoord, 3> targets {
+        GeoCoord(deg2rad(40.5), deg2rad(-104.2), 300.0),
+        GeoCoord(deg2rad(40.5), deg2rad(-104.2), 3000.0),
+        GeoCoord(deg2rad(40.8), deg2rad(-104.7), 300.0)
+    };
+
+    std::array<LineOfSightResult, 3> results {};
+    line_of_sight(cache, observers, targets, results);
+
+    EXPECT_FALSE(results[0].visible);
+    EXPECT_TRUE(results[1].visible);
+    EXPECT_TRUE(results[2].visible);
+
+    std::array<LineOfSightResult, 2> too_few {};
+    EXPECT_THROW(line_of_sight(cache, observers, targets, too_few), std::length_error);
+}
+
+// =================================================================================================
+TEST_F(LineOfSightTest, ThreadedBatchMatchesSequential)
+{
+    const DemTileCache cache(m_dir, 4);
+
+    // rays crossing the ridge at a range of heights, some blocked and some clear
+    constexpr std::size_t num_pairs = 101;
+    std::vector<GeoCoord> observers;
+    std::vector<GeoCoord> targets;
+
+    for (std::size_t idx = 0; idx < num_pairs; idx++)
+    {
+        const double frac = static_cast<double>(idx) / static_cast<double>(num_pairs);
+        const double alt = 150.0 + (3000.0 * frac);
+        observers.emplace_back(deg2rad(40.1 + (0.8 * frac)), deg2rad(-104.9), alt);
+        targets.emplace_back(deg2rad(40.9 - (0.8 * frac)), deg2rad(-104.1), alt);
+    }
+
+    std::vector<LineOfSightResult> sequential(num_pairs);
+    line_of_sight(cache, observers, targets, sequential, LineOfSightOptions{}, 1);
+
+    std::size_t num_visible = 0;
+
+    for (const std::size_t num_threads : {std::size_t {0}, std::size_t {3}, std::size_t {200}})
+    {
+        std::vector<LineOfSightResult> threaded(num_pairs);
+        line_of_sight(cache, observers, targets, threaded, LineOfSightOptions{}, num_threads);
+
+        num_visible = 0;
+
+        for (std::size_t idx = 0; idx < num_pairs; idx++)
+        {
+            EXPECT_EQ(threaded[idx].visible, sequential[idx].visible);
+            EXPECT_EQ(threaded[idx].steps, sequential[idx].steps);
+            num_visible += threaded[idx].visible ? 1 : 0;
+        }
+    }
+
+    EXPECT_GT(num_visible, 0U);
+    EXPECT_LT(num_visible, num_pairs);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
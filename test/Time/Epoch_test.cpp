@@ -0,0 +1,94 @@
+/**
+ * @file Epoch_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Time/Epoch.h"
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+using MathUtils::Epoch;
+using MathUtils::J2000_JD;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-Epoch.xml");
+
+// =================================================================================================
+TEST(EpochTest, FromCalendar)
+{
+    const Epoch j2000 = Epoch::from_calendar(2000, 1, 1, 12);
+    EXPECT_DOUBLE_EQ(j2000.day(), J2000_JD);
+    EXPECT_DOUBLE_EQ(j2000.fraction(), 0.0);
+    EXPECT_DOUBLE_EQ(j2000.julian_centuries_j2000(), 0.0);
+
+    const Epoch mjd_zero = Epoch::from_calendar(1858, 11, 17);
+    EXPECT_DOUBLE_EQ(mjd_zero.mjd(), 0.0);
+    EXPECT_DOUBLE_EQ(mjd_zero.julian_date(), 2'400'000.5);
+
+    // Vallado, 4th ed., example 3-4
+    const Epoch vallado = Epoch::from_calendar(1996, 10, 26, 14, 20, 0.0);
+    EXPECT_NEAR(vallado.julian_date(), 2'450'383.097'222'22, 1e-8);
+
+    const Epoch leap_day = Epoch::from_calendar(2024, 2, 29, 6, 30, 15.25);
+    EXPECT_DOUBLE_EQ(leap_day.day(), 2'460'369.0);
+    EXPECT_NEAR(leap_day.fraction(), 0.5 + ((6.0 * 3'600.0) + (30.0 * 60.0) + 15.25) / 86'400.0,
+        1e-15);
+}
+
+// =================================================================================================
+TEST(EpochTest, Normalize)
+{
+    const Epoch split(2'451'545.75, 0.5);
+    EXPECT_DOUBLE_EQ(split.day(), 2'451'546.0);
+    EXPECT_DOUBLE_EQ(split.fraction(), 0.25);
+
+    const Epoch negative(2'451'545.0, -0.25);
+    EXPECT_DOUBLE_EQ(negative.day(), 2'451'544.0);
+    EXPECT_DOUBLE_EQ(negative.fraction(), 0.75);
+
+    // -1e-18 + 1 rounds to 1, which must carry into the day
+    const Epoch tiny(2'451'545.0, -1e-18);
+    EXPECT_DOUBLE_EQ(tiny.day(), 2'451'545.0);
+    EXPECT_LT(tiny.fraction(), 1.0);
+    EXPECT_GE(tiny.fraction(), 0.0);
+
+    const Epoch from_mjd = Epoch::from_mjd(51'544.5);
+    EXPECT_DOUBLE_EQ(from_mjd.day(), J2000_JD);
+    EXPECT_DOUBLE_EQ(from_mjd.fraction(), 0.0);
+}
+
+// =================================================================================================
+TEST(EpochTest, SubMicrosecondArithmetic)
+{
+    const Epoch start = Epoch::from_calendar(2026, 10, 18, 11, 59, 59.0);
+
+    // a single-double Julian date would round this away entirely
+    const Epoch later = start.plus_seconds(1e-6);
+    EXPECT_NEAR(later.seconds_since(start), 1e-6, 1e-11);
+
+    // across the Julian day boundary at noon
+    const Epoch next_day = start.plus_seconds(2.5);
+    EXPECT_DOUBLE_EQ(next_day.day(), start.day() + 1.0);
+    EXPECT_NEAR(next_day.seconds_since(start), 2.5, 1e-9);
+    EXPECT_NEAR(start.seconds_since(next_day), -2.5, 1e-9);
+
+    std::ostringstream os;
+    os << Epoch(2'451'545.0, 0.25);
+    EXPECT_EQ(os.str(), "2.45154e+06, 0.25");
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
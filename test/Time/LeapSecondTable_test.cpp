@@ -0,0 +1,93 @@
+/**
+ * @file LeapSecondTable_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Time/Epoch.h"
+#include "Time/LeapSecondTable.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MathUtils::Epoch;
+using MathUtils::LeapSecond;
+using MathUtils::LeapSecondCursor;
+using MathUtils::LeapSecondTable;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-LeapSecondTable.xml");
+
+// =================================================================================================
+TEST(LeapSecondTableTest, Builtin)
+{
+    const LeapSecondTable& table = LeapSecondTable::builtin();
+
+    ASSERT_EQ(table.size(), 28U);
+    EXPECT_DOUBLE_EQ(table.entries()[0].tai_minus_utc_s, 10.0);
+    EXPECT_DOUBLE_EQ(table.entries()[27].tai_minus_utc_s, 37.0);
+
+    // every entry's date agrees with the calendar
+    EXPECT_DOUBLE_EQ(table.entries()[0].mjd_utc, Epoch::from_calendar(1972, 1, 1).mjd());
+    EXPECT_DOUBLE_EQ(table.entries()[13].mjd_utc, Epoch::from_calendar(1985, 7, 1).mjd());
+    EXPECT_DOUBLE_EQ(table.entries()[27].mjd_utc, Epoch::from_calendar(2017, 1, 1).mjd());
+
+    EXPECT_EQ(table.find_utc(57'754.0), 27U);
+    EXPECT_EQ(table.find_utc(57'753.999), 26U);
+    EXPECT_EQ(table.find_utc(30'000.0), 0U);
+    EXPECT_EQ(table.find_utc(70'000.0), 27U);
+
+    // the TAI boundary is 37 s after the UTC one
+    EXPECT_EQ(table.find_tai(57'754.0 + (36.5 / 86'400.0)), 26U);
+    EXPECT_EQ(table.find_tai(57'754.0 + (37.5 / 86'400.0)), 27U);
+
+    EXPECT_EQ(&LeapSecondTable::builtin(), &table);
+}
+
+// =================================================================================================
+TEST(LeapSecondTableTest, CursorMatchesSearch)
+{
+    const LeapSecondTable& table = LeapSecondTable::builtin();
+    LeapSecondCursor cursor;
+
+    // a monotonic stream across several leap seconds, then a jump back
+    for (double mjd = 41'000.0; mjd < 58'000.0; mjd += 3.7)
+    {
+        const double offset = cursor.tai_minus_utc_at_utc(mjd);
+        EXPECT_DOUBLE_EQ(offset, table.entries()[table.find_utc(mjd)].tai_minus_utc_s);
+        EXPECT_EQ(cursor.index(), table.find_utc(mjd));
+    }
+
+    EXPECT_DOUBLE_EQ(cursor.tai_minus_utc_at_utc(45'000.0), 20.0);
+    EXPECT_DOUBLE_EQ(cursor.tai_minus_utc_at_tai(57'754.0), 36.0);
+    EXPECT_DOUBLE_EQ(cursor.tai_minus_utc_at_tai(57'754.001), 37.0);
+}
+
+// =================================================================================================
+TEST(LeapSecondTableTest, Custom)
+{
+    const LeapSecondTable table(std::vector<LeapSecond> {{100.0, 1.0}, {200.0, 2.0}});
+    LeapSecondCursor cursor(table);
+
+    EXPECT_DOUBLE_EQ(cursor.tai_minus_utc_at_utc(50.0), 1.0);
+    EXPECT_DOUBLE_EQ(cursor.tai_minus_utc_at_utc(250.0), 2.0);
+
+    EXPECT_THROW(LeapSecondTable(std::vector<LeapSecond> {}), std::invalid_argument);
+    EXPECT_THROW(LeapSecondTable(std::vector<LeapSecond> {{200.0, 2.0}, {100.0, 1.0}}),
+        std::invalid_argument);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,120 @@
+/**
+ * @file time_scales_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "Time/Epoch.h"
+#include "Time/LeapSecondTable.h"
+#include "Time/time_scales.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using MathUtils::convert_time;
+using MathUtils::Epoch;
+using MathUtils::LeapSecondCursor;
+using MathUtils::TimeScale;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-time_scales.xml");
+
+// =================================================================================================
+TEST(TimeScalesTest, Offsets)
+{
+    const Epoch utc = Epoch::from_calendar(2017, 1, 1);
+
+    EXPECT_NEAR(convert_time(utc, TimeScale::UTC, TimeScale::TAI).seconds_since(utc), 37.0, 1e-9);
+    EXPECT_NEAR(convert_time(utc, TimeScale::UTC, TimeScale::GPS).seconds_since(utc), 18.0, 1e-9);
+    EXPECT_NEAR(convert_time(utc, TimeScale::UTC, TimeScale::TT).seconds_since(utc), 69.184, 1e-9);
+
+    const Epoch before = Epoch::from_calendar(2016, 12, 31, 23, 59, 59.0);
+    EXPECT_NEAR(convert_time(before, TimeScale::UTC, TimeScale::TAI).seconds_since(before), 36.0,
+        1e-9);
+
+    const Epoch gps = Epoch::from_calendar(2020, 6, 1);
+    EXPECT_NEAR(convert_time(gps, TimeScale::GPS, TimeScale::TT).seconds_since(gps), 51.184, 1e-9);
+    EXPECT_DOUBLE_EQ(convert_time(gps, TimeScale::TT, TimeScale::TT).fraction(), gps.fraction());
+}
+
+// =================================================================================================
+TEST(TimeScalesTest, RoundTrip)
+{
+    LeapSecondCursor cursor;
+
+    for (const TimeScale scale : {TimeScale::TAI, TimeScale::GPS, TimeScale::TT})
+    {
+        for (int year = 1975; year < 2030; year += 3)
+        {
+            const Epoch utc = Epoch::from_calendar(year, 7, 1, 0, 0, 0.25);
+            const Epoch other = convert_time(utc, TimeScale::UTC, scale, cursor);
+            const Epoch back = convert_time(other, scale, TimeScale::UTC, cursor);
+
+            EXPECT_NEAR(back.seconds_since(utc), 0.0, 1e-9) << year;
+        }
+    }
+}
+
+// =================================================================================================
+TEST(TimeScalesTest, InsertedSecond)
+{
+    // TAI 00:00:36.5 on 2017-01-01 is UTC 2016-12-31 23:59:60.5
+    const Epoch tai = Epoch::from_calendar(2017, 1, 1, 0, 0, 36.5);
+    const Epoch utc = convert_time(tai, TimeScale::TAI, TimeScale::UTC);
+
+    EXPECT_NEAR(utc.seconds_since(Epoch::from_calendar(2017, 1, 1)), 0.5, 1e-9);
+}
+
+// =================================================================================================
+TEST(TimeScalesTest, Batch)
+{
+    std::vector<Epoch> utc;
+
+    for (std::size_t idx = 0; idx < 200; idx++)
+    {
+        utc.push_back(Epoch::from_calendar(2016, 12, 31, 23, 0, 0.0).plus_seconds(
+            37.0 * static_cast<double>(idx)));
+    }
+
+    for (const TimeScale scale : {TimeScale::TAI, TimeScale::GPS, TimeScale::TT})
+    {
+        std::vector<Epoch> out(utc.size());
+        convert_time(utc, out, TimeScale::UTC, scale);
+
+        std::vector<Epoch> back(utc.size());
+        convert_time(out, back, scale, TimeScale::GPS);
+
+        for (std::size_t idx = 0; idx < utc.size(); idx++)
+        {
+            const Epoch expected = convert_time(utc[idx], TimeScale::UTC, scale);
+            EXPECT_DOUBLE_EQ(out[idx].day(), expected.day());
+            EXPECT_DOUBLE_EQ(out[idx].fraction(), expected.fraction());
+
+            const Epoch gps = convert_time(utc[idx], TimeScale::UTC, TimeScale::GPS);
+            EXPECT_NEAR(back[idx].seconds_since(gps), 0.0, 1e-9);
+        }
+    }
+
+    // in place
+    std::vector<Epoch> in_place = utc;
+    convert_time(in_place, in_place, TimeScale::UTC, TimeScale::TAI);
+    EXPECT_NEAR(in_place.back().seconds_since(utc.back()), 37.0, 1e-9);
+
+    std::vector<Epoch> too_few(utc.size() - 1);
+    EXPECT_THROW(convert_time(utc, too_few, TimeScale::UTC, TimeScale::TAI), std::length_error);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,60 @@
+/**
+ * @file fast_rsqrt_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "fast_rsqrt.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-fast_rsqrt.xml");
+
+/**
+ * @brief Largest relative error of fast_rsqrt over [1e-3, 1e3].
+ */
+template<unsigned ITERATIONS>
+double max_relative_error()
+{
+    double max_err = 0.0;
+
+    for (double val = 1e-3; val < 1e3; val *= 1.001)
+    {
+        const double err = std::abs((MathUtils::fast_rsqrt<ITERATIONS>(val) * std::sqrt(val)) - 1.0);
+        max_err = (err > max_err) ? err : max_err;
+    }
+
+    return max_err;
+}
+
+// =================================================================================================
+TEST(FastRsqrtTest, DocumentedErrorBounds)
+{
+    EXPECT_LT(max_relative_error<0>(), 3.5e-2);
+    EXPECT_LT(max_relative_error<1>(), 1.8e-3);
+    EXPECT_LT(max_relative_error<2>(), 4.6e-6);
+    EXPECT_LT(max_relative_error<3>(), 3.2e-11);
+}
+
+// =================================================================================================
+TEST(FastRsqrtTest, DefaultUsesTwoIterations)
+{
+    EXPECT_DOUBLE_EQ(MathUtils::fast_rsqrt(2.0), MathUtils::fast_rsqrt<2>(2.0));
+    EXPECT_NEAR(MathUtils::fast_rsqrt(4.0), 0.5, 0.5 * 4.6e-6);
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace
@@ -0,0 +1,92 @@
+/**
+ * @file fixed_point_test.cpp
+ * @author Michael Wrona
+ * @date 2026-10-18
+ */
+
+#include "fixed_point.h"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+
+using MathUtils::FixedPoint;
+using MathUtils::Q15;
+using MathUtils::Q31;
+
+namespace {
+
+const std::string test_reports_file = std::string("TESTRESULTS-fixed_point.xml");
+
+// =================================================================================================
+TEST(FixedPointTest, RoundTripsDouble)
+{
+    EXPECT_DOUBLE_EQ(Q15(0.5).to_double(), 0.5);
+    EXPECT_DOUBLE_EQ(Q31(-0.25).to_double(), -0.25);
+    EXPECT_EQ(Q15(0.5).raw(), 16384);
+}
+
+// =================================================================================================
+TEST(FixedPointTest, ConversionSaturates)
+{
+    EXPECT_EQ(Q15(1.0), Q15::max());
+    EXPECT_EQ(Q15(-2.0), Q15::min());
+    EXPECT_EQ(Q31(5.0), Q31::max());
+
+    // far past the range of the integer used for rounding
+    EXPECT_EQ(Q31(1e300), Q31::max());
+    EXPECT_EQ(Q31(-1e300), Q31::min());
+    EXPECT_EQ(Q15(std::numeric_limits<double>::infinity()), Q15::max());
+    EXPECT_EQ(Q15(-std::numeric_limits<double>::infinity()), Q15::min());
+}
+
+// =================================================================================================
+TEST(FixedPointTest, NanConvertsToZero)
+{
+    EXPECT_EQ(Q15(std::numeric_limits<double>::quiet_NaN()).raw(), 0);
+    EXPECT_EQ(Q31(-std::numeric_limits<double>::quiet_NaN()).raw(), 0);
+}
+
+// =================================================================================================
+TEST(FixedPointTest, AdditionSaturates)
+{
+    EXPECT_EQ(Q15(0.75) + Q15(0.75), Q15::max());
+    EXPECT_EQ(Q15(-0.75) - Q15(0.75), Q15::min());
+    EXPECT_DOUBLE_EQ((Q15(0.25) + Q15(0.5)).to_double(), 0.75);
+}
+
+// =================================================================================================
+TEST(FixedPointTest, MultiplicationRounds)
+{
+    EXPECT_DOUBLE_EQ((Q15(0.5) * Q15(-0.25)).to_double(), -0.125);
+    EXPECT_NEAR((Q31(0.3) * Q31(0.7)).to_double(), 0.21, 1e-9);
+}
+
+// =================================================================================================
+TEST(FixedPointTest, NegateMinimumSaturates)
+{
+    EXPECT_EQ(-Q15::min(), Q15::max());
+    EXPECT_DOUBLE_EQ((-Q15(0.5)).to_double(), -0.5);
+}
+
+// =================================================================================================
+TEST(FixedPointTest, ConfigurableFractionalBits)
+{
+    using Q8_8 = FixedPoint<std::int16_t, 8>;
+
+    EXPECT_DOUBLE_EQ((Q8_8(12.5) * Q8_8(2.0)).to_double(), 25.0);
+    EXPECT_EQ(Q8_8(200.0), Q8_8::max());
+}
+
+// =================================================================================================
+int main(int argc, char** argv)
+{
+    ::testing::GTEST_FLAG(output) = std::string("xml:") + test_reports_file;
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+}  // namespace